@@ -8,8 +8,9 @@
 OLD_ROCBLAS_VERSION="14.3.4"
 NEW_ROCBLAS_VERSION="15.3.4"
 
+# tensile_tag stays pinned, see CMakeLists.txt
 OLD_TENSILE_VERSION="tensile_tag e747c75b7ebc8bf9f005f5881be18122fc94f7f7"
-NEW_TENSILE_VERSION="tensile_tag \"develop\""
+NEW_TENSILE_VERSION="tensile_tag e747c75b7ebc8bf9f005f5881be18122fc94f7f7"
 
 sed -i "s/${OLD_ROCBLAS_VERSION}/${NEW_ROCBLAS_VERSION}/g" CMakeLists.txt
 sed -i "s/${OLD_TENSILE_VERSION}/${NEW_TENSILE_VERSION}/g" CMakeLists.txt
@@ -9,7 +9,8 @@
 OLD_ROCBLAS_VERSION="15.3.3"
 NEW_ROCBLAS_VERSION="14.3.4"
 
-OLD_TENSILE_VERSION="tensile_tag \"develop\""
+# tensile_tag stays pinned, see CMakeLists.txt
+OLD_TENSILE_VERSION="tensile_tag e747c75b7ebc8bf9f005f5881be18122fc94f7f7"
 NEW_TENSILE_VERSION="tensile_tag e747c75b7ebc8bf9f005f5881be18122fc94f7f7"
 
 OLD_MINIMUM_REQUIRED_VERSION="MinimumRequiredVersion: 4.6.0"
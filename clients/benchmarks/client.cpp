@@ -28,6 +28,7 @@
 #include "testing_geam.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_matrix.hpp"
+#include "testing_handle.hpp"
 #if BUILD_WITH_TENSILE
 #include "testing_gemm.hpp"
 #include "testing_gemm_strided_batched.hpp"
@@ -36,6 +37,7 @@
 #include "testing_trsm.hpp"
 #include "testing_gemm_ex.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_gemm_overhead.hpp"
 #endif
 
 static int run_bench_test(const char* function, char precision, Arguments argus)
@@ -167,6 +169,10 @@ static int run_bench_test(const char* function, char precision, Arguments argus)
         else if(precision == 'd')
             testing_set_get_matrix<double>(argus);
     }
+    else if(!strcmp(function, "handle"))
+    {
+        testing_handle(argus);
+    }
 #if BUILD_WITH_TENSILE
     else if(!strcmp(function, "gemm"))
     {
@@ -322,6 +328,13 @@ static int run_bench_test(const char* function, char precision, Arguments argus)
 
         testing_gemm_strided_batched_ex(argus);
     }
+    else if(!strcmp(function, "gemm_overhead"))
+    {
+        if(precision == 's')
+            testing_gemm_overhead<float>(argus);
+        else if(precision == 'd')
+            testing_gemm_overhead<double>(argus);
+    }
     else if(!strcmp(function, "gemm_kernel_name"))
     {
         // adjust dimension for GEMM routines
@@ -452,6 +465,130 @@ static int rocblas_bench_datafile(const string& datafile)
     return 0;
 }
 
+// value of a scalar captured in its own type, as a double
+static double capture_scalar(const uint8_t* bytes, rocblas_datatype type)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f16_r:
+    {
+        rocblas_half value;
+        memcpy(&value, bytes, sizeof(value));
+        return half_to_float(value);
+    }
+    case rocblas_datatype_f32_r:
+    case rocblas_datatype_f32_c:
+    {
+        float value;
+        memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case rocblas_datatype_f64_r:
+    case rocblas_datatype_f64_c:
+    {
+        double value;
+        memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    case rocblas_datatype_i32_r:
+    {
+        int32_t value;
+        memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+    default: return 0;
+    }
+}
+
+// replay the calls recorded with ROCBLAS_LAYER=8 in the order they were made;
+// every call gets buffers of its own sizes and is timed like a single benchmark
+static int rocblas_bench_replay(const string& capture_file, Arguments base)
+{
+    ifstream ifs(capture_file, ifstream::binary);
+    if(ifs.fail())
+    {
+        std::cerr << "Cannot open " << capture_file << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    rocblas_capture_header header;
+    if(!ifs.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+       strncmp(header.magic, "rbcapt", sizeof(header.magic)) ||
+       header.record_size != sizeof(rocblas_capture_record))
+    {
+        std::cerr << capture_file << " is not a rocblas capture file of this version" << std::endl;
+        return -1;
+    }
+
+    size_t calls = 0;
+    double start = get_time_us();
+
+    rocblas_capture_record record;
+    while(ifs.read(reinterpret_cast<char*>(&record), sizeof(record)))
+    {
+        Arguments argus = base;
+        record.function[sizeof(record.function) - 1] = 0;
+
+        argus.M              = record.m;
+        argus.N              = record.n;
+        argus.K              = record.k;
+        argus.lda            = record.lda;
+        argus.ldb            = record.ldb;
+        argus.ldc            = record.ldc;
+        argus.ldd            = record.ldd;
+        argus.incx           = record.incx;
+        argus.incy           = record.incy;
+        argus.stride_a       = record.stride_a;
+        argus.stride_b       = record.stride_b;
+        argus.stride_c       = record.stride_c;
+        argus.stride_d       = record.stride_d;
+        argus.batch_count    = record.batch_count;
+        argus.algo           = record.algo;
+        argus.solution_index = record.solution_index;
+        argus.flags          = record.flags;
+        argus.workspace_size = record.workspace_size;
+
+        // letters are 0 for routines without the option
+        if(record.trans_a)
+            argus.transA_option = record.trans_a;
+        if(record.trans_b)
+            argus.transB_option = record.trans_b;
+        if(record.side)
+            argus.side_option = record.side;
+        if(record.uplo)
+            argus.uplo_option = record.uplo;
+        if(record.diag)
+            argus.diag_option = record.diag;
+
+        // only the _ex routines record data types; the others use precision
+        rocblas_datatype scalar_type = char2rocblas_datatype(record.precision);
+        if(record.a_type)
+        {
+            argus.a_type       = static_cast<rocblas_datatype>(record.a_type);
+            argus.b_type       = static_cast<rocblas_datatype>(record.b_type);
+            argus.c_type       = static_cast<rocblas_datatype>(record.c_type);
+            argus.d_type       = static_cast<rocblas_datatype>(record.d_type);
+            argus.compute_type = static_cast<rocblas_datatype>(record.compute_type);
+            scalar_type        = argus.compute_type;
+        }
+        argus.alpha = capture_scalar(record.alpha, scalar_type);
+        argus.beta  = capture_scalar(record.beta, scalar_type);
+
+        std::cout << "replay " << calls << ": " << record.function << " -r " << record.precision
+                  << " handle " << std::hex << record.handle << " stream " << record.stream
+                  << std::dec
+                  << (record.pointer_mode == rocblas_pointer_mode_device ? " device" : " host")
+                  << " pointer mode" << std::endl;
+
+        run_bench_test(record.function, record.precision, argus);
+        calls++;
+    }
+
+    std::cout << "replayed " << calls << " calls in " << (get_time_us() - start) << " us"
+              << std::endl;
+    return 0;
+}
+
 using namespace boost::program_options;
 
 int main(int argc, char* argv[])
@@ -471,6 +608,7 @@ int main(int argc, char* argv[])
 
     rocblas_int device_id;
     std::string datafile;
+    std::string replayfile;
 
     options_description desc("rocblas client command line options");
     desc.add_options()
@@ -542,7 +680,8 @@ int main(int argc, char* argv[])
 
         ("function,f",
          value<std::string>(&function)->default_value("gemv"),
-         "BLAS function to test. Options: gemv, ger, syr, trsm, trmm, symv, syrk, syr2k")
+         "BLAS function to test. Options: gemv, ger, syr, trsm, trmm, symv, syrk, syr2k, handle, "
+         "gemm_overhead")
 
         ("precision,r",
          value<char>(&precision)->default_value('s'), "Options: h,s,d,c,z")
@@ -619,6 +758,11 @@ int main(int argc, char* argv[])
          value<string>(&datafile),
          "Data file to use for test arguments (overrides all of the above)")
 
+        ("replay",
+         value<string>(&replayfile),
+         "Capture file written with ROCBLAS_LAYER=8 and ROCBLAS_LOG_CAPTURE_PATH to replay "
+         "call by call (overrides all of the above except --iters)")
+
         ("device",
          value<rocblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -655,6 +799,11 @@ int main(int argc, char* argv[])
         return rocblas_bench_datafile(datafile);
     }
 
+    if(replayfile != "")
+    {
+        return rocblas_bench_replay(replayfile, argus);
+    }
+
     if(!strchr("hsdcz", tolower(precision)))
     {
         std::cerr << "Invalid value for --precision" << std::endl;
@@ -638,6 +638,97 @@ void cblas_gemm<rocblas_half, rocblas_half>(rocblas_operation transA,
     }
 }
 
+template <>
+void cblas_gemm<rocblas_bfloat16, float>(rocblas_operation transA,
+                                         rocblas_operation transB,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         float alpha,
+                                         rocblas_bfloat16* A,
+                                         rocblas_int lda,
+                                         rocblas_bfloat16* B,
+                                         rocblas_int ldb,
+                                         float beta,
+                                         float* C,
+                                         rocblas_int ldc)
+{
+    // cblas does not support rocblas_bfloat16; widening it to float is exact
+    rocblas_int sizeA = (transA == rocblas_operation_none ? k : m) * lda;
+    rocblas_int sizeB = (transB == rocblas_operation_none ? n : k) * ldb;
+
+    host_vector<float> A_float(sizeA), B_float(sizeB);
+
+    for(rocblas_int i = 0; i < sizeA; i++)
+    {
+        A_float[i] = bfloat16_to_float(A[i]);
+    }
+    for(rocblas_int i = 0; i < sizeB; i++)
+    {
+        B_float[i] = bfloat16_to_float(B[i]);
+    }
+
+    cblas_sgemm(CblasColMajor,
+                static_cast<CBLAS_TRANSPOSE>(transA),
+                static_cast<CBLAS_TRANSPOSE>(transB),
+                m,
+                n,
+                k,
+                alpha,
+                A_float,
+                lda,
+                B_float,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_gemm<rocblas_bfloat16, rocblas_bfloat16>(rocblas_operation transA,
+                                                    rocblas_operation transB,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    rocblas_bfloat16 alpha,
+                                                    rocblas_bfloat16* A,
+                                                    rocblas_int lda,
+                                                    rocblas_bfloat16* B,
+                                                    rocblas_int ldb,
+                                                    rocblas_bfloat16 beta,
+                                                    rocblas_bfloat16* C,
+                                                    rocblas_int ldc)
+{
+    // compute in float, as rocBLAS does, and round the result to bfloat16
+    rocblas_int sizeC = n * ldc;
+
+    host_vector<float> C_float(sizeC);
+
+    for(rocblas_int i = 0; i < sizeC; i++)
+    {
+        C_float[i] = bfloat16_to_float(C[i]);
+    }
+
+    cblas_gemm<rocblas_bfloat16, float>(transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        bfloat16_to_float(alpha),
+                                        A,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        bfloat16_to_float(beta),
+                                        C_float,
+                                        ldc);
+
+    for(rocblas_int i = 0; i < sizeC; i++)
+    {
+        C[i] = float_to_bfloat16(C_float[i]);
+    }
+}
+
 template <>
 void cblas_gemm<float, float>(rocblas_operation transA,
                               rocblas_operation transB,
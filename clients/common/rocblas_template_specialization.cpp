@@ -1036,6 +1036,108 @@ rocblas_status rocblas_gemm_strided_batched<double>(rocblas_handle handle,
                                          batch_count);
 }
 
+template <>
+rocblas_status rocblas_gemm_batched<rocblas_half>(rocblas_handle handle,
+                                                  rocblas_operation transA,
+                                                  rocblas_operation transB,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_int k,
+                                                  const rocblas_half* alpha,
+                                                  const rocblas_half* const A[],
+                                                  rocblas_int lda,
+                                                  const rocblas_half* const B[],
+                                                  rocblas_int ldb,
+                                                  const rocblas_half* beta,
+                                                  rocblas_half* const C[],
+                                                  rocblas_int ldc,
+                                                  rocblas_int batch_count)
+{
+    return rocblas_hgemm_batched(handle,
+                                 transA,
+                                 transB,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+template <>
+rocblas_status rocblas_gemm_batched<float>(rocblas_handle handle,
+                                           rocblas_operation transA,
+                                           rocblas_operation transB,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_int k,
+                                           const float* alpha,
+                                           const float* const A[],
+                                           rocblas_int lda,
+                                           const float* const B[],
+                                           rocblas_int ldb,
+                                           const float* beta,
+                                           float* const C[],
+                                           rocblas_int ldc,
+                                           rocblas_int batch_count)
+{
+    return rocblas_sgemm_batched(handle,
+                                 transA,
+                                 transB,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+template <>
+rocblas_status rocblas_gemm_batched<double>(rocblas_handle handle,
+                                            rocblas_operation transA,
+                                            rocblas_operation transB,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const double* alpha,
+                                            const double* const A[],
+                                            rocblas_int lda,
+                                            const double* const B[],
+                                            rocblas_int ldb,
+                                            const double* beta,
+                                            double* const C[],
+                                            rocblas_int ldc,
+                                            rocblas_int batch_count)
+{
+    return rocblas_dgemm_batched(handle,
+                                 transA,
+                                 transB,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
 template <>
 rocblas_status rocblas_trsm<float>(rocblas_handle handle,
                                    rocblas_side side,
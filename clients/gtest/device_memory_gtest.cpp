@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     BLAS device memory size query and reservation:
+=================================================================== */
+
+TEST(quick_auxilliary, device_memory_size_query)
+{
+    rocblas_int N = 100000;
+    float result  = 0;
+    size_t size   = 0;
+    rocblas_local_handle handle;
+    host_vector<float> hx(N, 1.0f);
+    device_vector<float> dx(N);
+    ASSERT_TRUE(dx);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    // a query only records the workspace size and does not touch result
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_internal_error);
+    EXPECT_EQ(rocblas_sasum(handle, N, dx, 1, &result), rocblas_status_success);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+    EXPECT_EQ(result, 0.0f);
+    EXPECT_GT(size, 0u);
+
+    // a quick return needs no workspace
+    size_t zero_size = 1;
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(rocblas_sasum(handle, 0, dx, 1, &result), rocblas_status_success);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &zero_size), rocblas_status_success);
+    EXPECT_EQ(zero_size, 0u);
+
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &zero_size),
+              rocblas_status_internal_error);
+
+    // after reserving the queried size, calls do not grow the device memory
+    size_t reserved = 0;
+    EXPECT_EQ(rocblas_set_device_memory_size(handle, size), rocblas_status_success);
+    EXPECT_EQ(rocblas_get_device_memory_size(handle, &reserved), rocblas_status_success);
+    EXPECT_GE(reserved, size);
+
+    for(int i = 0; i < 3; i++)
+    {
+        size_t current = 0;
+        EXPECT_EQ(rocblas_sasum(handle, N, dx, 1, &result), rocblas_status_success);
+        EXPECT_EQ(result, float(N));
+        EXPECT_EQ(rocblas_get_device_memory_size(handle, &current), rocblas_status_success);
+        EXPECT_EQ(current, reserved);
+    }
+}
+
+TEST(quick_auxilliary, device_memory_size_bad_arg)
+{
+    size_t size = 0;
+    rocblas_local_handle handle;
+
+    EXPECT_EQ(rocblas_start_device_memory_size_query(nullptr), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(nullptr, &size),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_set_device_memory_size(nullptr, 0), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_get_device_memory_size(nullptr, &size), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_get_device_memory_size(handle, nullptr), rocblas_status_invalid_pointer);
+}
+
+#if BUILD_WITH_TENSILE
+
+TEST(quick_auxilliary, device_memory_trsm_workspace_on_first_use)
+{
+    rocblas_int M = 128, N = 4, lda = M, ldb = M;
+    float alpha   = 1.0f;
+    size_t size_1 = 1, size_2 = 1;
+    rocblas_local_handle handle_1, handle_2;
+
+    // trsm buffers are not allocated by handle creation
+    EXPECT_EQ(rocblas_get_device_memory_size(handle_1, &size_1), rocblas_status_success);
+    EXPECT_EQ(size_1, 0u);
+
+    host_vector<float> hA(lda * M, 0.0f), hB(ldb * N), hB_copy(ldb * N);
+    for(rocblas_int i = 0; i < M; i++)
+        hA[i + i * lda] = 1.0f;
+    rocblas_init<float>(hB, M, N, ldb);
+
+    device_vector<float> dA(lda * M), dB(ldb * N);
+    ASSERT_TRUE(dA && dB);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * lda * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * ldb * N, hipMemcpyHostToDevice));
+
+    // both handles attach to the same shared buffers; solving with the identity
+    // leaves B unchanged
+    for(rocblas_handle handle : {(rocblas_handle)handle_1, (rocblas_handle)handle_2})
+    {
+        EXPECT_EQ(rocblas_strsm(handle,
+                                rocblas_side_left,
+                                rocblas_fill_upper,
+                                rocblas_operation_none,
+                                rocblas_diagonal_unit,
+                                M,
+                                N,
+                                &alpha,
+                                dA,
+                                lda,
+                                dB,
+                                ldb),
+                  rocblas_status_success);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hB_copy, dB, sizeof(float) * ldb * N, hipMemcpyDeviceToHost));
+    EXPECT_EQ(hB, hB_copy);
+
+    EXPECT_EQ(rocblas_get_device_memory_size(handle_1, &size_1), rocblas_status_success);
+    EXPECT_EQ(rocblas_get_device_memory_size(handle_2, &size_2), rocblas_status_success);
+    EXPECT_GT(size_1, 0u);
+    EXPECT_EQ(size_1, size_2);
+}
+
+#endif
@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm with 64-bit sizes, leading dimensions and strides:
+=================================================================== */
+
+namespace {
+
+// reference for column j of an m x n product over small integers, which is exact
+void reference_column(rocblas_operation transA,
+                      rocblas_operation transB,
+                      int64_t m,
+                      int64_t k,
+                      float alpha,
+                      const float* A,
+                      int64_t lda,
+                      const float* B,
+                      int64_t ldb,
+                      float beta,
+                      float* C,
+                      int64_t j)
+{
+    for(int64_t i = 0; i < m; i++)
+    {
+        float sum = 0;
+        for(int64_t l = 0; l < k; l++)
+        {
+            float a = transA == rocblas_operation_none ? A[i + lda * l] : A[l + lda * i];
+            float b = transB == rocblas_operation_none ? B[l + ldb * j] : B[j + ldb * l];
+            sum += a * b;
+        }
+        C[i] = alpha * sum + (beta != 0 ? beta * C[i] : 0);
+    }
+}
+
+} // namespace
+
+TEST(quick_blas_ex_64, within_32_bit_range)
+{
+    // runs as rocblas_gemm_strided_batched_ex
+    const int64_t M = 21, N = 13, K = 17, batch_count = 3;
+    const int64_t lda = K + 2, ldb = N + 1, ldc = M + 3;
+    const int64_t stride_a = lda * M + 1, stride_b = ldb * K, stride_c = ldc * N + 4;
+    float alpha = 2, beta = -1;
+
+    host_vector<float> hA(stride_a * batch_count), hB(stride_b * batch_count);
+    host_vector<float> hC(stride_c * batch_count), hRef(hC.size());
+    device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size());
+    ASSERT_TRUE(dA && dB && dC);
+
+    rocblas_seedrand();
+    for(auto* X : {&hA, &hB, &hC})
+        for(auto& x : *X)
+            x = random_generator<int>() % 7 - 3;
+    hRef = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_sgemm_strided_batched_64(handle,
+                                               rocblas_operation_transpose,
+                                               rocblas_operation_transpose,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               lda,
+                                               stride_a,
+                                               dB,
+                                               ldb,
+                                               stride_b,
+                                               &beta,
+                                               dC,
+                                               ldc,
+                                               stride_c,
+                                               batch_count),
+              rocblas_status_success);
+
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+
+    for(int64_t batch = 0; batch < batch_count; batch++)
+    {
+        for(int64_t j = 0; j < N; j++)
+        {
+            float* ref = hRef + stride_c * batch + ldc * j;
+            reference_column(rocblas_operation_transpose,
+                             rocblas_operation_transpose,
+                             M,
+                             K,
+                             alpha,
+                             hA + stride_a * batch,
+                             lda,
+                             hB + stride_b * batch,
+                             ldb,
+                             beta,
+                             ref,
+                             j);
+            for(int64_t i = 0; i < M; i++)
+                ASSERT_EQ(hC[stride_c * batch + ldc * j + i], ref[i])
+                    << "at " << i << "," << j << "," << batch;
+        }
+    }
+}
+
+namespace {
+
+void check_columns_beyond_32_bit_offsets(rocblas_pointer_mode pointer_mode)
+{
+    // the last column of C starts past INT_MAX bytes, so n is split into
+    // chunks that run on side streams of the handle
+    const int64_t M = 7, N = 3, K = 5, lda = M, ldb = K;
+    const int64_t ldc  = int64_t(1) << 28;
+    const size_t size_c = size_t(ldc) * (N - 1) + M;
+
+    size_t free_memory, total_memory;
+    CHECK_HIP_ERROR(hipMemGetInfo(&free_memory, &total_memory));
+    if(free_memory < sizeof(float) * size_c + (size_t(256) << 20))
+    {
+        cout << "skipped: needs " << (sizeof(float) * size_c >> 20) << " MiB of device memory"
+             << endl;
+        return;
+    }
+
+    float alpha = 3, beta = 2;
+    host_vector<float> hA(lda * K), hB(ldb * N), hC(M * N), hRef(M * N);
+    device_vector<float> dA(hA.size()), dB(hB.size()), dC(size_c), d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dA && dB && dC && d_alpha && d_beta);
+
+    rocblas_seedrand();
+    for(auto* X : {&hA, &hB, &hC})
+        for(auto& x : *X)
+            x = random_generator<int>() % 7 - 3;
+    hRef = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    for(int64_t j = 0; j < N; j++)
+        CHECK_HIP_ERROR(hipMemcpy((float*)dC + ldc * j, hC + M * j, sizeof(float) * M,
+                                  hipMemcpyHostToDevice));
+
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+    bool device = pointer_mode == rocblas_pointer_mode_device;
+
+    auto gemm = [&] {
+        return rocblas_sgemm_64(handle,
+                                rocblas_operation_none,
+                                rocblas_operation_none,
+                                M,
+                                N,
+                                K,
+                                device ? d_alpha : &alpha,
+                                dA,
+                                lda,
+                                dB,
+                                ldb,
+                                device ? d_beta : &beta,
+                                dC,
+                                ldc);
+    };
+
+    // device pointer mode computes the product into scratch of the size of C
+    size_t size = 0;
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(gemm(), rocblas_status_success);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+    EXPECT_EQ(size, device ? sizeof(float) * M * N : 0);
+
+    ASSERT_EQ(gemm(), rocblas_status_success);
+
+    for(int64_t j = 0; j < N; j++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hC + M * j, (float*)dC + ldc * j, sizeof(float) * M,
+                                  hipMemcpyDeviceToHost));
+        reference_column(rocblas_operation_none,
+                         rocblas_operation_none,
+                         M,
+                         K,
+                         alpha,
+                         hA,
+                         lda,
+                         hB,
+                         ldb,
+                         beta,
+                         hRef + M * j,
+                         j);
+        for(int64_t i = 0; i < M; i++)
+            ASSERT_EQ(hC[M * j + i], hRef[M * j + i]) << "at " << i << "," << j;
+    }
+}
+
+} // namespace
+
+TEST(quick_blas_ex_64, columns_beyond_32_bit_offsets)
+{
+    check_columns_beyond_32_bit_offsets(rocblas_pointer_mode_host);
+}
+
+TEST(quick_blas_ex_64, columns_beyond_32_bit_offsets_device_pointer)
+{
+    check_columns_beyond_32_bit_offsets(rocblas_pointer_mode_device);
+}
+
+TEST(quick_blas_ex_64, invalid_arguments)
+{
+    float alpha = 1, beta = 0;
+    device_vector<float> d(16);
+    ASSERT_TRUE(d);
+
+    const int64_t big    = int64_t(numeric_limits<int32_t>::max()) + 1;
+    rocblas_datatype f32 = rocblas_datatype_f32_r;
+
+    rocblas_local_handle handle;
+
+    // a leading dimension beyond 32 bits with a negative size
+    EXPECT_EQ(rocblas_gemm_ex_64(handle, rocblas_operation_none, rocblas_operation_none,
+                                 -1, 4, 4, &alpha, d, f32, big, d, f32, 4, &beta, d, f32, big,
+                                 d, f32, big, f32, rocblas_gemm_algo_standard,
+                                 0, 0, nullptr, nullptr),
+              rocblas_status_invalid_size);
+
+    // m beyond its leading dimension
+    EXPECT_EQ(rocblas_gemm_ex_64(handle, rocblas_operation_none, rocblas_operation_none,
+                                 big, 4, 4, &alpha, d, f32, big, d, f32, 4, &beta, d, f32, 4,
+                                 d, f32, big, f32, rocblas_gemm_algo_standard,
+                                 0, 0, nullptr, nullptr),
+              rocblas_status_invalid_size);
+
+    EXPECT_EQ(rocblas_sgemm_strided_batched_64(handle, rocblas_operation_none,
+                                               rocblas_operation_none, 4, 4, 4, &alpha,
+                                               d, 4, 16, d, 4, 16, &beta, nullptr, big, 16, 1),
+              rocblas_status_invalid_pointer);
+
+    EXPECT_EQ(rocblas_sgemm_64(nullptr, rocblas_operation_none, rocblas_operation_none,
+                               4, 4, 4, &alpha, d, 4, d, 4, &beta, d, 4),
+              rocblas_status_invalid_handle);
+}
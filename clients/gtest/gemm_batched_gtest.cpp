@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     batched gemm over device arrays of matrix pointers:
+=================================================================== */
+
+namespace {
+
+// the matrices of a batch, placed in one device buffer at uneven offsets and
+// in reverse order, as a per-request cache would leave them
+template <typename T>
+struct scattered_batch
+{
+    rocblas_int ld, size, batch_count;
+    host_vector<T> h;
+    host_vector<size_t> offset;
+    device_vector<T> d;
+    device_vector<T*> d_ptr;
+
+    scattered_batch(rocblas_int ld, rocblas_int cols, rocblas_int batch_count)
+        : ld(ld),
+          size(ld * cols),
+          batch_count(batch_count),
+          h(size_t(ld * cols + 7) * batch_count),
+          offset(batch_count),
+          d(h.size()),
+          d_ptr(batch_count)
+    {
+        for(rocblas_int i = 0; i < batch_count; i++)
+            offset[i] = size_t(size + 7) * (batch_count - 1 - i) + 3 * i;
+    }
+
+    // copy h to the device and the matrix pointers into d_ptr
+    void upload()
+    {
+        host_vector<T*> h_ptr(batch_count);
+        for(rocblas_int i = 0; i < batch_count; i++)
+            h_ptr[i] = (T*)d + offset[i];
+
+        CHECK_HIP_ERROR(hipMemcpy(d, h, sizeof(T) * h.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_ptr, h_ptr, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    }
+
+    void download()
+    {
+        CHECK_HIP_ERROR(hipMemcpy(h, d, sizeof(T) * h.size(), hipMemcpyDeviceToHost));
+    }
+
+    T& at(rocblas_int batch, rocblas_int i, rocblas_int j)
+    {
+        return h[offset[batch] + i + size_t(ld) * j];
+    }
+};
+
+template <typename T>
+void random_integers(host_vector<T>& X)
+{
+    for(auto& x : X)
+        x = random_generator<int>() % 7 - 3;
+}
+
+// Small integers keep every partial sum exact, so the result must match the
+// reference exactly.
+template <typename T>
+void check_gemm_batched(rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_pointer_mode pointer_mode,
+                        bool beta_zero)
+{
+    const rocblas_int M = 19, N = 23, K = 37, batch_count = 5;
+    const rocblas_int rows_a = transA == rocblas_operation_none ? M : K;
+    const rocblas_int cols_a = transA == rocblas_operation_none ? K : M;
+    const rocblas_int rows_b = transB == rocblas_operation_none ? K : N;
+    const rocblas_int cols_b = transB == rocblas_operation_none ? N : K;
+
+    T alpha = 2, beta = beta_zero ? 0 : -3;
+
+    scattered_batch<T> A(rows_a + 2, cols_a, batch_count), B(rows_b + 1, cols_b, batch_count);
+    scattered_batch<T> C(M + 3, N, batch_count);
+    device_vector<T> d_alpha(1), d_beta(1);
+    ASSERT_TRUE(A.d && A.d_ptr && B.d && B.d_ptr && C.d && C.d_ptr && d_alpha && d_beta);
+
+    rocblas_seedrand();
+    random_integers(A.h);
+    random_integers(B.h);
+    random_integers(C.h);
+
+    // beta = 0 must not read C
+    if(beta_zero)
+        for(auto& c : C.h)
+            c = numeric_limits<T>::quiet_NaN();
+
+    host_vector<T> hC = C.h;
+    A.upload();
+    B.upload();
+    C.upload();
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+
+    bool device = pointer_mode == rocblas_pointer_mode_device;
+    ASSERT_EQ(rocblas_gemm_batched<T>(handle,
+                                      transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      device ? (const T*)d_alpha : &alpha,
+                                      A.d_ptr,
+                                      A.ld,
+                                      B.d_ptr,
+                                      B.ld,
+                                      device ? (const T*)d_beta : &beta,
+                                      C.d_ptr,
+                                      C.ld,
+                                      batch_count),
+              rocblas_status_success);
+
+    C.download();
+
+    for(rocblas_int batch = 0; batch < batch_count; batch++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                T sum = 0;
+                for(rocblas_int l = 0; l < K; l++)
+                {
+                    T a = transA == rocblas_operation_none ? A.at(batch, i, l) : A.at(batch, l, i);
+                    T b = transB == rocblas_operation_none ? B.at(batch, l, j) : B.at(batch, j, l);
+                    sum += a * b;
+                }
+
+                size_t ic = C.offset[batch] + i + size_t(C.ld) * j;
+                T value   = alpha * sum + (beta_zero ? 0 : beta * hC[ic]);
+                ASSERT_EQ(C.h[ic], value) << "at " << i << "," << j << "," << batch;
+            }
+        }
+    }
+
+    // the padding between the matrices of C is left alone
+    for(rocblas_int batch = 0; batch < batch_count; batch++)
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = M; i < C.ld; i++)
+            {
+                size_t ic = C.offset[batch] + i + size_t(C.ld) * j;
+                if(beta_zero)
+                    ASSERT_TRUE(C.h[ic] != C.h[ic]);
+                else
+                    ASSERT_EQ(C.h[ic], hC[ic]);
+            }
+}
+
+template <typename T>
+void check_gemm_batched_all(rocblas_pointer_mode pointer_mode)
+{
+    const rocblas_operation ops[] = {rocblas_operation_none, rocblas_operation_transpose};
+    for(rocblas_operation transA : ops)
+        for(rocblas_operation transB : ops)
+        {
+            SCOPED_TRACE(testing::Message() << "transA " << transA << " transB " << transB);
+            check_gemm_batched<T>(transA, transB, pointer_mode, false);
+        }
+    check_gemm_batched<T>(rocblas_operation_none, rocblas_operation_none, pointer_mode, true);
+}
+
+} // namespace
+
+TEST(quick_blas3_gemm_batched, sgemm_batched)
+{
+    check_gemm_batched_all<float>(rocblas_pointer_mode_host);
+}
+
+TEST(quick_blas3_gemm_batched, dgemm_batched_device_pointer)
+{
+    check_gemm_batched_all<double>(rocblas_pointer_mode_device);
+}
+
+TEST(quick_blas3_gemm_batched, gemm_batched_ex_matches_sgemm_batched)
+{
+    const rocblas_int M = 33, N = 17, K = 9, batch_count = 4;
+    float alpha = 1.5f, beta = 0.5f;
+
+    scattered_batch<float> A(M, K, batch_count), B(K, N, batch_count);
+    scattered_batch<float> C(M, N, batch_count), D(M + 1, N, batch_count);
+    ASSERT_TRUE(A.d && A.d_ptr && B.d && B.d_ptr && C.d && C.d_ptr && D.d && D.d_ptr);
+
+    rocblas_seedrand();
+    random_integers(A.h);
+    random_integers(B.h);
+    random_integers(C.h);
+    A.upload();
+    B.upload();
+    C.upload();
+    D.upload();
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_gemm_batched_ex(handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      M,
+                                      N,
+                                      K,
+                                      &alpha,
+                                      A.d_ptr,
+                                      rocblas_datatype_f32_r,
+                                      A.ld,
+                                      B.d_ptr,
+                                      rocblas_datatype_f32_r,
+                                      B.ld,
+                                      &beta,
+                                      C.d_ptr,
+                                      rocblas_datatype_f32_r,
+                                      C.ld,
+                                      D.d_ptr,
+                                      rocblas_datatype_f32_r,
+                                      D.ld,
+                                      batch_count,
+                                      rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      nullptr),
+              rocblas_status_success);
+    D.download();
+
+    ASSERT_EQ(rocblas_gemm_batched<float>(handle,
+                                          rocblas_operation_none,
+                                          rocblas_operation_none,
+                                          M,
+                                          N,
+                                          K,
+                                          &alpha,
+                                          A.d_ptr,
+                                          A.ld,
+                                          B.d_ptr,
+                                          B.ld,
+                                          &beta,
+                                          C.d_ptr,
+                                          C.ld,
+                                          batch_count),
+              rocblas_status_success);
+    C.download();
+
+    for(rocblas_int batch = 0; batch < batch_count; batch++)
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                ASSERT_EQ(D.at(batch, i, j), C.at(batch, i, j)) << "at " << i << "," << j;
+}
+
+TEST(quick_blas3_gemm_batched, invalid_arguments)
+{
+    float alpha = 1, beta = 0;
+    device_vector<float*> d_ptr(1);
+    ASSERT_TRUE(d_ptr);
+
+    rocblas_local_handle handle;
+    EXPECT_EQ(rocblas_gemm_batched<float>(
+                  handle, rocblas_operation_none, rocblas_operation_none, 4, 4, 4, &alpha,
+                  nullptr, 4, d_ptr, 4, &beta, d_ptr, 4, 1),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_gemm_batched<float>(
+                  handle, rocblas_operation_none, rocblas_operation_none, 4, 4, 4, &alpha,
+                  d_ptr, 3, d_ptr, 4, &beta, d_ptr, 4, 1),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_gemm_batched<float>(
+                  handle, rocblas_operation_none, rocblas_operation_none, 4, 4, 4, &alpha,
+                  d_ptr, 4, d_ptr, 4, &beta, d_ptr, 4, -1),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_gemm_batched<float>(
+                  handle, rocblas_operation_none, rocblas_operation_none, 4, 4, 4, &alpha,
+                  nullptr, 4, nullptr, 4, &beta, nullptr, 4, 0),
+              rocblas_status_success);
+}
@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "cblas_interface.h"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm_ex and gemm_strided_batched_ex with bfloat16 inputs:
+=================================================================== */
+
+namespace {
+
+float to_float(float x) { return x; }
+float to_float(rocblas_bfloat16 x) { return bfloat16_to_float(x); }
+
+template <typename T>
+T from_float(float x);
+
+template <>
+float from_float<float>(float x)
+{
+    return x;
+}
+
+template <>
+rocblas_bfloat16 from_float<rocblas_bfloat16>(float x)
+{
+    return float_to_bfloat16(x);
+}
+
+// To is the type of C and D. With integer data every sum is exact, so a float
+// D must match the reference exactly; a bfloat16 D may differ from it by the
+// rounding of the last bit.
+template <typename To>
+void check_gemm_bf16(rocblas_operation transA,
+                     rocblas_operation transB,
+                     rocblas_int batch_count,
+                     rocblas_pointer_mode pointer_mode,
+                     bool integers,
+                     bool beta_zero)
+{
+    const rocblas_int M = 45, N = 31, K = 67;
+    const rocblas_int rows_a = transA == rocblas_operation_none ? M : K;
+    const rocblas_int cols_a = transA == rocblas_operation_none ? K : M;
+    const rocblas_int rows_b = transB == rocblas_operation_none ? K : N;
+    const rocblas_int cols_b = transB == rocblas_operation_none ? N : K;
+    const rocblas_int lda = rows_a + 1, ldb = rows_b + 2, ldc = M + 3, ldd = M;
+    const rocblas_int stride_a = lda * cols_a + 5, stride_b = ldb * cols_b;
+    const rocblas_int stride_c = ldc * N + 1, stride_d = ldd * N + 7;
+
+    float alpha = 2, beta = beta_zero ? 0 : -1;
+
+    host_vector<rocblas_bfloat16> hA(size_t(stride_a) * batch_count);
+    host_vector<rocblas_bfloat16> hB(size_t(stride_b) * batch_count);
+    host_vector<To> hC(size_t(stride_c) * batch_count), hD(size_t(stride_d) * batch_count);
+    device_vector<rocblas_bfloat16> dA(hA.size()), dB(hB.size());
+    device_vector<To> dC(hC.size()), dD(hD.size());
+    device_vector<float> d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dA && dB && dC && dD && d_alpha && d_beta);
+
+    rocblas_seedrand();
+    uniform_real_distribution<float> real(-1, 1);
+    for(auto& x : hA)
+        x = float_to_bfloat16(integers ? random_generator<int>() % 7 - 3 : real(rocblas_rng));
+    for(auto& x : hB)
+        x = float_to_bfloat16(integers ? random_generator<int>() % 7 - 3 : real(rocblas_rng));
+    for(auto& x : hC)
+        x = from_float<To>(beta_zero ? numeric_limits<float>::quiet_NaN()
+                                     : random_generator<int>() % 7 - 3);
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA, sizeof(rocblas_bfloat16) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB, hB, sizeof(rocblas_bfloat16) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(To) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+
+    bool device           = pointer_mode == rocblas_pointer_mode_device;
+    const float* p_alpha  = device ? (const float*)d_alpha : &alpha;
+    const float* p_beta   = device ? (const float*)d_beta : &beta;
+    rocblas_datatype bf16 = rocblas_datatype_bf16_r;
+    rocblas_datatype out  = rocblas_datatype_of<To>();
+
+    if(batch_count == 1)
+    {
+        ASSERT_EQ(rocblas_gemm_ex(handle, transA, transB, M, N, K, p_alpha,
+                                  dA, bf16, lda, dB, bf16, ldb, p_beta,
+                                  dC, out, ldc, dD, out, ldd,
+                                  rocblas_datatype_f32_r, rocblas_gemm_algo_standard,
+                                  0, 0, nullptr, nullptr),
+                  rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(rocblas_gemm_strided_batched_ex(handle, transA, transB, M, N, K, p_alpha,
+                                                  dA, bf16, lda, stride_a,
+                                                  dB, bf16, ldb, stride_b, p_beta,
+                                                  dC, out, ldc, stride_c,
+                                                  dD, out, ldd, stride_d,
+                                                  batch_count, rocblas_datatype_f32_r,
+                                                  rocblas_gemm_algo_standard,
+                                                  0, 0, nullptr, nullptr),
+                  rocblas_status_success);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(To) * hD.size(), hipMemcpyDeviceToHost));
+
+    for(rocblas_int batch = 0; batch < batch_count; batch++)
+    {
+        // the reference computes in float from the same bfloat16 inputs
+        host_vector<float> ref(size_t(ldc) * N);
+        for(size_t i = 0; i < ref.size(); i++)
+            ref[i] = beta_zero ? 0 : to_float(hC[stride_c * batch + i]);
+
+        cblas_gemm<rocblas_bfloat16, float>(transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            alpha,
+                                            hA + stride_a * batch,
+                                            lda,
+                                            hB + stride_b * batch,
+                                            ldb,
+                                            beta,
+                                            ref,
+                                            ldc);
+
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                float expect = ref[i + size_t(ldc) * j];
+                float result = to_float(hD[stride_d * batch + i + size_t(ldd) * j]);
+
+                if(integers && is_same<To, float>{})
+                    ASSERT_EQ(result, expect) << "at " << i << "," << j << "," << batch;
+                else
+                    ASSERT_NEAR(result, expect, 1e-2f * (fabsf(expect) + 1e-2f))
+                        << "at " << i << "," << j << "," << batch;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(quick_blas_ex_bf16, bf16_in_f32_out)
+{
+    const rocblas_operation ops[] = {rocblas_operation_none, rocblas_operation_transpose};
+    for(rocblas_operation transA : ops)
+        for(rocblas_operation transB : ops)
+        {
+            SCOPED_TRACE(testing::Message() << "transA " << transA << " transB " << transB);
+            check_gemm_bf16<float>(transA, transB, 1, rocblas_pointer_mode_host, true, false);
+        }
+    check_gemm_bf16<float>(
+        rocblas_operation_none, rocblas_operation_none, 1, rocblas_pointer_mode_host, true, true);
+}
+
+TEST(quick_blas_ex_bf16, bf16_in_bf16_out)
+{
+    check_gemm_bf16<rocblas_bfloat16>(rocblas_operation_none,
+                                      rocblas_operation_transpose,
+                                      1,
+                                      rocblas_pointer_mode_host,
+                                      false,
+                                      false);
+    check_gemm_bf16<rocblas_bfloat16>(rocblas_operation_transpose,
+                                      rocblas_operation_none,
+                                      1,
+                                      rocblas_pointer_mode_device,
+                                      false,
+                                      true);
+}
+
+TEST(quick_blas_ex_bf16, strided_batched)
+{
+    check_gemm_bf16<float>(rocblas_operation_transpose,
+                           rocblas_operation_transpose,
+                           3,
+                           rocblas_pointer_mode_device,
+                           true,
+                           false);
+    check_gemm_bf16<rocblas_bfloat16>(rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      4,
+                                      rocblas_pointer_mode_host,
+                                      false,
+                                      false);
+}
+
+TEST(quick_blas_ex_bf16, rounding)
+{
+    // round to nearest, ties to even
+    EXPECT_EQ(float_to_bfloat16(1.0f).data, 0x3f80);
+    EXPECT_EQ(float_to_bfloat16(1.00390625f).data, 0x3f80); // tie, down to even
+    EXPECT_EQ(float_to_bfloat16(1.01171875f).data, 0x3f82); // tie, up to even
+    EXPECT_EQ(float_to_bfloat16(-2.0f).data, 0xc000);
+    EXPECT_TRUE(bfloat16_to_float(float_to_bfloat16(numeric_limits<float>::quiet_NaN())) !=
+                bfloat16_to_float(float_to_bfloat16(numeric_limits<float>::quiet_NaN())));
+    EXPECT_EQ(bfloat16_to_float(float_to_bfloat16(3.5f)), 3.5f);
+}
@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <complex>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     complex gemm, formed from real products in 4M or 3M mode:
+=================================================================== */
+
+namespace {
+
+rocblas_status complex_gemm(rocblas_handle handle,
+                            rocblas_operation transA,
+                            rocblas_operation transB,
+                            rocblas_int M,
+                            rocblas_int N,
+                            rocblas_int K,
+                            const rocblas_float_complex* alpha,
+                            const rocblas_float_complex* A,
+                            rocblas_int lda,
+                            rocblas_int stride_a,
+                            const rocblas_float_complex* B,
+                            rocblas_int ldb,
+                            rocblas_int stride_b,
+                            const rocblas_float_complex* beta,
+                            rocblas_float_complex* C,
+                            rocblas_int ldc,
+                            rocblas_int stride_c,
+                            rocblas_int batch_count)
+{
+    return rocblas_cgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         stride_a,
+                                         B,
+                                         ldb,
+                                         stride_b,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         stride_c,
+                                         batch_count);
+}
+
+rocblas_status complex_gemm(rocblas_handle handle,
+                            rocblas_operation transA,
+                            rocblas_operation transB,
+                            rocblas_int M,
+                            rocblas_int N,
+                            rocblas_int K,
+                            const rocblas_double_complex* alpha,
+                            const rocblas_double_complex* A,
+                            rocblas_int lda,
+                            rocblas_int stride_a,
+                            const rocblas_double_complex* B,
+                            rocblas_int ldb,
+                            rocblas_int stride_b,
+                            const rocblas_double_complex* beta,
+                            rocblas_double_complex* C,
+                            rocblas_int ldc,
+                            rocblas_int stride_c,
+                            rocblas_int batch_count)
+{
+    return rocblas_zgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         stride_a,
+                                         B,
+                                         ldb,
+                                         stride_b,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         stride_c,
+                                         batch_count);
+}
+
+// element (i, j) of op(X), with X stored column major
+template <typename T>
+complex<double> op_element(const host_vector<T>& X,
+                           rocblas_operation trans,
+                           rocblas_int ld,
+                           size_t offset,
+                           rocblas_int i,
+                           rocblas_int j)
+{
+    const T& x = trans == rocblas_operation_none ? X[offset + i + size_t(ld) * j]
+                                                 : X[offset + j + size_t(ld) * i];
+    return complex<double>(x.x, trans == rocblas_operation_conjugate_transpose ? -x.y : x.y);
+}
+
+// Small integers in A, B, C, alpha and beta keep every partial sum exact in
+// float, so 4M and 3M must both match the reference exactly.
+template <typename T>
+void check_complex_gemm(rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_complex_gemm_mode mode,
+                        rocblas_pointer_mode pointer_mode,
+                        bool beta_zero)
+{
+    const rocblas_int M = 19, N = 23, K = 37, batch_count = 3;
+    const rocblas_int lda      = (transA == rocblas_operation_none ? M : K) + 2;
+    const rocblas_int ldb      = (transB == rocblas_operation_none ? K : N) + 1;
+    const rocblas_int ldc      = M + 3;
+    const rocblas_int stride_a = lda * (transA == rocblas_operation_none ? K : M);
+    const rocblas_int stride_b = ldb * (transB == rocblas_operation_none ? N : K);
+    const rocblas_int stride_c = ldc * N;
+
+    T alpha, beta;
+    alpha.x = 2;
+    alpha.y = -1;
+    beta.x  = beta_zero ? 0 : 3;
+    beta.y  = beta_zero ? 0 : 1;
+
+    host_vector<T> hA(size_t(stride_a) * batch_count), hB(size_t(stride_b) * batch_count);
+    host_vector<T> hC(size_t(stride_c) * batch_count);
+    rocblas_seedrand();
+    for(auto& a : hA)
+    {
+        a.x = random_generator<int>() % 7 - 3;
+        a.y = random_generator<int>() % 7 - 3;
+    }
+    for(auto& b : hB)
+    {
+        b.x = random_generator<int>() % 7 - 3;
+        b.y = random_generator<int>() % 7 - 3;
+    }
+    for(auto& c : hC)
+    {
+        c.x = random_generator<int>() % 7 - 3;
+        c.y = random_generator<int>() % 7 - 3;
+
+        // beta = 0 must not read C
+        if(beta_zero)
+            c.x = c.y = numeric_limits<decltype(c.x)>::quiet_NaN();
+    }
+
+    device_vector<T> dA(hA.size()), dB(hB.size()), dC(hC.size()), d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dA && dB && dC && d_alpha && d_beta);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_set_complex_gemm_mode(handle, mode), rocblas_status_success);
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+
+    bool device = pointer_mode == rocblas_pointer_mode_device;
+    ASSERT_EQ(complex_gemm(handle,
+                           transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           device ? (const T*)d_alpha : &alpha,
+                           dA,
+                           lda,
+                           stride_a,
+                           dB,
+                           ldb,
+                           stride_b,
+                           device ? (const T*)d_beta : &beta,
+                           dC,
+                           ldc,
+                           stride_c,
+                           batch_count),
+              rocblas_status_success);
+
+    host_vector<T> result(hC.size());
+    CHECK_HIP_ERROR(hipMemcpy(result, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+
+    complex<double> a(alpha.x, alpha.y), b(beta.x, beta.y);
+    for(rocblas_int batch = 0; batch < batch_count; batch++)
+    {
+        for(rocblas_int j = 0; j < N; j++)
+        {
+            for(rocblas_int i = 0; i < M; i++)
+            {
+                complex<double> sum = 0;
+                for(rocblas_int l = 0; l < K; l++)
+                    sum += op_element(hA, transA, lda, size_t(stride_a) * batch, i, l) *
+                           op_element(hB, transB, ldb, size_t(stride_b) * batch, l, j);
+
+                size_t ic              = i + size_t(ldc) * j + size_t(stride_c) * batch;
+                complex<double> expect = a * sum;
+                if(!beta_zero)
+                    expect += b * complex<double>(hC[ic].x, hC[ic].y);
+
+                ASSERT_EQ(result[ic].x, expect.real()) << "at " << i << "," << j << "," << batch;
+                ASSERT_EQ(result[ic].y, expect.imag()) << "at " << i << "," << j << "," << batch;
+            }
+        }
+    }
+}
+
+template <typename T>
+void check_complex_gemm_all(rocblas_complex_gemm_mode mode, rocblas_pointer_mode pointer_mode)
+{
+    const rocblas_operation ops[] = {rocblas_operation_none,
+                                     rocblas_operation_transpose,
+                                     rocblas_operation_conjugate_transpose};
+    for(rocblas_operation transA : ops)
+        for(rocblas_operation transB : ops)
+        {
+            SCOPED_TRACE(testing::Message() << "transA " << transA << " transB " << transB);
+            check_complex_gemm<T>(transA, transB, mode, pointer_mode, false);
+        }
+    check_complex_gemm<T>(rocblas_operation_none, rocblas_operation_none, mode, pointer_mode, true);
+}
+
+} // namespace
+
+TEST(quick_blas3_complex_gemm, cgemm_4m)
+{
+    check_complex_gemm_all<rocblas_float_complex>(rocblas_complex_gemm_mode_4m,
+                                                  rocblas_pointer_mode_host);
+}
+
+TEST(quick_blas3_complex_gemm, cgemm_3m)
+{
+    check_complex_gemm_all<rocblas_float_complex>(rocblas_complex_gemm_mode_3m,
+                                                  rocblas_pointer_mode_host);
+}
+
+TEST(quick_blas3_complex_gemm, zgemm_4m_device_pointer)
+{
+    check_complex_gemm_all<rocblas_double_complex>(rocblas_complex_gemm_mode_4m,
+                                                   rocblas_pointer_mode_device);
+}
+
+TEST(quick_blas3_complex_gemm, zgemm_3m_device_pointer)
+{
+    check_complex_gemm_all<rocblas_double_complex>(rocblas_complex_gemm_mode_3m,
+                                                   rocblas_pointer_mode_device);
+}
+
+TEST(quick_blas3_complex_gemm, cgemm_matches_strided_batched)
+{
+    const rocblas_int N = 16;
+    rocblas_float_complex alpha, beta;
+    alpha.x = 1;
+    alpha.y = 0;
+    beta.x  = 0;
+    beta.y  = 0;
+
+    host_vector<rocblas_float_complex> hA(N * N), hC1(N * N), hC2(N * N);
+    for(rocblas_int i = 0; i < N * N; i++)
+    {
+        hA[i].x = i % 5;
+        hA[i].y = i % 3 - 1;
+    }
+
+    device_vector<rocblas_float_complex> dA(N * N), dC(N * N);
+    ASSERT_TRUE(dA && dC);
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA, sizeof(rocblas_float_complex) * N * N, hipMemcpyHostToDevice));
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_cgemm(handle,
+                            rocblas_operation_none,
+                            rocblas_operation_conjugate_transpose,
+                            N,
+                            N,
+                            N,
+                            &alpha,
+                            dA,
+                            N,
+                            dA,
+                            N,
+                            &beta,
+                            dC,
+                            N),
+              rocblas_status_success);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hC1, dC, sizeof(rocblas_float_complex) * N * N, hipMemcpyDeviceToHost));
+
+    ASSERT_EQ(rocblas_cgemm_strided_batched(handle,
+                                            rocblas_operation_none,
+                                            rocblas_operation_conjugate_transpose,
+                                            N,
+                                            N,
+                                            N,
+                                            &alpha,
+                                            dA,
+                                            N,
+                                            N * N,
+                                            dA,
+                                            N,
+                                            N * N,
+                                            &beta,
+                                            dC,
+                                            N,
+                                            N * N,
+                                            1),
+              rocblas_status_success);
+    CHECK_HIP_ERROR(
+        hipMemcpy(hC2, dC, sizeof(rocblas_float_complex) * N * N, hipMemcpyDeviceToHost));
+
+    for(rocblas_int i = 0; i < N * N; i++)
+    {
+        EXPECT_EQ(hC1[i].x, hC2[i].x);
+        EXPECT_EQ(hC1[i].y, hC2[i].y);
+    }
+}
+
+TEST(quick_auxilliary, set_complex_gemm_mode_get_complex_gemm_mode)
+{
+    rocblas_complex_gemm_mode mode = rocblas_complex_gemm_mode_3m;
+    rocblas_local_handle handle;
+
+    EXPECT_EQ(rocblas_get_complex_gemm_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(rocblas_complex_gemm_mode_4m, mode);
+
+    EXPECT_EQ(rocblas_set_complex_gemm_mode(handle, rocblas_complex_gemm_mode_3m),
+              rocblas_status_success);
+    EXPECT_EQ(rocblas_get_complex_gemm_mode(handle, &mode), rocblas_status_success);
+    EXPECT_EQ(rocblas_complex_gemm_mode_3m, mode);
+
+    EXPECT_EQ(rocblas_set_complex_gemm_mode(nullptr, rocblas_complex_gemm_mode_4m),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_get_complex_gemm_mode(handle, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_set_complex_gemm_mode(handle, rocblas_complex_gemm_mode(7)),
+              rocblas_status_not_implemented);
+}
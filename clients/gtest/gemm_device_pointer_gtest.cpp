@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <limits>
+#include <mutex>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm with alpha and beta in device memory does not wait for the stream:
+=================================================================== */
+
+namespace {
+
+// Holds a stream in a host callback until it is released. Work queued behind
+// the gate does not start, so a call that copies alpha or beta to the host
+// (or otherwise waits for the stream) cannot return while the gate is closed.
+struct stream_gate
+{
+    mutex m;
+    condition_variable cv;
+    bool open = false;
+
+    void release()
+    {
+        lock_guard<mutex> lock(m);
+        open = true;
+        cv.notify_all();
+    }
+};
+
+void hold_stream(hipStream_t, hipError_t, void* data)
+{
+    stream_gate* gate = static_cast<stream_gate*>(data);
+    unique_lock<mutex> lock(gate->m);
+    gate->cv.wait(lock, [gate] { return gate->open; });
+}
+
+class gemm_device_pointer : public ::testing::Test
+{
+    protected:
+    static const rocblas_int N = 64;
+
+    rocblas_local_handle handle;
+    hipStream_t stream = nullptr;
+    host_vector<float> hA, hC;
+    device_vector<float> dA, dC, d_alpha, d_beta;
+
+    gemm_device_pointer()
+        : hA(N * N, 1.0f), hC(N * N, 1.0f), dA(N * N), dC(N * N), d_alpha(1), d_beta(1)
+    {
+    }
+
+    void SetUp() override
+    {
+        ASSERT_TRUE(dA && dC && d_alpha && d_beta);
+
+        float alpha = 2.0f, beta = 3.0f;
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * N * N, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+        ASSERT_EQ(rocblas_set_stream(handle, stream), rocblas_status_success);
+        ASSERT_EQ(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device),
+                  rocblas_status_success);
+    }
+
+    void TearDown() override
+    {
+        rocblas_set_stream(handle, 0);
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    }
+
+    // reserve the scratch the call reports, so that growing it does not
+    // allocate device memory inside the gated call
+    template <typename F>
+    void reserve(F gemm)
+    {
+        size_t size = 0;
+        EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+        EXPECT_EQ(gemm(), rocblas_status_success);
+        EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+        EXPECT_GE(size, sizeof(float) * N * N);
+        EXPECT_EQ(rocblas_set_device_memory_size(handle, size), rocblas_status_success);
+    }
+
+    template <typename F>
+    void expect_no_stream_wait(F gemm)
+    {
+        reserve(gemm);
+
+        stream_gate gate;
+        CHECK_HIP_ERROR(hipStreamAddCallback(stream, hold_stream, &gate, 0));
+
+        auto call     = async(launch::async, gemm);
+        bool returned = call.wait_for(chrono::seconds(10)) == future_status::ready;
+        gate.release();
+
+        EXPECT_TRUE(returned) << "gemm waited for work queued before it on the stream";
+        EXPECT_EQ(call.get(), rocblas_status_success);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // C = 2 * (A * B) + 3 * C with A, B and C all ones
+        host_vector<float> result(N * N);
+        CHECK_HIP_ERROR(hipMemcpy(result, dC, sizeof(float) * N * N, hipMemcpyDeviceToHost));
+        for(rocblas_int i = 0; i < N * N; i++)
+            ASSERT_EQ(result[i], 2.0f * N + 3.0f) << "at " << i;
+    }
+};
+
+} // namespace
+
+TEST_F(gemm_device_pointer, sgemm_does_not_wait)
+{
+    rocblas_handle h = handle;
+    float* A         = dA;
+    float* C         = dC;
+    float* alpha     = d_alpha;
+    float* beta      = d_beta;
+
+    expect_no_stream_wait([=] {
+        return rocblas_sgemm(h,
+                             rocblas_operation_none,
+                             rocblas_operation_transpose,
+                             N,
+                             N,
+                             N,
+                             alpha,
+                             A,
+                             N,
+                             A,
+                             N,
+                             beta,
+                             C,
+                             N);
+    });
+}
+
+TEST_F(gemm_device_pointer, gemm_ex_does_not_wait)
+{
+    rocblas_handle h = handle;
+    float* A         = dA;
+    float* C         = dC;
+    float* alpha     = d_alpha;
+    float* beta      = d_beta;
+
+    expect_no_stream_wait([=] {
+        return rocblas_gemm_ex(h,
+                               rocblas_operation_none,
+                               rocblas_operation_none,
+                               N,
+                               N,
+                               N,
+                               alpha,
+                               A,
+                               rocblas_datatype_f32_r,
+                               N,
+                               A,
+                               rocblas_datatype_f32_r,
+                               N,
+                               beta,
+                               C,
+                               rocblas_datatype_f32_r,
+                               N,
+                               C,
+                               rocblas_datatype_f32_r,
+                               N,
+                               rocblas_datatype_f32_r,
+                               rocblas_gemm_algo_standard,
+                               0,
+                               0,
+                               nullptr,
+                               nullptr);
+    });
+}
+
+TEST_F(gemm_device_pointer, sgemm_strided_batched_does_not_wait)
+{
+    rocblas_handle h = handle;
+    float* A         = dA;
+    float* C         = dC;
+    float* alpha     = d_alpha;
+    float* beta      = d_beta;
+
+    // two batches of N/2 columns
+    expect_no_stream_wait([=] {
+        return rocblas_sgemm_strided_batched(h,
+                                             rocblas_operation_none,
+                                             rocblas_operation_none,
+                                             N,
+                                             N / 2,
+                                             N,
+                                             alpha,
+                                             A,
+                                             N,
+                                             0,
+                                             A,
+                                             N,
+                                             N * N / 2,
+                                             beta,
+                                             C,
+                                             N,
+                                             N * N / 2,
+                                             2);
+    });
+}
+
+TEST(gemm_device_pointer_chunks, sgemm_larger_than_scratch)
+{
+    // C alone is 64 MiB, twice the scratch of device pointer mode, so the
+    // product runs in chunks of columns
+    const rocblas_int M = 4096, N = 4096;
+    const size_t max_scratch = size_t(32) << 20;
+
+    rocblas_local_handle handle;
+    host_vector<float> hA(M, 1.0f), hC(size_t(M) * N, 1.0f);
+    device_vector<float> dA(M), dB(N), dC(size_t(M) * N), d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dA && dB && dC && d_alpha && d_beta);
+
+    float alpha = 2.0f, beta = 3.0f;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hA, sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * M * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device),
+              rocblas_status_success);
+
+    auto gemm = [&] {
+        return rocblas_sgemm(handle,
+                             rocblas_operation_none,
+                             rocblas_operation_none,
+                             M,
+                             N,
+                             1,
+                             d_alpha,
+                             dA,
+                             M,
+                             dB,
+                             1,
+                             d_beta,
+                             dC,
+                             M);
+    };
+
+    size_t size = 0;
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(gemm(), rocblas_status_success);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+    EXPECT_EQ(size, max_scratch);
+
+    ASSERT_EQ(gemm(), rocblas_status_success);
+
+    // C = 2 * (A * B) + 3 * C with A, B and C all ones
+    host_vector<float> result(size_t(M) * N);
+    CHECK_HIP_ERROR(hipMemcpy(result, dC, sizeof(float) * M * N, hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < result.size(); i++)
+        ASSERT_EQ(result[i], 5.0f) << "at " << i;
+}
+
+TEST(gemm_device_pointer_chunks, stale_nan_in_scratch)
+{
+    // the first gemm leaves NaN products in the scratch the second reuses
+    const rocblas_int N = 64;
+
+    rocblas_local_handle handle;
+    host_vector<float> hNaN(N * N, numeric_limits<float>::quiet_NaN()), hOne(N * N, 1.0f);
+    device_vector<float> dNaN(N * N), dOne(N * N), dC(N * N), d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dNaN && dOne && dC && d_alpha && d_beta);
+
+    float alpha = 2.0f, beta = 3.0f;
+    CHECK_HIP_ERROR(hipMemcpy(dNaN, hNaN, sizeof(float) * N * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dOne, hOne, sizeof(float) * N * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device),
+              rocblas_status_success);
+
+    auto gemm = [&](float* A) {
+        return rocblas_sgemm(handle,
+                             rocblas_operation_none,
+                             rocblas_operation_none,
+                             N,
+                             N,
+                             N,
+                             d_alpha,
+                             A,
+                             N,
+                             dOne,
+                             N,
+                             d_beta,
+                             dC,
+                             N);
+    };
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hOne, sizeof(float) * N * N, hipMemcpyHostToDevice));
+    ASSERT_EQ(gemm(dNaN), rocblas_status_success);
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hOne, sizeof(float) * N * N, hipMemcpyHostToDevice));
+    ASSERT_EQ(gemm(dOne), rocblas_status_success);
+
+    // C = 2 * (A * B) + 3 * C with A, B and C all ones
+    host_vector<float> result(N * N);
+    CHECK_HIP_ERROR(hipMemcpy(result, dC, sizeof(float) * N * N, hipMemcpyDeviceToHost));
+    for(rocblas_int i = 0; i < N * N; i++)
+        ASSERT_EQ(result[i], 2.0f * N + 3.0f) << "at " << i;
+}
@@ -0,0 +1,292 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm_ex with a fused bias, activation and aux output:
+=================================================================== */
+
+namespace {
+
+float activate(float x, rocblas_activation activation)
+{
+    if(activation == rocblas_activation_relu)
+        return x > 0 ? x : 0;
+    if(activation == rocblas_activation_gelu)
+        return 0.5f * x * (1 + tanhf(0.7978845608028654f * (x + 0.044715f * x * x * x)));
+    return x;
+}
+
+struct epilogue_case
+{
+    rocblas_operation trans_a, trans_b;
+    rocblas_int m, n, k;
+    rocblas_bias_mode bias_mode;
+    rocblas_activation activation;
+    bool aux;
+    bool half_d; // store D as f16
+    rocblas_pointer_mode pointer_mode;
+    bool beta_zero;
+};
+
+// Small integers keep the sum before the activation exact, so aux and the
+// ReLU output must match the reference exactly. GELU goes through tanh, and
+// an f16 D is rounded, so those are compared to a relative tolerance.
+void check_gemm_epilogue(const epilogue_case& p)
+{
+    const rocblas_int rows_a = p.trans_a == rocblas_operation_none ? p.m : p.k;
+    const rocblas_int cols_a = p.trans_a == rocblas_operation_none ? p.k : p.m;
+    const rocblas_int rows_b = p.trans_b == rocblas_operation_none ? p.k : p.n;
+    const rocblas_int cols_b = p.trans_b == rocblas_operation_none ? p.n : p.k;
+    const rocblas_int lda = rows_a + 1, ldb = rows_b + 2, ldc = p.m + 3, ldd = p.m + 1;
+    const rocblas_int ld_aux = p.m + 4;
+
+    float alpha = 2, beta = p.beta_zero ? 0 : -1;
+    rocblas_int bias_size = p.bias_mode == rocblas_bias_column ? p.n : p.m;
+
+    host_vector<float> hA(size_t(lda) * cols_a), hB(size_t(ldb) * cols_b);
+    host_vector<float> hC(size_t(ldc) * p.n), hBias(bias_size), hAux(size_t(ld_aux) * p.n);
+    host_vector<float> hD(size_t(ldd) * p.n);
+    host_vector<rocblas_half> hD_half(size_t(ldd) * p.n);
+
+    device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size()), dBias(hBias.size());
+    device_vector<float> dAux(hAux.size()), dD(hD.size()), d_alpha(1), d_beta(1);
+    device_vector<rocblas_half> dD_half(hD_half.size());
+    ASSERT_TRUE(dA && dB && dC && dBias && dAux && dD && d_alpha && d_beta && dD_half);
+
+    rocblas_seedrand();
+    for(auto* X : {&hA, &hB, &hC, &hBias})
+        for(auto& x : *X)
+            x = random_generator<int>() % 7 - 3;
+
+    // beta = 0 must not read C
+    if(p.beta_zero)
+        for(auto& c : hC)
+            c = numeric_limits<float>::quiet_NaN();
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dBias, hBias, sizeof(float) * hBias.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    rocblas_gemm_epilogue epilogue;
+    epilogue.bias_mode  = p.bias_mode;
+    epilogue.bias       = p.bias_mode == rocblas_bias_none ? nullptr : (const float*)dBias;
+    epilogue.activation = p.activation;
+    epilogue.aux        = p.aux ? (float*)dAux : nullptr;
+    epilogue.ld_aux     = ld_aux;
+
+    rocblas_local_handle handle;
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, p.pointer_mode), rocblas_status_success);
+
+    bool device          = p.pointer_mode == rocblas_pointer_mode_device;
+    rocblas_datatype f32 = rocblas_datatype_f32_r;
+    ASSERT_EQ(rocblas_gemm_ex_epilogue(handle,
+                                       p.trans_a,
+                                       p.trans_b,
+                                       p.m,
+                                       p.n,
+                                       p.k,
+                                       device ? (const float*)d_alpha : &alpha,
+                                       dA,
+                                       f32,
+                                       lda,
+                                       dB,
+                                       f32,
+                                       ldb,
+                                       device ? (const float*)d_beta : &beta,
+                                       dC,
+                                       f32,
+                                       ldc,
+                                       p.half_d ? (void*)dD_half : (void*)dD,
+                                       p.half_d ? rocblas_datatype_f16_r : f32,
+                                       ldd,
+                                       &epilogue,
+                                       f32,
+                                       rocblas_gemm_algo_standard,
+                                       0,
+                                       0,
+                                       nullptr,
+                                       nullptr),
+              rocblas_status_success);
+
+    if(p.half_d)
+        CHECK_HIP_ERROR(hipMemcpy(
+            hD_half, dD_half, sizeof(rocblas_half) * hD_half.size(), hipMemcpyDeviceToHost));
+    else
+        CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(float) * hD.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hAux, dAux, sizeof(float) * hAux.size(), hipMemcpyDeviceToHost));
+
+    bool exact = !p.half_d && p.activation != rocblas_activation_gelu;
+
+    for(rocblas_int j = 0; j < p.n; j++)
+    {
+        for(rocblas_int i = 0; i < p.m; i++)
+        {
+            float sum = 0;
+            for(rocblas_int l = 0; l < p.k; l++)
+            {
+                float a = p.trans_a == rocblas_operation_none ? hA[i + size_t(lda) * l]
+                                                              : hA[l + size_t(lda) * i];
+                float b = p.trans_b == rocblas_operation_none ? hB[l + size_t(ldb) * j]
+                                                              : hB[j + size_t(ldb) * l];
+                sum += a * b;
+            }
+
+            float value = alpha * sum + (p.beta_zero ? 0 : beta * hC[i + size_t(ldc) * j]);
+            if(p.bias_mode == rocblas_bias_row)
+                value += hBias[i];
+            else if(p.bias_mode == rocblas_bias_column)
+                value += hBias[j];
+
+            if(p.aux)
+                ASSERT_EQ(hAux[i + size_t(ld_aux) * j], value) << "aux at " << i << "," << j;
+
+            float expect = activate(value, p.activation);
+            float result = p.half_d ? half_to_float(hD_half[i + size_t(ldd) * j])
+                                    : hD[i + size_t(ldd) * j];
+            if(exact)
+                ASSERT_EQ(result, expect) << "at " << i << "," << j;
+            else
+                ASSERT_NEAR(result, expect, 1e-2f * (1 + fabsf(expect))) << "at " << i << "," << j;
+        }
+    }
+}
+
+} // namespace
+
+TEST(quick_blas3_gemm_epilogue, row_bias_relu_aux)
+{
+    check_gemm_epilogue({rocblas_operation_none,
+                         rocblas_operation_none,
+                         37,
+                         29,
+                         19,
+                         rocblas_bias_row,
+                         rocblas_activation_relu,
+                         true,
+                         false,
+                         rocblas_pointer_mode_host,
+                         false});
+    check_gemm_epilogue({rocblas_operation_transpose,
+                         rocblas_operation_transpose,
+                         16,
+                         33,
+                         8,
+                         rocblas_bias_row,
+                         rocblas_activation_relu,
+                         true,
+                         false,
+                         rocblas_pointer_mode_device,
+                         true});
+}
+
+TEST(quick_blas3_gemm_epilogue, column_bias_gelu_half_output)
+{
+    check_gemm_epilogue({rocblas_operation_none,
+                         rocblas_operation_transpose,
+                         24,
+                         40,
+                         11,
+                         rocblas_bias_column,
+                         rocblas_activation_gelu,
+                         true,
+                         true,
+                         rocblas_pointer_mode_host,
+                         false});
+    check_gemm_epilogue({rocblas_operation_transpose,
+                         rocblas_operation_none,
+                         24,
+                         40,
+                         11,
+                         rocblas_bias_none,
+                         rocblas_activation_none,
+                         false,
+                         true,
+                         rocblas_pointer_mode_device,
+                         false});
+}
+
+TEST(quick_blas3_gemm_epilogue, split_k)
+{
+    // a long k takes the split path of gemm_split_k.h; the epilogue sums the slices
+    check_gemm_epilogue({rocblas_operation_none,
+                         rocblas_operation_none,
+                         16,
+                         16,
+                         20011,
+                         rocblas_bias_column,
+                         rocblas_activation_relu,
+                         true,
+                         false,
+                         rocblas_pointer_mode_host,
+                         false});
+}
+
+TEST(quick_blas3_gemm_epilogue, zero_k)
+{
+    // D is still formed from C and the bias
+    check_gemm_epilogue({rocblas_operation_none,
+                         rocblas_operation_none,
+                         9,
+                         7,
+                         0,
+                         rocblas_bias_row,
+                         rocblas_activation_relu,
+                         true,
+                         false,
+                         rocblas_pointer_mode_host,
+                         false});
+}
+
+TEST(quick_blas3_gemm_epilogue, invalid_arguments)
+{
+    float alpha = 1, beta = 0;
+    device_vector<float> d(16);
+    ASSERT_TRUE(d);
+
+    rocblas_gemm_epilogue epilogue = {
+        rocblas_bias_row, nullptr, rocblas_activation_relu, nullptr, 0};
+    rocblas_datatype f32 = rocblas_datatype_f32_r;
+
+    rocblas_local_handle handle;
+    EXPECT_EQ(rocblas_gemm_ex_epilogue(handle, rocblas_operation_none, rocblas_operation_none,
+                                       4, 4, 4, &alpha, d, f32, 4, d, f32, 4, &beta, d, f32, 4,
+                                       d, f32, 4, &epilogue, f32, rocblas_gemm_algo_standard,
+                                       0, 0, nullptr, nullptr),
+              rocblas_status_invalid_pointer);
+
+    epilogue.bias = (const float*)d;
+    epilogue.aux  = (float*)d;
+    EXPECT_EQ(rocblas_gemm_ex_epilogue(handle, rocblas_operation_none, rocblas_operation_none,
+                                       4, 4, 4, &alpha, d, f32, 4, d, f32, 4, &beta, d, f32, 4,
+                                       d, f32, 4, &epilogue, f32, rocblas_gemm_algo_standard,
+                                       0, 0, nullptr, nullptr),
+              rocblas_status_invalid_size);
+
+    EXPECT_EQ(rocblas_gemm_ex_epilogue(handle, rocblas_operation_none, rocblas_operation_none,
+                                       4, 4, 4, &alpha, d, f32, 4, d, f32, 4, &beta, d, f32, 4,
+                                       d, f32, 4, nullptr, f32, rocblas_gemm_algo_standard,
+                                       0, 0, nullptr, nullptr),
+              rocblas_status_invalid_pointer);
+}
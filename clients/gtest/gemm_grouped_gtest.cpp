@@ -0,0 +1,312 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <limits>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     grouped gemm with different sizes per group:
+=================================================================== */
+
+namespace {
+
+// the matrices of one operand of every problem, in one device buffer with a
+// gap after each, and the device array of pointers to them
+template <typename T>
+struct grouped_operand
+{
+    host_vector<T> h;
+    vector<size_t> offset;
+    vector<rocblas_int> ld;
+    device_vector<T> d;
+    device_vector<T*> d_ptr;
+
+    grouped_operand(const vector<rocblas_int>& lds, const vector<rocblas_int>& cols)
+        : h(size(lds, cols)), ld(lds), d(h.size()), d_ptr(lds.size())
+    {
+        for(size_t i = 0, o = 0; i < lds.size(); o += size_t(lds[i]) * cols[i] + 5, i++)
+            offset.push_back(o);
+    }
+
+    static size_t size(const vector<rocblas_int>& lds, const vector<rocblas_int>& cols)
+    {
+        size_t s = 1;
+        for(size_t i = 0; i < lds.size(); i++)
+            s += size_t(lds[i]) * cols[i] + 5;
+        return s;
+    }
+
+    void upload()
+    {
+        host_vector<T*> h_ptr(offset.size());
+        for(size_t i = 0; i < offset.size(); i++)
+            h_ptr[i] = (T*)d + offset[i];
+
+        CHECK_HIP_ERROR(hipMemcpy(d, h, sizeof(T) * h.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_ptr, h_ptr, sizeof(T*) * offset.size(), hipMemcpyHostToDevice));
+    }
+
+    void download()
+    {
+        CHECK_HIP_ERROR(hipMemcpy(h, d, sizeof(T) * h.size(), hipMemcpyDeviceToHost));
+    }
+
+    T& at(size_t problem, rocblas_int i, rocblas_int j)
+    {
+        return h[offset[problem] + i + size_t(ld[problem]) * j];
+    }
+};
+
+struct group
+{
+    rocblas_operation trans_a, trans_b;
+    rocblas_int m, n, k, size;
+};
+
+// Small integers keep every partial sum exact, so the result must match the
+// reference exactly. Returns the number of Tensile launches the call made.
+template <typename T>
+size_t check_gemm_grouped(const vector<group>& groups, rocblas_pointer_mode pointer_mode)
+{
+    rocblas_int group_count = groups.size();
+    vector<rocblas_operation> trans_a, trans_b;
+    vector<rocblas_int> m, n, k, lda, ldb, ldc, ldd, group_size;
+    vector<T> alpha, beta;
+    vector<rocblas_int> ld_a, cols_a, ld_b, cols_b, ld_c, cols_c, ld_d;
+    vector<size_t> first;
+
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        const group& p = groups[g];
+        trans_a.push_back(p.trans_a);
+        trans_b.push_back(p.trans_b);
+        m.push_back(p.m);
+        n.push_back(p.n);
+        k.push_back(p.k);
+        lda.push_back((p.trans_a == rocblas_operation_none ? p.m : p.k) + 1);
+        ldb.push_back((p.trans_b == rocblas_operation_none ? p.k : p.n) + 2);
+        ldc.push_back(p.m + 3);
+        ldd.push_back(p.m + 1);
+        group_size.push_back(p.size);
+        alpha.push_back(g % 3 + 1);
+        beta.push_back(g % 2 ? 0 : -2);
+        first.push_back(ld_a.size());
+
+        for(rocblas_int i = 0; i < p.size; i++)
+        {
+            ld_a.push_back(max(lda[g], 1));
+            cols_a.push_back(p.trans_a == rocblas_operation_none ? p.k : p.m);
+            ld_b.push_back(max(ldb[g], 1));
+            cols_b.push_back(p.trans_b == rocblas_operation_none ? p.n : p.k);
+            ld_c.push_back(ldc[g]);
+            ld_d.push_back(ldd[g]);
+            cols_c.push_back(p.n);
+        }
+    }
+
+    grouped_operand<T> A(ld_a, cols_a), B(ld_b, cols_b), C(ld_c, cols_c), D(ld_d, cols_c);
+    device_vector<T> d_alpha(group_count), d_beta(group_count);
+    EXPECT_TRUE(A.d && A.d_ptr && B.d && B.d_ptr && C.d && C.d_ptr && D.d && D.d_ptr &&
+                d_alpha && d_beta);
+
+    rocblas_seedrand();
+    for(auto* X : {&A.h, &B.h, &C.h})
+        for(auto& x : *X)
+            x = random_generator<int>() % 7 - 3;
+
+    A.upload();
+    B.upload();
+    C.upload();
+    D.upload();
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_alpha, alpha.data(), sizeof(T) * group_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_beta, beta.data(), sizeof(T) * group_count, hipMemcpyHostToDevice));
+
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+    EXPECT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+
+    bool device = pointer_mode == rocblas_pointer_mode_device;
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle,
+                                      trans_a.data(),
+                                      trans_b.data(),
+                                      m.data(),
+                                      n.data(),
+                                      k.data(),
+                                      device ? (const T*)d_alpha : alpha.data(),
+                                      A.d_ptr,
+                                      rocblas_datatype_of<T>(),
+                                      lda.data(),
+                                      B.d_ptr,
+                                      rocblas_datatype_of<T>(),
+                                      ldb.data(),
+                                      device ? (const T*)d_beta : beta.data(),
+                                      C.d_ptr,
+                                      rocblas_datatype_of<T>(),
+                                      ldc.data(),
+                                      D.d_ptr,
+                                      rocblas_datatype_of<T>(),
+                                      ldd.data(),
+                                      group_count,
+                                      group_size.data(),
+                                      rocblas_datatype_of<T>(),
+                                      rocblas_gemm_algo_standard,
+                                      0,
+                                      0,
+                                      nullptr,
+                                      nullptr),
+              rocblas_status_success);
+
+    host_vector<T> hC = C.h;
+    C.download();
+    D.download();
+
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        SCOPED_TRACE(testing::Message() << "group " << g);
+        for(rocblas_int s = 0; s < group_size[g]; s++)
+        {
+            size_t problem = first[g] + s;
+            for(rocblas_int j = 0; j < n[g]; j++)
+            {
+                for(rocblas_int i = 0; i < m[g]; i++)
+                {
+                    T sum = 0;
+                    for(rocblas_int l = 0; l < k[g]; l++)
+                    {
+                        T a = trans_a[g] == rocblas_operation_none ? A.at(problem, i, l)
+                                                                   : A.at(problem, l, i);
+                        T b = trans_b[g] == rocblas_operation_none ? B.at(problem, l, j)
+                                                                   : B.at(problem, j, l);
+                        sum += a * b;
+                    }
+
+                    T expect = alpha[g] * sum + beta[g] * hC[C.offset[problem] + i + ldc[g] * j];
+                    EXPECT_EQ(D.at(problem, i, j), expect) << "at " << i << "," << j << "," << s;
+                }
+            }
+        }
+    }
+
+    // C is only read
+    for(size_t i = 0; i < hC.size(); i++)
+        EXPECT_EQ(C.h[i], hC[i]);
+
+    size_t count = 0, launches = 0;
+    EXPECT_EQ(rocblas_get_solution_selections(handle, nullptr, &count), rocblas_status_success);
+    vector<rocblas_solution_selection> selections(count);
+    EXPECT_EQ(rocblas_get_solution_selections(handle, selections.data(), &count),
+              rocblas_status_success);
+    for(const auto& selection : selections)
+        launches += selection.calls;
+    return launches;
+}
+
+} // namespace
+
+// expert layers: the same n and k, and an m per expert
+TEST(quick_blas3_gemm_grouped, sgemm_grouped_experts)
+{
+    const rocblas_operation N = rocblas_operation_none;
+    vector<group> groups = {{N, N, 60, 32, 48, 1},
+                            {N, N, 64, 32, 48, 2},
+                            {N, N, 56, 32, 48, 1},
+                            {N, N, 0, 32, 48, 3},
+                            {N, N, 40, 32, 48, 2}};
+
+    // close enough in m to run as one launch of m = 64
+    EXPECT_EQ(check_gemm_grouped<float>(groups, rocblas_pointer_mode_host), 1u);
+}
+
+TEST(quick_blas3_gemm_grouped, sgemm_grouped_mixed)
+{
+    const rocblas_operation N = rocblas_operation_none, T = rocblas_operation_transpose;
+    vector<group> groups = {{N, N, 60, 32, 48, 1},
+                            {N, N, 3, 32, 48, 1},
+                            {T, N, 17, 9, 23, 2},
+                            {N, T, 17, 9, 23, 1},
+                            {N, N, 12, 5, 0, 2},
+                            {T, T, 31, 19, 11, 3},
+                            {T, N, 19, 9, 23, 1}};
+
+    // m = 3 is too small to pad to 60; k = 0 only scales C
+    EXPECT_EQ(check_gemm_grouped<float>(groups, rocblas_pointer_mode_host), 5u);
+}
+
+TEST(quick_blas3_gemm_grouped, dgemm_grouped_device_pointer)
+{
+    const rocblas_operation N = rocblas_operation_none, T = rocblas_operation_transpose;
+    vector<group> groups = {{N, T, 33, 20, 16, 2}, {N, T, 30, 18, 16, 3}, {T, N, 8, 8, 8, 1}};
+
+    EXPECT_EQ(check_gemm_grouped<double>(groups, rocblas_pointer_mode_device), 2u);
+}
+
+TEST(quick_blas3_gemm_grouped, invalid_arguments)
+{
+    const rocblas_operation trans[] = {rocblas_operation_none};
+    const rocblas_int size[] = {4}, bad_ld[] = {3}, negative[] = {-1}, empty[] = {0};
+    float alpha[] = {1}, beta[] = {0};
+    device_vector<float*> d_ptr(1);
+    ASSERT_TRUE(d_ptr);
+
+    rocblas_local_handle handle;
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle, trans, trans, size, size, size, alpha,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, size, beta,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, bad_ld,
+                                      1, size, rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle, trans, trans, size, size, size, alpha,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, size, beta,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      1, negative, rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle, trans, trans, size, size, size, alpha,
+                                      nullptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, size, beta,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      d_ptr, rocblas_datatype_f32_r, size,
+                                      1, size, rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle, trans, trans, size, size, size, alpha,
+                                      nullptr, rocblas_datatype_f32_r, size,
+                                      nullptr, rocblas_datatype_f32_r, size, beta,
+                                      nullptr, rocblas_datatype_f32_r, size,
+                                      nullptr, rocblas_datatype_f32_r, size,
+                                      1, empty, rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+              rocblas_status_success);
+    EXPECT_EQ(rocblas_gemm_grouped_ex(handle, nullptr, nullptr, nullptr, nullptr, nullptr,
+                                      nullptr, nullptr, rocblas_datatype_f32_r, nullptr,
+                                      nullptr, rocblas_datatype_f32_r, nullptr, nullptr,
+                                      nullptr, rocblas_datatype_f32_r, nullptr,
+                                      nullptr, rocblas_datatype_f32_r, nullptr,
+                                      0, nullptr, rocblas_datatype_f32_r,
+                                      rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+              rocblas_status_success);
+}
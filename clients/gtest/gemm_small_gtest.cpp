@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     strided batched gemm of matrices small enough to bypass Tensile; the sizes
+     and transposes are swept by quick_blas3_gemm_small in
+     gemm_strided_batched_gtest.cpp:
+=================================================================== */
+
+namespace {
+
+// largest m, n and k run without Tensile
+const rocblas_int small_max = 32;
+
+// more matrices than one workgroup runs, and not a multiple of them
+const rocblas_int small_batch = 19;
+
+// runs sgemm NN of dim x dim x dim over batch matrices on handle
+void run_sgemm_batch(rocblas_handle handle, rocblas_int dim, rocblas_int batch)
+{
+    const rocblas_int ld = small_max + 1, stride = ld * ld;
+    float alpha = 1, beta = 0;
+    const size_t size = size_t(stride) * batch;
+    device_vector<float> dA(size), dB(size), dC(size);
+    ASSERT_TRUE(dA && dB && dC);
+
+    ASSERT_EQ(rocblas_gemm_strided_batched<float>(handle, rocblas_operation_none,
+                                                  rocblas_operation_none, dim, dim, dim,
+                                                  &alpha, dA, ld, stride, dB, ld, stride,
+                                                  &beta, dC, ld, stride, batch),
+              rocblas_status_success);
+}
+
+} // namespace
+
+TEST(quick_blas3_gemm_small, bypasses_tensile)
+{
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    for(rocblas_int dim : {small_max, small_max + 1})
+        run_sgemm_batch(handle, dim, small_batch);
+
+    EXPECT_EQ(logged_solution(handle, small_max, small_max, small_max),
+              "rocblas_gemm_small_MT32x32");
+    string tensile = logged_solution(handle, small_max + 1, small_max + 1, small_max + 1);
+    EXPECT_FALSE(tensile.empty());
+    EXPECT_EQ(tensile.find("rocblas_gemm_small"), string::npos);
+}
+
+TEST(quick_blas3_gemm_small, few_matrices_run_tensile)
+{
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    // fewer matrices than one workgroup of gemm_small runs
+    run_sgemm_batch(handle, small_max, 2);
+
+    string tensile = logged_solution(handle, small_max, small_max, small_max);
+    EXPECT_FALSE(tensile.empty());
+    EXPECT_EQ(tensile.find("rocblas_gemm_small"), string::npos);
+}
+
+TEST(quick_blas3_gemm_small, override_runs_tensile)
+{
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    size_t count = 0;
+    ASSERT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, small_max, small_max,
+                                            small_max, small_batch, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            nullptr, &count),
+              rocblas_status_success);
+    vector<rocblas_gemm_solution> solutions(count);
+    ASSERT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, small_max, small_max,
+                                            small_max, small_batch, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            solutions.data(), &count),
+              rocblas_status_success);
+    ASSERT_GT(count, 0u);
+
+    char path[] = "/tmp/rocblas_overrides_XXXXXX";
+    int fd      = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    ofstream(path) << "SB N N " << small_max << " " << small_max << " " << small_max << " "
+                   << small_batch << " " << solutions[0].solution_index << "\n";
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, path), rocblas_status_success);
+    unlink(path);
+
+    run_sgemm_batch(handle, small_max, small_batch);
+    EXPECT_EQ(logged_solution(handle, small_max, small_max, small_max), solutions[0].name);
+
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, nullptr), rocblas_status_success);
+}
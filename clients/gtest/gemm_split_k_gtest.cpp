@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <limits>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm with a small output and a long k, which splits k:
+=================================================================== */
+
+namespace {
+
+// k is not a multiple of any split count, so the last slice is exercised
+const rocblas_int split_m = 16, split_n = 20, split_k = 50021;
+
+enum split_api
+{
+    split_gemm,
+    split_gemm_ex,
+};
+
+// true if a Tensile launch of the handle ran chunks of k as a batch
+bool split_k_launched(rocblas_handle handle)
+{
+    size_t count = 0;
+    EXPECT_EQ(rocblas_get_solution_selections(handle, nullptr, &count), rocblas_status_success);
+    host_vector<rocblas_solution_selection> selections(count);
+    EXPECT_EQ(rocblas_get_solution_selections(handle, selections.data(), &count),
+              rocblas_status_success);
+
+    for(size_t i = 0; i < count; i++)
+        if(selections[i].size_k > 1 && selections[i].size_l < split_k)
+            return true;
+    return false;
+}
+
+// Small integers keep every partial sum exact, whatever the order the chunks
+// are summed in, so the result must match the reference exactly.
+template <typename T>
+void check_gemm_split_k(rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_pointer_mode pointer_mode,
+                        split_api api,
+                        bool beta_zero)
+{
+    const rocblas_int M = split_m, N = split_n, K = split_k;
+    const rocblas_int rows_a = transA == rocblas_operation_none ? M : K;
+    const rocblas_int cols_a = transA == rocblas_operation_none ? K : M;
+    const rocblas_int rows_b = transB == rocblas_operation_none ? K : N;
+    const rocblas_int cols_b = transB == rocblas_operation_none ? N : K;
+    const rocblas_int lda = rows_a + 1, ldb = rows_b + 3, ldc = M + 2, ldd = M + 5;
+
+    T alpha = 2, beta = beta_zero ? 0 : -3;
+
+    host_vector<T> hA(size_t(lda) * cols_a), hB(size_t(ldb) * cols_b);
+    host_vector<T> hC(size_t(ldc) * N), hD(size_t(ldd) * N);
+    device_vector<T> dA(hA.size()), dB(hB.size()), dC(hC.size()), dD(hD.size());
+    device_vector<T> d_alpha(1), d_beta(1);
+    ASSERT_TRUE(dA && dB && dC && dD && d_alpha && d_beta);
+
+    rocblas_seedrand();
+    for(auto* X : {&hA, &hB, &hC})
+        for(auto& x : *X)
+            x = random_generator<int>() % 7 - 3;
+
+    // beta = 0 must not read C
+    if(beta_zero)
+        for(auto& c : hC)
+            c = numeric_limits<T>::quiet_NaN();
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD, hD, sizeof(T) * hD.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+    ASSERT_EQ(rocblas_set_pointer_mode(handle, pointer_mode), rocblas_status_success);
+
+    bool device          = pointer_mode == rocblas_pointer_mode_device;
+    const T* p_alpha     = device ? (const T*)d_alpha : &alpha;
+    const T* p_beta      = device ? (const T*)d_beta : &beta;
+    rocblas_datatype f32 = rocblas_datatype_f32_r;
+
+    if(api == split_gemm)
+    {
+        ASSERT_EQ(rocblas_gemm<T>(
+                      handle, transA, transB, M, N, K, p_alpha, dA, lda, dB, ldb, p_beta, dC, ldc),
+                  rocblas_status_success);
+    }
+    else
+    {
+        ASSERT_EQ(rocblas_gemm_ex(handle, transA, transB, M, N, K, p_alpha,
+                                  dA, f32, lda, dB, f32, ldb, p_beta,
+                                  dC, f32, ldc, dD, f32, ldd,
+                                  f32, rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr),
+                  rocblas_status_success);
+    }
+
+    // which launches ran depends on the compute units of the device
+    hipDeviceProp_t props;
+    CHECK_HIP_ERROR(hipGetDeviceProperties(&props, 0));
+    if(props.multiProcessorCount > 2)
+        EXPECT_TRUE(split_k_launched(handle));
+
+    // gemm writes its result over C, gemm_ex into D
+    host_vector<T> result(api == split_gemm ? hC.size() : hD.size());
+    rocblas_int ld_result = api == split_gemm ? ldc : ldd;
+    CHECK_HIP_ERROR(hipMemcpy(result,
+                              api == split_gemm ? (T*)dC : (T*)dD,
+                              sizeof(T) * result.size(),
+                              hipMemcpyDeviceToHost));
+
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            T sum = 0;
+            for(rocblas_int l = 0; l < K; l++)
+            {
+                T a = transA == rocblas_operation_none ? hA[i + size_t(lda) * l]
+                                                       : hA[l + size_t(lda) * i];
+                T b = transB == rocblas_operation_none ? hB[l + size_t(ldb) * j]
+                                                       : hB[j + size_t(ldb) * l];
+                sum += a * b;
+            }
+
+            T value = alpha * sum + (beta_zero ? 0 : beta * hC[i + size_t(ldc) * j]);
+            ASSERT_EQ(result[i + size_t(ld_result) * j], value) << "at " << i << "," << j;
+        }
+    }
+}
+
+} // namespace
+
+TEST(quick_blas3_gemm_split_k, sgemm_split_k)
+{
+    const rocblas_operation ops[] = {rocblas_operation_none, rocblas_operation_transpose};
+    for(rocblas_operation transA : ops)
+        for(rocblas_operation transB : ops)
+        {
+            SCOPED_TRACE(testing::Message() << "transA " << transA << " transB " << transB);
+            check_gemm_split_k<float>(
+                transA, transB, rocblas_pointer_mode_host, split_gemm, false);
+        }
+}
+
+TEST(quick_blas3_gemm_split_k, dgemm_split_k_device_pointer)
+{
+    check_gemm_split_k<double>(rocblas_operation_transpose,
+                               rocblas_operation_none,
+                               rocblas_pointer_mode_device,
+                               split_gemm,
+                               false);
+    check_gemm_split_k<double>(rocblas_operation_none,
+                               rocblas_operation_none,
+                               rocblas_pointer_mode_device,
+                               split_gemm,
+                               true);
+}
+
+TEST(quick_blas3_gemm_split_k, gemm_ex_split_k)
+{
+    check_gemm_split_k<float>(rocblas_operation_none,
+                              rocblas_operation_transpose,
+                              rocblas_pointer_mode_host,
+                              split_gemm_ex,
+                              false);
+    check_gemm_split_k<float>(rocblas_operation_transpose,
+                              rocblas_operation_none,
+                              rocblas_pointer_mode_device,
+                              split_gemm_ex,
+                              true);
+}
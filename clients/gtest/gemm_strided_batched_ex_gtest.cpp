@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <math.h>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 #include "testing_gemm_strided_batched_ex.hpp"
@@ -427,3 +428,85 @@ INSTANTIATE_TEST_CASE_P(pre_checkin_blas3_large_stride_zero,
 // INSTANTIATE_TEST_CASE_P(nightly_blas3_deepbench_sizes,
 //                        gemm_strided_batched_ex,
 //                        ValuesIn(deepbench_sb_vec));
+
+// C is copied into D before Tensile runs in place on D; the copy must honour
+// the strides and padding of both, and with beta = 0 must not read C at all
+TEST(quick_blas_ex_copy_c, strided_c_to_d)
+{
+    const rocblas_int M = 37, N = 19, K = 5, batch_count = 3;
+    const rocblas_int ldc = M + 4, ldd = M + 1, stride_c = ldc * N + 9, stride_d = ldd * N + 2;
+
+    for(float beta : {2.0f, 0.0f})
+    {
+        SCOPED_TRACE(testing::Message() << "beta " << beta);
+        float alpha = 1;
+
+        host_vector<float> hA(M * K * batch_count), hB(K * N * batch_count);
+        host_vector<float> hC(stride_c * batch_count), hD(stride_d * batch_count);
+        device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size()), dD(hD.size());
+        ASSERT_TRUE(dA && dB && dC && dD);
+
+        rocblas_seedrand();
+        for(auto* X : {&hA, &hB, &hC})
+            for(auto& x : *X)
+                x = random_generator<int>() % 7 - 3;
+        if(beta == 0)
+            for(auto& c : hC)
+                c = numeric_limits<float>::quiet_NaN();
+        for(auto& x : hD)
+            x = numeric_limits<float>::quiet_NaN();
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dD, hD, sizeof(float) * hD.size(), hipMemcpyHostToDevice));
+
+        rocblas_local_handle handle;
+        rocblas_datatype f32 = rocblas_datatype_f32_r;
+        ASSERT_EQ(rocblas_gemm_strided_batched_ex(handle,
+                                                  rocblas_operation_none,
+                                                  rocblas_operation_none,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &alpha,
+                                                  dA,
+                                                  f32,
+                                                  M,
+                                                  M * K,
+                                                  dB,
+                                                  f32,
+                                                  K,
+                                                  K * N,
+                                                  &beta,
+                                                  dC,
+                                                  f32,
+                                                  ldc,
+                                                  stride_c,
+                                                  dD,
+                                                  f32,
+                                                  ldd,
+                                                  stride_d,
+                                                  batch_count,
+                                                  f32,
+                                                  rocblas_gemm_algo_standard,
+                                                  0,
+                                                  0,
+                                                  nullptr,
+                                                  nullptr),
+                  rocblas_status_success);
+        CHECK_HIP_ERROR(hipMemcpy(hD, dD, sizeof(float) * hD.size(), hipMemcpyDeviceToHost));
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+            for(rocblas_int j = 0; j < N; j++)
+                for(rocblas_int i = 0; i < M; i++)
+                {
+                    float sum = 0;
+                    for(rocblas_int l = 0; l < K; l++)
+                        sum += hA[i + M * l + M * K * b] * hB[l + K * j + K * N * b];
+                    float c = beta == 0 ? 0 : beta * hC[i + ldc * j + stride_c * b];
+                    ASSERT_EQ(hD[i + ldd * j + stride_d * b], alpha * sum + c)
+                        << "at " << i << "," << j << "," << b;
+                }
+    }
+}
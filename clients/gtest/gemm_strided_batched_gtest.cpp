@@ -72,6 +72,19 @@ const vector<vector<int>> small_matrix_size_stride_a_range = {
     {128, 128, 128, 128, 128, 128,     0, 16384,  16384},
     {129, 129, 129, 129, 129, 129, 16641,     0,  16641},
 };
+// m, n and k at the edges of the size classes gemm_small runs without Tensile,
+// up to 32, with leading dimensions and strides past the largest size
+const vector<vector<int>> gemm_small_matrix_size_range = {
+    {  1,   1,   1,  33,  33,  33,   1059,   1059,   1059},
+    {  7,   8,   9,  33,  33,  33,   1059,   1059,   1059},
+    {  8,  16,  17,  33,  33,  33,   1059,   1059,   1059},
+    {  9,  17,  31,  33,  33,  33,   1059,   1059,   1059},
+    { 16,  31,  32,  33,  33,  33,   1059,   1059,   1059},
+    { 17,  32,   7,  33,  33,  33,   1059,   1059,   1059},
+    { 31,   9,   8,  33,  33,  33,   1059,   1059,   1059},
+    { 32,  32,  32,  33,  33,  33,   1059,   1059,   1059},
+};
+
 const vector<vector<int>> medium_matrix_size_range = {
     {129, 130, 131, 132, 133, 134,  17554,  17554,  17554},
     {255, 255, 255, 255, 255, 255,  65025,  65025,  65025},
@@ -117,6 +130,8 @@ const vector<int> small_batch_count_range           = { -1,   0,  1, 3, };
 const vector<int> medium_batch_count_range          = { 63,  64, 65,    };
 const vector<int> small_batch_count_stride_a_range  = {  1,   3,        };
 const vector<int> medium_batch_count_stride_a_range = {  31, 32, 33,    };
+// more matrices than one gemm_small workgroup runs, and not a multiple of them
+const vector<int> gemm_small_batch_count_range       = { 19,             };
 
 // vector of vector, each vector is a {M, N, K, lda, ldb, ldc, stride_a, stride_b, stride_c};
 gemm_strided_batched_tuple db_sb_1{ {12544, 64, 64, 12544, 64, 12544, 802816, 0, 802816}, {1, 0}, {'N', 'N'}, 16};
@@ -829,6 +844,13 @@ INSTANTIATE_TEST_CASE_P(quick_blas3_small,
                                 ValuesIn(transA_transB_range),
                                 ValuesIn(small_batch_count_range)));
 
+INSTANTIATE_TEST_CASE_P(quick_blas3_gemm_small,
+                        gemm_strided_batched,
+                        Combine(ValuesIn(gemm_small_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(gemm_small_batch_count_range)));
+
 INSTANTIATE_TEST_CASE_P(known_bug_blas3_small,
                         gemm_strided_batched,
                         Combine(ValuesIn(known_bug_matrix_size_range),
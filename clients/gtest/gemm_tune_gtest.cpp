@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "cblas_interface.h"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm solutions and autotuner:
+=================================================================== */
+
+namespace {
+
+// a new empty directory for the tuning cache
+string make_cache_dir()
+{
+    char path[] = "/tmp/rocblas_tuning_XXXXXX";
+    EXPECT_NE(mkdtemp(path), nullptr);
+    return path;
+}
+
+// the lines of the files in dir
+string read_dir(const string& dir)
+{
+    string contents;
+    DIR* d = opendir(dir.c_str());
+    while(struct dirent* entry = d ? readdir(d) : nullptr)
+    {
+        if(entry->d_name[0] == '.')
+            continue;
+        ifstream file(dir + "/" + entry->d_name);
+        contents += string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+    }
+    if(d)
+        closedir(d);
+    return contents;
+}
+
+void remove_dir(const string& dir)
+{
+    DIR* d = opendir(dir.c_str());
+    while(struct dirent* entry = d ? readdir(d) : nullptr)
+        if(entry->d_name[0] != '.')
+            remove((dir + "/" + entry->d_name).c_str());
+    if(d)
+        closedir(d);
+    rmdir(dir.c_str());
+}
+
+// runs sgemm NN on packed m x k and k x n integer matrices with gemm_ex, with
+// the solution of solution_index unless it is -1, and checks the result
+void check_sgemm(rocblas_handle handle,
+                 rocblas_int m,
+                 rocblas_int n,
+                 rocblas_int k,
+                 int32_t solution_index = -1)
+{
+    float alpha = 1, beta = 0;
+    host_vector<float> hA(size_t(m) * k), hB(size_t(k) * n), hC(size_t(m) * n), hRef(hC.size());
+    device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size());
+    ASSERT_TRUE(dA && dB && dC);
+
+    rocblas_seedrand();
+    for(auto& x : hA)
+        x = random_generator<int>() % 5 - 2;
+    for(auto& x : hB)
+        x = random_generator<int>() % 5 - 2;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    rocblas_gemm_algo algo = solution_index == -1 ? rocblas_gemm_algo_standard
+                                                  : rocblas_gemm_algo_solution_index;
+    ASSERT_EQ(rocblas_gemm_ex(handle, rocblas_operation_none, rocblas_operation_none, m, n, k,
+                              &alpha, dA, rocblas_datatype_f32_r, m, dB, rocblas_datatype_f32_r, k,
+                              &beta, dC, rocblas_datatype_f32_r, m, dC, rocblas_datatype_f32_r, m,
+                              rocblas_datatype_f32_r, algo, solution_index, 0, nullptr, nullptr),
+              rocblas_status_success);
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+
+    cblas_gemm<float, float>(rocblas_operation_none, rocblas_operation_none, m, n, k, alpha,
+                             hA, m, hB, k, beta, hRef, m);
+    for(size_t i = 0; i < hC.size(); i++)
+        if(hC[i] != hRef[i])
+        {
+            ADD_FAILURE() << "at " << i % m << "," << i / m;
+            break;
+        }
+}
+
+} // namespace
+
+TEST(quick_blas_ex_tune, invalid_arguments)
+{
+    rocblas_local_handle handle;
+    rocblas_int solution = 0;
+
+    EXPECT_EQ(rocblas_gemm_ex_tune(nullptr, rocblas_operation_none, rocblas_operation_none, 64,
+                                   64, 64, 1, rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                   rocblas_datatype_f32_r, &solution),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_gemm_ex_tune(handle, rocblas_operation_none, rocblas_operation_none, -1,
+                                   64, 64, 1, rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                   rocblas_datatype_f32_r, &solution),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_gemm_ex_tune(handle, rocblas_operation_none, rocblas_operation_none, 64,
+                                   64, 64, 1, rocblas_datatype_f32_r, rocblas_datatype_f64_r,
+                                   rocblas_datatype_f32_r, &solution),
+              rocblas_status_not_implemented);
+    EXPECT_EQ(rocblas_gemm_ex_tune(handle, rocblas_operation_none, rocblas_operation_none, 64,
+                                   64, 6, 1, rocblas_datatype_i8_r, rocblas_datatype_i32_r,
+                                   rocblas_datatype_i32_r, &solution),
+              rocblas_status_invalid_size);
+
+    // nothing to tune
+    EXPECT_EQ(rocblas_gemm_ex_tune(handle, rocblas_operation_none, rocblas_operation_none, 0,
+                                   64, 64, 1, rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                   rocblas_datatype_f32_r, &solution),
+              rocblas_status_success);
+    EXPECT_EQ(solution, -1);
+}
+
+TEST(quick_blas_ex_solutions, list_and_run)
+{
+    const rocblas_int m = 1000, n = 600, k = 500;
+
+    rocblas_local_handle handle;
+
+    // the compiled solutions are listed without any Logic file at run time
+    size_t count = 0;
+    ASSERT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, m, n, k, 1,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, nullptr, &count),
+              rocblas_status_success);
+    ASSERT_GT(count, 0u);
+
+    vector<rocblas_gemm_solution> solutions(count);
+    ASSERT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, m, n, k, 1,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, solutions.data(), &count),
+              rocblas_status_success);
+    ASSERT_EQ(count, solutions.size());
+
+    for(size_t i = 0; i < solutions.size(); i++)
+    {
+        EXPECT_GT(strlen(solutions[i].name), 0u);
+        EXPECT_GT(solutions[i].macro_tile0, 0);
+        EXPECT_GT(solutions[i].macro_tile1, 0);
+        if(i > 0)
+            EXPECT_LE(solutions[i].predicted_gflops, solutions[i - 1].predicted_gflops);
+    }
+
+    // the first and the last listed both run the problem, and are the
+    // solutions that run; a handle logs the first solution of a problem
+    for(const rocblas_gemm_solution& s : {solutions.front(), solutions.back()})
+    {
+        setenv("ROCBLAS_LAYER", "32", 1);
+        rocblas_local_handle logged;
+        unsetenv("ROCBLAS_LAYER");
+
+        check_sgemm(logged, m, n, k, s.solution_index);
+        EXPECT_EQ(logged_solution(logged, m, n, k), s.name);
+    }
+
+    // a solution that does not exist
+    float alpha = 1, beta = 0;
+    device_vector<float> dA(size_t(m) * k), dB(size_t(k) * n), dC(size_t(m) * n);
+    EXPECT_EQ(rocblas_gemm_ex(handle, rocblas_operation_none, rocblas_operation_none, m, n, k,
+                              &alpha, dA, rocblas_datatype_f32_r, m, dB, rocblas_datatype_f32_r, k,
+                              &beta, dC, rocblas_datatype_f32_r, m, dC, rocblas_datatype_f32_r, m,
+                              rocblas_datatype_f32_r, rocblas_gemm_algo_solution_index, 100000, 0,
+                              nullptr, nullptr),
+              rocblas_status_invalid_size);
+}
+
+TEST(quick_blas_ex_tune, tune_sgemm)
+{
+    const rocblas_int m = 1000, n = 600, k = 500;
+
+    string cache_dir = make_cache_dir();
+    setenv("ROCBLAS_TUNING_CACHE_PATH", cache_dir.c_str(), 1);
+
+    {
+        rocblas_local_handle handle;
+        rocblas_int solution = -2;
+        rocblas_status status =
+            rocblas_gemm_ex_tune(handle, rocblas_operation_none, rocblas_operation_none, m, n, k,
+                                 1, rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                 rocblas_datatype_f32_r, &solution);
+        if(status == rocblas_status_not_implemented)
+            cout << "skipped: no sgemm solutions are built for the device" << endl;
+        else
+        {
+            ASSERT_EQ(status, rocblas_status_success);
+            EXPECT_GE(solution, -1);
+
+            // one entry, for the problem and the winner by position and name
+            string name = "-";
+            if(solution >= 0)
+            {
+                size_t count = 0;
+                rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                              rocblas_operation_none, m, n, k, 1,
+                                              rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                              rocblas_datatype_f32_r, nullptr, &count);
+                vector<rocblas_gemm_solution> solutions(count);
+                rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                              rocblas_operation_none, m, n, k, 1,
+                                              rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                              rocblas_datatype_f32_r, solutions.data(), &count);
+                for(const rocblas_gemm_solution& s : solutions)
+                    if(s.solution_index == solution)
+                        name = s.name;
+            }
+            ostringstream entry;
+            entry << "SB N N " << m << " " << n << " " << k << " 1 " << solution << " " << name
+                  << "\n";
+            EXPECT_NE(read_dir(cache_dir).find(entry.str()), string::npos) << read_dir(cache_dir);
+
+            // the problem runs the winner, and still computes the product
+            check_sgemm(handle, m, n, k);
+        }
+    }
+
+    unsetenv("ROCBLAS_TUNING_CACHE_PATH");
+    remove_dir(cache_dir);
+}
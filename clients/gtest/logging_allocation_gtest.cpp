@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+#include <stdlib.h>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     Heap allocations of gemm with logging disabled:
+=================================================================== */
+
+// count global operator new calls while a measurement is active; the
+// replacement applies to the whole process, including librocblas
+static atomic<bool> count_allocations{false};
+static atomic<size_t> allocation_count{0};
+
+void* operator new(size_t size)
+{
+    if(count_allocations)
+        ++allocation_count;
+    void* p = malloc(size ? size : 1);
+    if(!p)
+        throw bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+TEST(quick_auxilliary, logging_disabled_gemm_no_heap_allocation)
+{
+    // logging is off when ROCBLAS_LAYER is unset
+    unsetenv("ROCBLAS_LAYER");
+
+    const rocblas_int N     = 64;
+    const rocblas_int batch = 2;
+    const rocblas_int calls = 1000;
+    float alpha = 1.0f, beta = 0.0f;
+    rocblas_local_handle handle;
+
+    // the matrices are allocated before counting starts
+    host_vector<float> hA(N * N * batch, 1.0f);
+    device_vector<float> dA(N * N * batch), dC(N * N * batch);
+    ASSERT_TRUE(dA && dC);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N * batch, hipMemcpyHostToDevice));
+
+    auto sgemm = [&]() {
+        return rocblas_sgemm(handle,
+                             rocblas_operation_none,
+                             rocblas_operation_transpose,
+                             N,
+                             N,
+                             N,
+                             &alpha,
+                             dA,
+                             N,
+                             dA,
+                             N,
+                             &beta,
+                             dC,
+                             N);
+    };
+    auto sgemm_strided_batched = [&]() {
+        return rocblas_sgemm_strided_batched(handle,
+                                             rocblas_operation_transpose,
+                                             rocblas_operation_none,
+                                             N,
+                                             N,
+                                             N,
+                                             &alpha,
+                                             dA,
+                                             N,
+                                             N * N,
+                                             dA,
+                                             N,
+                                             N * N,
+                                             &beta,
+                                             dC,
+                                             N,
+                                             N * N,
+                                             batch);
+    };
+
+    // the first calls load the kernels and fill the solution caches
+    EXPECT_EQ(sgemm(), rocblas_status_success);
+    EXPECT_EQ(sgemm_strided_batched(), rocblas_status_success);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    // the counted calls launch kernels
+    rocblas_status status = rocblas_status_success;
+    allocation_count      = 0;
+    count_allocations     = true;
+    for(rocblas_int i = 0; i < calls; i++)
+    {
+        rocblas_status s1 = sgemm();
+        rocblas_status s2 = sgemm_strided_batched();
+        if(status == rocblas_status_success)
+            status = s1 != rocblas_status_success ? s1 : s2;
+    }
+    count_allocations = false;
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    cout << "heap allocations per disabled-logging sgemm call: "
+         << double(allocation_count) / (2 * calls) << endl;
+
+    EXPECT_EQ(status, rocblas_status_success);
+    EXPECT_EQ(allocation_count, 0u);
+}
+
+/* =====================================================================
+     Trace records written or reported dropped with logging enabled:
+=================================================================== */
+
+TEST(quick_auxilliary, logging_trace_records_written_or_dropped)
+{
+    const char* trace_path = "dropped_trace.csv";
+    setenv("ROCBLAS_LAYER", "1", 1);
+    setenv("ROCBLAS_LOG_TRACE_PATH", trace_path, 1);
+
+    const rocblas_int calls = 100000;
+    float alpha = 1.0f, beta = 0.0f;
+    size_t dropped = 0;
+    {
+        rocblas_local_handle handle;
+        for(rocblas_int i = 0; i < calls; i++)
+        {
+            rocblas_sgemm(handle,
+                          rocblas_operation_none,
+                          rocblas_operation_none,
+                          0,
+                          0,
+                          0,
+                          &alpha,
+                          nullptr,
+                          1,
+                          nullptr,
+                          1,
+                          &beta,
+                          nullptr,
+                          1);
+        }
+        EXPECT_EQ(rocblas_get_log_dropped_count(handle, nullptr), rocblas_status_invalid_pointer);
+        EXPECT_EQ(rocblas_get_log_dropped_count(handle, &dropped), rocblas_status_success);
+    }
+
+    unsetenv("ROCBLAS_LAYER");
+    unsetenv("ROCBLAS_LOG_TRACE_PATH");
+
+    // every sgemm record is either in the file or counted as dropped; the
+    // file also holds the create and destroy records
+    ifstream trace(trace_path);
+    size_t lines = 0;
+    for(string line; getline(trace, line);)
+        lines++;
+
+    cout << "trace records dropped: " << dropped << " of " << calls << endl;
+
+    EXPECT_LE(dropped, size_t(calls));
+    EXPECT_GE(lines + dropped, size_t(calls) + 1);
+    EXPECT_LE(lines + dropped, size_t(calls) + 2);
+
+    trace.close();
+    remove(trace_path);
+}
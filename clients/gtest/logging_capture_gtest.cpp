@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+#include <stdlib.h>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     Binary call records of the capture logging layer:
+=================================================================== */
+
+TEST(quick_auxilliary, logging_capture_records)
+{
+    const char* capture_path = "capture.bin";
+    setenv("ROCBLAS_LAYER", "8", 1);
+    setenv("ROCBLAS_LOG_CAPTURE_PATH", capture_path, 1);
+
+    float alpha = 2.0f, beta = 0.5f;
+    {
+        rocblas_local_handle handle;
+
+        // zero sizes take the quick return after the call is captured
+        rocblas_sgemm(handle,
+                      rocblas_operation_transpose,
+                      rocblas_operation_none,
+                      0,
+                      64,
+                      32,
+                      &alpha,
+                      nullptr,
+                      48,
+                      nullptr,
+                      40,
+                      &beta,
+                      nullptr,
+                      56);
+        rocblas_dgemm_strided_batched(handle,
+                                      rocblas_operation_none,
+                                      rocblas_operation_none,
+                                      8,
+                                      0,
+                                      8,
+                                      nullptr,
+                                      nullptr,
+                                      8,
+                                      64,
+                                      nullptr,
+                                      8,
+                                      64,
+                                      nullptr,
+                                      nullptr,
+                                      8,
+                                      64,
+                                      3);
+    }
+
+    unsetenv("ROCBLAS_LAYER");
+    unsetenv("ROCBLAS_LOG_CAPTURE_PATH");
+
+    ifstream capture(capture_path, ifstream::binary);
+    rocblas_capture_header header;
+    ASSERT_TRUE(capture.read(reinterpret_cast<char*>(&header), sizeof(header)));
+    EXPECT_EQ(strncmp(header.magic, "rbcapt", sizeof(header.magic)), 0);
+    EXPECT_EQ(header.record_size, sizeof(rocblas_capture_record));
+
+    rocblas_capture_record record;
+    ASSERT_TRUE(capture.read(reinterpret_cast<char*>(&record), sizeof(record)));
+    EXPECT_STREQ(record.function, "gemm");
+    EXPECT_EQ(record.precision, 's');
+    EXPECT_EQ(record.trans_a, 'T');
+    EXPECT_EQ(record.trans_b, 'N');
+    EXPECT_EQ(record.pointer_mode, rocblas_pointer_mode_host);
+    EXPECT_EQ(record.m, 0);
+    EXPECT_EQ(record.n, 64);
+    EXPECT_EQ(record.k, 32);
+    EXPECT_EQ(record.lda, 48);
+    EXPECT_EQ(record.ldb, 40);
+    EXPECT_EQ(record.ldc, 56);
+    EXPECT_EQ(record.batch_count, 1);
+
+    float captured_alpha, captured_beta;
+    memcpy(&captured_alpha, record.alpha, sizeof(float));
+    memcpy(&captured_beta, record.beta, sizeof(float));
+    EXPECT_EQ(captured_alpha, alpha);
+    EXPECT_EQ(captured_beta, beta);
+
+    // missing scalars are captured as zero
+    ASSERT_TRUE(capture.read(reinterpret_cast<char*>(&record), sizeof(record)));
+    EXPECT_STREQ(record.function, "gemm_strided_batched");
+    EXPECT_EQ(record.precision, 'd');
+    EXPECT_EQ(record.stride_a, 64);
+    EXPECT_EQ(record.batch_count, 3);
+
+    double zero = 0;
+    EXPECT_EQ(memcmp(record.alpha, &zero, sizeof(zero)), 0);
+
+    EXPECT_FALSE(capture.read(reinterpret_cast<char*>(&record), sizeof(record)));
+}
+
+TEST(quick_auxilliary, logging_capture_unopenable_path)
+{
+    // records are not written to std::cerr in place of the file
+    setenv("ROCBLAS_LAYER", "8", 1);
+    setenv("ROCBLAS_LOG_CAPTURE_PATH", "/nonexistent/capture.bin", 1);
+
+    float alpha = 1.0f, beta = 0.0f;
+    testing::internal::CaptureStderr();
+    {
+        rocblas_local_handle handle;
+        EXPECT_EQ(rocblas_sgemm(handle,
+                                rocblas_operation_none,
+                                rocblas_operation_none,
+                                0,
+                                0,
+                                0,
+                                &alpha,
+                                nullptr,
+                                1,
+                                nullptr,
+                                1,
+                                &beta,
+                                nullptr,
+                                1),
+                  rocblas_status_success);
+    }
+    string err = testing::internal::GetCapturedStderr();
+
+    unsetenv("ROCBLAS_LAYER");
+    unsetenv("ROCBLAS_LOG_CAPTURE_PATH");
+
+    EXPECT_NE(err.find("cannot open ROCBLAS_LOG_CAPTURE_PATH"), string::npos);
+    EXPECT_EQ(err.find("rbcapt"), string::npos);
+    EXPECT_EQ(err.find("gemm"), string::npos);
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     Call counts of the profile logging layer:
+=================================================================== */
+
+static void profile_sgemm(rocblas_handle handle,
+                          rocblas_operation trans_a,
+                          rocblas_int m,
+                          rocblas_int n,
+                          rocblas_int k)
+{
+    float alpha = 1.0f, beta = 0.0f;
+
+    // zero sizes take the quick return after the call is logged
+    rocblas_sgemm(handle,
+                  trans_a,
+                  rocblas_operation_none,
+                  m,
+                  n,
+                  k,
+                  &alpha,
+                  nullptr,
+                  1,
+                  nullptr,
+                  1,
+                  &beta,
+                  nullptr,
+                  1);
+}
+
+static vector<string> read_lines(const char* path)
+{
+    ifstream file(path);
+    vector<string> lines;
+    for(string line; getline(file, line);)
+        lines.push_back(line);
+    return lines;
+}
+
+TEST(quick_auxilliary, logging_profile_call_counts)
+{
+    const char* profile_path = "profile.yaml";
+    setenv("ROCBLAS_LAYER", "4", 1);
+    setenv("ROCBLAS_LOG_PROFILE_PATH", profile_path, 1);
+
+    {
+        rocblas_local_handle handle;
+        for(int i = 0; i < 3; i++)
+            profile_sgemm(handle, rocblas_operation_none, 0, 64, 32);
+        profile_sgemm(handle, rocblas_operation_transpose, 0, 64, 32);
+
+        EXPECT_EQ(rocblas_write_log_profile(handle), rocblas_status_success);
+
+        // counting starts again after the profile is written
+        profile_sgemm(handle, rocblas_operation_none, 16, 0, 8);
+    }
+
+    unsetenv("ROCBLAS_LAYER");
+    unsetenv("ROCBLAS_LOG_PROFILE_PATH");
+
+    EXPECT_EQ(rocblas_write_log_profile(nullptr), rocblas_status_invalid_handle);
+
+    vector<string> lines = read_lines(profile_path);
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0],
+              "- { rocblas_function: \"rocblas_sgemm\", transA: \"N\", transB: \"N\", M: 0, N: "
+              "64, K: 32, call_count: 3 }");
+    EXPECT_EQ(lines[1],
+              "- { rocblas_function: \"rocblas_sgemm\", transA: \"T\", transB: \"N\", M: 0, N: "
+              "64, K: 32, call_count: 1 }");
+    EXPECT_EQ(lines[2],
+              "- { rocblas_function: \"rocblas_sgemm\", transA: \"N\", transB: \"N\", M: 16, N: "
+              "0, K: 8, call_count: 1 }");
+}
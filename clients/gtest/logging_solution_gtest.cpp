@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     Tensile solution per gemm problem of the solution logging layer:
+=================================================================== */
+
+TEST(quick_auxilliary, logging_solution_per_problem)
+{
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    const rocblas_int N = 128;
+    float alpha = 1.0f, beta = 0.0f;
+    host_vector<float> hA(N * N, 1.0f);
+    device_vector<float> dA(N * N), dC(N * N);
+    ASSERT_TRUE(dA && dC);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N, hipMemcpyHostToDevice));
+
+    for(int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(rocblas_sgemm(handle,
+                                rocblas_operation_none,
+                                rocblas_operation_none,
+                                N,
+                                N,
+                                N,
+                                &alpha,
+                                dA,
+                                N,
+                                dA,
+                                N,
+                                &beta,
+                                dC,
+                                N),
+                  rocblas_status_success);
+    }
+    EXPECT_EQ(rocblas_gemm_ex(handle,
+                              rocblas_operation_transpose,
+                              rocblas_operation_none,
+                              N,
+                              N,
+                              N,
+                              &alpha,
+                              dA,
+                              rocblas_datatype_f32_r,
+                              N,
+                              dA,
+                              rocblas_datatype_f32_r,
+                              N,
+                              &beta,
+                              dC,
+                              rocblas_datatype_f32_r,
+                              N,
+                              dC,
+                              rocblas_datatype_f32_r,
+                              N,
+                              rocblas_datatype_f32_r,
+                              rocblas_gemm_algo_standard,
+                              0,
+                              0,
+                              nullptr,
+                              nullptr),
+              rocblas_status_success);
+
+    size_t count = 0;
+    EXPECT_EQ(rocblas_get_solution_selections(handle, nullptr, nullptr),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_get_solution_selections(handle, nullptr, &count), rocblas_status_success);
+    ASSERT_EQ(count, 2u);
+
+    vector<rocblas_solution_selection> selections(count);
+    EXPECT_EQ(rocblas_get_solution_selections(handle, selections.data(), &count),
+              rocblas_status_success);
+    ASSERT_EQ(count, 2u);
+
+    // entries are in order of first call
+    EXPECT_STREQ(selections[0].problem_type, "Cijk_Ailk_Bljk_SB");
+    EXPECT_EQ(selections[0].size_i, 128u);
+    EXPECT_EQ(selections[0].size_j, 128u);
+    EXPECT_EQ(selections[0].size_k, 1u);
+    EXPECT_EQ(selections[0].size_l, 128u);
+    EXPECT_EQ(selections[0].stride_a1, 128u);
+    EXPECT_EQ(selections[0].calls, 3u);
+    EXPECT_GT(string(selections[0].solution).size(), 0u);
+    EXPECT_EQ(selections[0].fallback, string(selections[0].solution).find("_KLS") != string::npos);
+
+    EXPECT_STREQ(selections[1].problem_type, "Cijk_Alik_Bljk_SB");
+    EXPECT_EQ(selections[1].calls, 1u);
+}
+
+TEST(quick_auxilliary, logging_solution_disabled)
+{
+    unsetenv("ROCBLAS_LAYER");
+    rocblas_local_handle handle;
+
+    size_t count = 1;
+    EXPECT_EQ(rocblas_get_solution_selections(handle, nullptr, &count), rocblas_status_success);
+    EXPECT_EQ(count, 0u);
+}
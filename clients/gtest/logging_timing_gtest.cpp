@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     GPU time per routine and shape of the timing logging layer:
+=================================================================== */
+
+TEST(quick_auxilliary, logging_timing_per_shape)
+{
+    setenv("ROCBLAS_LAYER", "16", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    const rocblas_int N = 128;
+    float alpha = 1.0f, beta = 0.0f;
+    host_vector<float> hA(N * N, 1.0f);
+    device_vector<float> dA(N * N), dC(N * N);
+    ASSERT_TRUE(dA && dC);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N, hipMemcpyHostToDevice));
+
+    for(int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(rocblas_sgemm(handle,
+                                rocblas_operation_none,
+                                rocblas_operation_none,
+                                N,
+                                N,
+                                N,
+                                &alpha,
+                                dA,
+                                N,
+                                dA,
+                                N,
+                                &beta,
+                                dC,
+                                N),
+                  rocblas_status_success);
+    }
+    EXPECT_EQ(rocblas_sgemm(handle,
+                            rocblas_operation_transpose,
+                            rocblas_operation_none,
+                            N / 2,
+                            N / 2,
+                            N,
+                            &alpha,
+                            dA,
+                            N,
+                            dA,
+                            N,
+                            &beta,
+                            dC,
+                            N),
+              rocblas_status_success);
+
+    size_t count = 0;
+    EXPECT_EQ(rocblas_get_call_timings(handle, nullptr, nullptr), rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_get_call_timings(handle, nullptr, &count), rocblas_status_success);
+    ASSERT_EQ(count, 2u);
+
+    vector<rocblas_call_timing> timings(count);
+    EXPECT_EQ(rocblas_get_call_timings(handle, timings.data(), &count), rocblas_status_success);
+    ASSERT_EQ(count, 2u);
+
+    // entries are in order of first call
+    EXPECT_STREQ(timings[0].function, "rocblas_sgemm");
+    EXPECT_STREQ(timings[0].shape, "transA: \"N\", transB: \"N\", M: 128, N: 128, K: 128");
+    EXPECT_EQ(timings[0].calls, 3u);
+    EXPECT_GT(timings[0].milliseconds, 0.0);
+    EXPECT_GT(timings[0].gflops, 0.0);
+
+    EXPECT_STREQ(timings[1].shape, "transA: \"T\", transB: \"N\", M: 64, N: 64, K: 128");
+    EXPECT_EQ(timings[1].calls, 1u);
+}
+
+TEST(quick_auxilliary, logging_timing_after_argument_checks)
+{
+    setenv("ROCBLAS_LAYER", "16", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    const rocblas_int N = 128;
+    float alpha = 1.0f, beta = 0.0f, result;
+    host_vector<float> hA(N * N, 1.0f);
+    device_vector<float> dA(N * N), dC(N * N);
+    ASSERT_TRUE(dA && dC);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * N * N, hipMemcpyHostToDevice));
+
+    // invalid arguments and quick returns queue no work
+    EXPECT_EQ(rocblas_sgemm(handle,
+                            rocblas_operation_none,
+                            rocblas_operation_none,
+                            N,
+                            N,
+                            N,
+                            &alpha,
+                            dA,
+                            N / 2,
+                            dA,
+                            N,
+                            &beta,
+                            dC,
+                            N),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocblas_sgemm(handle,
+                            rocblas_operation_none,
+                            rocblas_operation_none,
+                            0,
+                            N,
+                            N,
+                            &alpha,
+                            dA,
+                            N,
+                            dA,
+                            N,
+                            &beta,
+                            dC,
+                            N),
+              rocblas_status_success);
+    EXPECT_EQ(rocblas_sdot(handle, 0, dA, 1, dA, 1, &result), rocblas_status_success);
+
+    // nor does a device memory size query
+    size_t size;
+    EXPECT_EQ(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    EXPECT_EQ(rocblas_sdot(handle, N, dA, 1, dA, 1, &result), rocblas_status_success);
+    EXPECT_EQ(rocblas_stop_device_memory_size_query(handle, &size), rocblas_status_success);
+
+    size_t count = 0;
+    EXPECT_EQ(rocblas_get_call_timings(handle, nullptr, &count), rocblas_status_success);
+    EXPECT_EQ(count, 0u);
+
+    EXPECT_EQ(rocblas_sscal(handle, N, &alpha, dC, 1), rocblas_status_success);
+    EXPECT_EQ(rocblas_sdot(handle, N, dA, 1, dA, 1, &result), rocblas_status_success);
+
+    EXPECT_EQ(rocblas_get_call_timings(handle, nullptr, &count), rocblas_status_success);
+    ASSERT_EQ(count, 2u);
+
+    vector<rocblas_call_timing> timings(count);
+    EXPECT_EQ(rocblas_get_call_timings(handle, timings.data(), &count), rocblas_status_success);
+    EXPECT_STREQ(timings[0].function, "rocblas_sscal");
+    EXPECT_STREQ(timings[0].shape, "N: 128");
+    EXPECT_STREQ(timings[1].function, "rocblas_sdot");
+    EXPECT_EQ(timings[1].calls, 1u);
+}
+
+TEST(quick_auxilliary, logging_timing_disabled)
+{
+    unsetenv("ROCBLAS_LAYER");
+    rocblas_local_handle handle;
+
+    size_t count = 1;
+    EXPECT_EQ(rocblas_get_call_timings(handle, nullptr, &count), rocblas_status_success);
+    EXPECT_EQ(count, 0u);
+}
@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     process-wide cache of the Tensile solution per gemm problem:
+=================================================================== */
+
+TEST(quick_auxilliary, solution_cache_counters)
+{
+    const char* cache = getenv("ROCBLAS_SOLUTION_CACHE");
+    if(cache && !strcmp(cache, "0"))
+        return; // the cache is off for this process
+
+    // a shape no other test uses, so its first call is a miss
+    const rocblas_int M = 37, N = 41, K = 43;
+    float alpha = 1.0f, beta = 0.0f;
+    rocblas_local_handle handle;
+    device_vector<float> dA(M * K), dB(K * N), dC(M * N);
+    ASSERT_TRUE(dA && dB && dC);
+
+    uint64_t hits = 0, misses = 0;
+    EXPECT_EQ(rocblas_get_solution_cache_counters(nullptr, &misses),
+              rocblas_status_invalid_pointer);
+    EXPECT_EQ(rocblas_get_solution_cache_counters(&hits, &misses), rocblas_status_success);
+
+    for(int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(rocblas_sgemm(handle,
+                                rocblas_operation_none,
+                                rocblas_operation_none,
+                                M,
+                                N,
+                                K,
+                                &alpha,
+                                dA,
+                                M,
+                                dB,
+                                K,
+                                &beta,
+                                dC,
+                                M),
+                  rocblas_status_success);
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    uint64_t hits_after = 0, misses_after = 0;
+    EXPECT_EQ(rocblas_get_solution_cache_counters(&hits_after, &misses_after),
+              rocblas_status_success);
+
+    // other threads may use the cache too, so only lower bounds hold
+    EXPECT_GE(misses_after - misses, 1u);
+    EXPECT_GE(hits_after - hits, 2u);
+}
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "rocblas.h"
+#include "rocblas.hpp"
+#include "cblas_interface.h"
+#include "utility.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     gemm solution overrides:
+=================================================================== */
+
+namespace {
+
+// the solutions rocblas_gemm_ex_get_solutions lists for sgemm NN of m x n x k
+vector<rocblas_gemm_solution> sgemm_solutions(rocblas_handle handle,
+                                              rocblas_int m,
+                                              rocblas_int n,
+                                              rocblas_int k)
+{
+    size_t count = 0;
+    EXPECT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, m, n, k, 1,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, nullptr, &count),
+              rocblas_status_success);
+    vector<rocblas_gemm_solution> solutions(count);
+    EXPECT_EQ(rocblas_gemm_ex_get_solutions(handle, rocblas_operation_none,
+                                            rocblas_operation_none, m, n, k, 1,
+                                            rocblas_datatype_f32_r, rocblas_datatype_f32_r,
+                                            rocblas_datatype_f32_r, solutions.data(), &count),
+              rocblas_status_success);
+    solutions.resize(count);
+    return solutions;
+}
+
+string write_overrides(const string& contents)
+{
+    char path[] = "/tmp/rocblas_overrides_XXXXXX";
+    int fd      = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    close(fd);
+    ofstream(path) << contents;
+    return path;
+}
+
+// runs sgemm NN on packed m x k and k x n integer matrices, checks the result,
+// and returns the solution the handle logged for it
+string run_sgemm(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    float alpha = 1, beta = 0;
+    host_vector<float> hA(size_t(m) * k), hB(size_t(k) * n), hC(size_t(m) * n), hRef(hC.size());
+    device_vector<float> dA(hA.size()), dB(hB.size()), dC(hC.size());
+    EXPECT_TRUE(dA && dB && dC);
+
+    rocblas_seedrand();
+    for(auto& x : hA)
+        x = random_generator<int>() % 5 - 2;
+    for(auto& x : hB)
+        x = random_generator<int>() % 5 - 2;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    EXPECT_EQ(rocblas_sgemm(handle, rocblas_operation_none, rocblas_operation_none, m, n, k,
+                            &alpha, dA, m, dB, k, &beta, dC, m),
+              rocblas_status_success);
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+
+    cblas_gemm<float, float>(rocblas_operation_none, rocblas_operation_none, m, n, k, alpha,
+                             hA, m, hB, k, beta, hRef, m);
+    for(size_t i = 0; i < hC.size(); i++)
+        if(hC[i] != hRef[i])
+        {
+            ADD_FAILURE() << "at " << i % m << "," << i / m;
+            break;
+        }
+
+    size_t count = 0;
+    rocblas_get_solution_selections(handle, nullptr, &count);
+    vector<rocblas_solution_selection> selections(count);
+    rocblas_get_solution_selections(handle, selections.data(), &count);
+
+    for(const rocblas_solution_selection& s : selections)
+        if(s.size_i == unsigned(m) && s.size_j == unsigned(n) && s.size_l == unsigned(k))
+            return s.solution;
+    return "";
+}
+
+} // namespace
+
+TEST(quick_blas_ex_override, invalid_files)
+{
+    rocblas_local_handle handle;
+
+    EXPECT_EQ(rocblas_load_solution_overrides(nullptr, nullptr), rocblas_status_invalid_handle);
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, "/nonexistent/overrides"),
+              rocblas_status_invalid_pointer);
+
+    const char* invalid[] = {"SB N N 64 64 64\n",
+                             "SB X N 64 64 64 1 0\n",
+                             "ZB N N 64 64 64 1 0\n",
+                             "SB N N 64 64 64 1 100000\n"};
+    for(const char* contents : invalid)
+    {
+        string path = write_overrides(contents);
+        EXPECT_EQ(rocblas_load_solution_overrides(handle, path.c_str()),
+                  rocblas_status_invalid_size)
+            << contents;
+        remove(path.c_str());
+    }
+
+    // comments and blank lines only
+    string path = write_overrides("# precision transA transB m n k batch_count solution\n\n");
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, path.c_str()), rocblas_status_success);
+    remove(path.c_str());
+
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, nullptr), rocblas_status_success);
+}
+
+TEST(quick_blas_ex_override, override_runs_solution)
+{
+    const rocblas_int m = 192, n = 128, k = 64;
+
+    setenv("ROCBLAS_LAYER", "32", 1);
+    rocblas_local_handle handle;
+    unsetenv("ROCBLAS_LAYER");
+
+    // a solution other than the one picked without overrides, so the override shows
+    string picked = run_sgemm(handle, m, n, k);
+    ASSERT_FALSE(picked.empty());
+
+    vector<rocblas_gemm_solution> solutions = sgemm_solutions(handle, m, n, k);
+    auto other = find_if(solutions.begin(), solutions.end(), [&](const rocblas_gemm_solution& s) {
+        return picked != s.name;
+    });
+    if(other == solutions.end())
+    {
+        cout << "skipped: no other solution of the device can run the problem" << endl;
+        return;
+    }
+
+    string path = write_overrides("SB N N " + to_string(m) + " " + to_string(n) + " " +
+                                  to_string(k) + " 1 " + to_string(other->solution_index) + "\n");
+    ASSERT_EQ(rocblas_load_solution_overrides(handle, path.c_str()), rocblas_status_success);
+    remove(path.c_str());
+
+    // the cached pick of the problem is dropped with the new overrides
+    EXPECT_EQ(run_sgemm(handle, m, n, k), other->name);
+
+    EXPECT_EQ(rocblas_load_solution_overrides(handle, nullptr), rocblas_status_success);
+    EXPECT_EQ(run_sgemm(handle, m, n, k), picked);
+}
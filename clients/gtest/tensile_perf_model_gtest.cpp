@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <gtest/gtest.h>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "tensile_perf_model.h"
+
+using namespace std;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+     Tensile performance model, on the host against the Logic files:
+=================================================================== */
+
+namespace {
+
+const string logic_dir = string(TENSILE_LOGIC_DIR) + "/asm_full/";
+
+bool read_logic(const string& name, tensile_logic& logic)
+{
+    ifstream file(logic_dir + name);
+    return tensile_read_logic(file, logic);
+}
+
+const tensile_perf_model& vega10_sgemm_nn()
+{
+    static tensile_perf_model model = [] {
+        tensile_logic logic;
+        read_logic("vega10_Cijk_Ailk_Bljk_SB.yaml", logic);
+        return tensile_perf_model(logic, tensile_device_params());
+    }();
+    return model;
+}
+
+const tensile_logic_solution& selected(const tensile_perf_model& model,
+                                       const tensile_logic_size& size)
+{
+    int solution = model.select(size);
+    EXPECT_GE(solution, 0);
+    return model.get_logic().solutions[solution < 0 ? 0 : solution];
+}
+
+} // namespace
+
+TEST(quick_tensile_perf_model, read_logic)
+{
+    tensile_logic logic;
+    ASSERT_TRUE(read_logic("vega10_Cijk_Ailk_Bljk_SB.yaml", logic));
+
+    EXPECT_EQ(logic.schedule, "vega10");
+    EXPECT_EQ(logic.arch, "gfx900");
+    EXPECT_EQ(logic.data_type, 0);
+    ASSERT_EQ(logic.solutions.size(), 106u);
+    ASSERT_FALSE(logic.exact.empty());
+
+    for(const tensile_logic_solution& s : logic.solutions)
+    {
+        EXPECT_FALSE(s.name.empty());
+        EXPECT_GT(s.macro_tile0, 0);
+        EXPECT_GT(s.macro_tile1, 0);
+        EXPECT_GT(s.depth_u, 0);
+        EXPECT_GE(s.global_split_u, 1);
+        EXPECT_GT(s.num_threads, 0);
+    }
+
+    const tensile_logic_exact& first = logic.exact[0];
+    EXPECT_EQ(first.size, (tensile_logic_size{{4096, 7000, 1, 4096}}));
+    EXPECT_GT(first.gflops, 0);
+
+    istringstream not_logic("- {MinimumRequiredVersion: 4.2.0}\n- vega10\n");
+    EXPECT_FALSE(tensile_read_logic(not_logic, logic));
+}
+
+TEST(quick_tensile_perf_model, read_all_logic)
+{
+    DIR* dir = opendir(logic_dir.c_str());
+    ASSERT_NE(dir, nullptr);
+
+    int files = 0;
+    while(struct dirent* entry = readdir(dir))
+    {
+        string name = entry->d_name;
+        if(name.size() < 5 || name.compare(name.size() - 5, 5, ".yaml") != 0)
+            continue;
+
+        tensile_logic logic;
+        EXPECT_TRUE(read_logic(name, logic)) << name;
+        files++;
+    }
+    closedir(dir);
+
+    EXPECT_GT(files, 0);
+}
+
+TEST(quick_tensile_perf_model, exact_sizes_keep_table_choice)
+{
+    const tensile_perf_model& model = vega10_sgemm_nn();
+    for(const tensile_logic_exact& exact : model.get_logic().exact)
+    {
+        ASSERT_EQ(model.find_exact(exact.size), &exact);
+        EXPECT_EQ(model.select(exact.size), exact.solution);
+    }
+
+    EXPECT_EQ(model.find_exact({{4097, 7000, 1, 4096}}), nullptr);
+}
+
+TEST(quick_tensile_perf_model, selection_is_best_prediction)
+{
+    const tensile_perf_model& model = vega10_sgemm_nn();
+    const tensile_logic_size sizes[] = {
+        {{1000, 1000, 1, 1000}}, {{999, 777, 3, 1001}}, {{64, 64, 1, 4096}}, {{4000, 4000, 1, 16}}};
+
+    for(const tensile_logic_size& size : sizes)
+    {
+        int solution = model.select(size);
+        ASSERT_GE(solution, 0);
+
+        double best = model.predict(solution, size);
+        EXPECT_GT(best, 0);
+        for(size_t i = 0; i < model.get_logic().solutions.size(); i++)
+            EXPECT_LE(model.predict(i, size), best);
+
+        // the solution can run the size
+        const tensile_logic_solution& s = model.get_logic().solutions[solution];
+        EXPECT_TRUE(s.valid);
+        EXPECT_EQ(size[0] % s.assert_free0_multiple, 0u);
+        EXPECT_EQ(size[1] % s.assert_free1_multiple, 0u);
+        EXPECT_EQ(size[3] % s.assert_summation_multiple, 0u);
+    }
+}
+
+TEST(quick_tensile_perf_model, shapes)
+{
+    const tensile_perf_model& model = vega10_sgemm_nn();
+
+    // large problems fill the device with large tiles and no split
+    const tensile_logic_solution& large = selected(model, {{8000, 8000, 1, 8000}});
+    EXPECT_EQ(large.global_split_u, 1);
+    EXPECT_GE(large.macro_tile0 * large.macro_tile1, 64 * 64);
+
+    // a small output with a long sum splits the sum across work-groups
+    const tensile_logic_solution& deep = selected(model, {{64, 64, 1, 16384}});
+    EXPECT_GT(deep.global_split_u, 1);
+
+    // the prediction drops where the tiles overhang the matrix
+    int solution = model.select({{4096, 4096, 1, 4096}});
+    const tensile_logic_solution& s = model.get_logic().solutions[solution];
+    EXPECT_GT(model.predict(solution, {{4096, 4096, 1, 4096}}),
+              model.predict(solution, {{4096 + unsigned(s.macro_tile0) / 8, 4096, 1, 4096}}));
+}
+
+TEST(quick_tensile_perf_model, occupancy)
+{
+    const tensile_perf_model& model = vega10_sgemm_nn();
+    for(const tensile_logic_solution& s : model.get_logic().solutions)
+    {
+        int occupancy = model.occupancy(s);
+        EXPECT_GE(occupancy, 1);
+        EXPECT_LE(occupancy * ((s.num_threads + 63) / 64), 40);
+    }
+}
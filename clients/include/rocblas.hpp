@@ -170,6 +170,23 @@ rocblas_status rocblas_gemm_strided_batched(rocblas_handle handle,
                                             rocblas_int bsc,
                                             rocblas_int batch_count);
 
+template <typename T>
+rocblas_status rocblas_gemm_batched(rocblas_handle handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    rocblas_int m,
+                                    rocblas_int n,
+                                    rocblas_int k,
+                                    const T* alpha,
+                                    const T* const A[],
+                                    rocblas_int lda,
+                                    const T* const B[],
+                                    rocblas_int ldb,
+                                    const T* beta,
+                                    T* const C[],
+                                    rocblas_int ldc,
+                                    rocblas_int batch_count);
+
 template <typename T>
 rocblas_status rocblas_gemm_kernel_name(rocblas_handle handle,
                                         rocblas_operation transA,
@@ -0,0 +1,88 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+/*! \brief  measure the host time spent in each rocblas_gemm call, which includes the lookup
+ *          of the Tensile solution. Run once as is and once with ROCBLAS_SOLUTION_CACHE=0
+ *          to compare the cached lookup with Tensile's selection logic. */
+
+template <typename T>
+rocblas_status testing_gemm_overhead(Arguments argus)
+{
+    rocblas_operation transA = char2rocblas_operation(argus.transA_option);
+    rocblas_operation transB = char2rocblas_operation(argus.transB_option);
+
+    rocblas_int M   = argus.M;
+    rocblas_int N   = argus.N;
+    rocblas_int K   = argus.K;
+    rocblas_int lda = std::max(argus.lda, transA == rocblas_operation_none ? M : K);
+    rocblas_int ldb = std::max(argus.ldb, transB == rocblas_operation_none ? K : N);
+    rocblas_int ldc = std::max(argus.ldc, M);
+    T alpha         = argus.alpha;
+    T beta          = argus.beta;
+
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    // calls queued between two waits for the device, so the queue does not fill up
+    const rocblas_int calls_per_sync = 64;
+    rocblas_int number_hot_calls     = argus.iters;
+
+    rocblas_local_handle handle;
+    device_vector<T> dA(size_t(lda) * A_col), dB(size_t(ldb) * B_col), dC(size_t(ldc) * N);
+    if(!dA || !dB || !dC)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // the first call looks the solution up and fills the cache
+    CHECK_ROCBLAS_ERROR(
+        rocblas_gemm<T>(handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    uint64_t hits_before, misses_before, hits_after, misses_after;
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_counters(&hits_before, &misses_before));
+
+    double host_time_used = 0;
+    for(int i = 0; i < number_hot_calls; i += calls_per_sync)
+    {
+        int calls = std::min(calls_per_sync, number_hot_calls - i);
+
+        double start = get_time_us(); // in microseconds
+        for(int j = 0; j < calls; j++)
+        {
+            rocblas_gemm<T>(
+                handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+        }
+        host_time_used += get_time_us() - start;
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+    }
+
+    CHECK_ROCBLAS_ERROR(rocblas_get_solution_cache_counters(&hits_after, &misses_after));
+
+    const char* cache = getenv("ROCBLAS_SOLUTION_CACHE");
+    bool cache_on     = cache == nullptr || strcmp(cache, "0") != 0;
+
+    cout << "transA,transB,M,N,K,iters,solution_cache,host-us-per-call,cache_hits,cache_misses"
+         << endl;
+    cout << argus.transA_option << "," << argus.transB_option << "," << M << "," << N << "," << K
+         << "," << number_hot_calls << "," << (cache_on ? "on" : "off") << ","
+         << host_time_used / number_hot_calls << "," << hits_after - hits_before << ","
+         << misses_after - misses_before << endl;
+
+    return rocblas_status_success;
+}
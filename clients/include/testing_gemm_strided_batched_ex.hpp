@@ -364,10 +364,10 @@ rocblas_status testing_gemm_strided_batched_ex_template(rocblas_operation transA
                                                         rocblas_datatype b_type,
                                                         rocblas_datatype c_type,
                                                         rocblas_datatype d_type,
-                                                        rocblas_datatype compute_type)
+                                                        rocblas_datatype compute_type,
+                                                        rocblas_gemm_algo algo,
+                                                        int32_t solution_index)
 {
-    rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
-    int32_t solution_index = 0;
     uint32_t flags         = 0;
     size_t* workspace_size = 0;
     void* workspace;
@@ -949,6 +949,9 @@ rocblas_status testing_gemm_strided_batched_ex(Arguments argus)
     rocblas_int timing     = argus.timing;
     int number_hot_calls   = argus.iters;
 
+    rocblas_gemm_algo algo = static_cast<rocblas_gemm_algo>(argus.algo);
+    int32_t solution_index = argus.solution_index;
+
     if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
        c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
        compute_type == rocblas_datatype_f16_r)
@@ -978,7 +981,9 @@ rocblas_status testing_gemm_strided_batched_ex(Arguments argus)
             b_type,
             c_type,
             d_type,
-            compute_type);
+            compute_type,
+            algo,
+            solution_index);
     }
     else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
             c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
@@ -1008,7 +1013,9 @@ rocblas_status testing_gemm_strided_batched_ex(Arguments argus)
                                                                              b_type,
                                                                              c_type,
                                                                              d_type,
-                                                                             compute_type);
+                                                                             compute_type,
+                                                                             algo,
+                                                                             solution_index);
     }
     else if(a_type == rocblas_datatype_f32_r && b_type == rocblas_datatype_f32_r &&
             c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r &&
@@ -1038,7 +1045,9 @@ rocblas_status testing_gemm_strided_batched_ex(Arguments argus)
                                                                       b_type,
                                                                       c_type,
                                                                       d_type,
-                                                                      compute_type);
+                                                                      compute_type,
+                                                                      algo,
+                                                                      solution_index);
     }
     else if(a_type == rocblas_datatype_f64_r && b_type == rocblas_datatype_f64_r &&
             c_type == rocblas_datatype_f64_r && d_type == rocblas_datatype_f64_r &&
@@ -1068,7 +1077,9 @@ rocblas_status testing_gemm_strided_batched_ex(Arguments argus)
                                                                         b_type,
                                                                         c_type,
                                                                         d_type,
-                                                                        compute_type);
+                                                                        compute_type,
+                                                                        algo,
+                                                                        solution_index);
     }
     else
     {
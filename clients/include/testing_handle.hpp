@@ -0,0 +1,44 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "rocblas.hpp"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+/*! \brief  measure rocblas_create_handle / rocblas_destroy_handle throughput */
+
+rocblas_status testing_handle(Arguments argus)
+{
+    rocblas_int number_cold_calls = 2;
+    rocblas_int number_hot_calls  = argus.iters;
+    rocblas_handle handle;
+    double gpu_time_used;
+
+    // the first handle populates the process-wide device and log stream caches
+    for(int i = 0; i < number_cold_calls; i++)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+        CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+    }
+
+    gpu_time_used = get_time_us(); // in microseconds
+    for(int i = 0; i < number_hot_calls; i++)
+    {
+        rocblas_create_handle(&handle);
+        rocblas_destroy_handle(handle);
+    }
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    cout << "iters,handles-per-second,us-per-handle" << endl;
+    cout << number_hot_calls << "," << number_hot_calls / gpu_time_used * 1e6 << ","
+         << gpu_time_used / number_hot_calls << endl;
+
+    return rocblas_status_success;
+}
@@ -145,6 +145,29 @@ inline float half_to_float(rocblas_half val)
     return _cvtsh_ss(val);
 }
 
+// Helper routine to round floats to their nearest even bfloat16; NaN stays a quiet NaN
+inline rocblas_bfloat16 float_to_bfloat16(float val)
+{
+    uint32_t u;
+    memcpy(&u, &val, sizeof(u));
+
+    rocblas_bfloat16 r;
+    if((u & 0x7f800000) == 0x7f800000 && (u & 0x7fffff))
+        r.data = uint16_t(u >> 16) | 0x40;
+    else
+        r.data = uint16_t((u + 0x7fff + ((u >> 16) & 1)) >> 16);
+    return r;
+}
+
+// Helper routine to convert bfloat16s into their floats equivalent, which is exact
+inline float bfloat16_to_float(rocblas_bfloat16 val)
+{
+    uint32_t u = uint32_t(val.data) << 16;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
 // Random number generator
 typedef mt19937 rocblas_rng_t;
 extern rocblas_rng_t rocblas_rng, rocblas_seed;
@@ -205,6 +228,31 @@ class memory_guard
             data[i]  = random_nan_data<rocblas_half, uint16_t, 10, 5>();
     }
 
+    // Random NaN bfloat16
+    static void random_data(rocblas_bfloat16* data, size_t size = 1)
+    {
+        for(size_t i = 0; i < size; ++i)
+            data[i] = random_nan_data<rocblas_bfloat16, uint16_t, 7, 8>();
+    }
+
+    // Random NaN complex, real and imaginary parts alike
+    static void random_data(rocblas_float_complex* data, size_t size = 1)
+    {
+        random_data(reinterpret_cast<float*>(data), size * 2);
+    }
+
+    static void random_data(rocblas_double_complex* data, size_t size = 1)
+    {
+        random_data(reinterpret_cast<double*>(data), size * 2);
+    }
+
+    // Random pointer bits, for arrays of matrix pointers
+    template <typename U>
+    static void random_data(U** data, size_t size = 1)
+    {
+        random_data(reinterpret_cast<uintptr_t*>(data), size);
+    }
+
     public:
     // Constructor initializes random data and saves it for later verification
     explicit memory_guard(T* data)
@@ -664,6 +712,62 @@ void rocblas_print_vector(vector<T>& A, rocblas_int M, rocblas_int N, rocblas_in
 template <typename T>
 char type2char();
 
+/* ============================================================================================ */
+/*! \brief  rocblas_datatype of a host type, for the _ex routines */
+template <typename T>
+rocblas_datatype rocblas_datatype_of();
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<rocblas_half>()
+{
+    return rocblas_datatype_f16_r;
+}
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<rocblas_bfloat16>()
+{
+    return rocblas_datatype_bf16_r;
+}
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<float>()
+{
+    return rocblas_datatype_f32_r;
+}
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<double>()
+{
+    return rocblas_datatype_f64_r;
+}
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<int8_t>()
+{
+    return rocblas_datatype_i8_r;
+}
+
+template <>
+inline rocblas_datatype rocblas_datatype_of<int32_t>()
+{
+    return rocblas_datatype_i32_r;
+}
+
+/* ============================================================================================ */
+/*! \brief  the solution a handle logged for an m x n x k gemm; empty if none */
+inline string logged_solution(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    size_t count = 0;
+    rocblas_get_solution_selections(handle, nullptr, &count);
+    vector<rocblas_solution_selection> selections(count);
+    rocblas_get_solution_selections(handle, selections.data(), &count);
+
+    for(const rocblas_solution_selection& s : selections)
+        if(s.size_i == unsigned(m) && s.size_j == unsigned(n) && s.size_l == unsigned(k))
+            return s.solution;
+    return "";
+}
+
 /* ============================================================================================ */
 /*! \brief  Debugging purpose, print out CPU and GPU result matrix, not valid in complex number  */
 template <typename T>
@@ -65,6 +65,22 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_pointer_mode(rocblas_handle handle,
 ROCBLAS_EXPORT rocblas_status rocblas_get_pointer_mode(rocblas_handle handle,
                                                        rocblas_pointer_mode* pointer_mode);
 
+/********************************************************************************
+ * \brief set rocblas_complex_gemm_mode
+ * cgemm and zgemm form the complex product from four real products by default.
+ * rocblas_complex_gemm_mode_3m uses three (Karatsuba), which saves a quarter of
+ * the flops on large sizes at the cost of a larger rounding error in the
+ * imaginary part, and needs half as much device memory again for scratch.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_complex_gemm_mode(rocblas_handle handle,
+                                                            rocblas_complex_gemm_mode mode);
+
+/********************************************************************************
+ * \brief get rocblas_complex_gemm_mode
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_complex_gemm_mode(rocblas_handle handle,
+                                                            rocblas_complex_gemm_mode* mode);
+
 /********************************************************************************
  * \brief copy vector from host to device
  *******************************************************************************/
@@ -107,6 +123,100 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix(rocblas_int rows,
                                                  void* b,
                                                  rocblas_int ldb);
 
+/********************************************************************************
+ * \brief start a device memory size query; until it is stopped, rocblas routines
+ * that need device workspace (asum, nrm2, dot, iamax, iamin and trsm) called with
+ * handle only validate their arguments and record the device memory they need,
+ * without launching any kernels. gemm and gemm_ex in rocblas_pointer_mode_device
+ * need m x n x batch_count elements of the output type, capped at 32 MiB;
+ * larger problems run in chunks that fit
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_start_device_memory_size_query(rocblas_handle handle);
+
+/********************************************************************************
+ * \brief stop a device memory size query and return the largest amount of device
+ * memory in bytes needed by any routine called since it was started
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_stop_device_memory_size_query(rocblas_handle handle,
+                                                                    size_t* size);
+
+/********************************************************************************
+ * \brief reserve at least size bytes of device memory for the handle, so that
+ * subsequent rocblas routines do not allocate device memory
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_device_memory_size(rocblas_handle handle, size_t size);
+
+/********************************************************************************
+ * \brief get the size in bytes of the device memory currently reserved by the handle;
+ * once the handle has called trsm this includes the trsm work buffers, which are
+ * shared with the other handles on the same device
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_size(rocblas_handle handle,
+                                                             size_t* size);
+
+/********************************************************************************
+ * \brief get the number of trace and bench log records the handle dropped because
+ * the log writer thread could not keep up; 0 when logging is off
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_log_dropped_count(rocblas_handle handle,
+                                                            size_t* count);
+
+/********************************************************************************
+ * \brief with rocblas_layer_mode_log_profile set in ROCBLAS_LAYER, write the call
+ * counts accumulated by the handle as YAML to ROCBLAS_LOG_PROFILE_PATH and start
+ * counting again; the remaining counts are written when the handle is destroyed
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_write_log_profile(rocblas_handle handle);
+
+/********************************************************************************
+ * \brief with rocblas_layer_mode_log_timing set in ROCBLAS_LAYER, get the GPU time
+ * and achieved GFLOP/s of the calls made on the handle, one entry per routine and
+ * shape. On entry *count is the capacity of timings, on exit the number of entries;
+ * with timings == nullptr only the number of entries is returned. Waits for the
+ * timed calls still running on the GPU. Timed are scal, axpy, dot, nrm2, asum,
+ * gemv, ger, syr, geam, gemm, trsm and the gemm_ex routines, from after their
+ * argument checks and quick returns; device memory size queries are not timed.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_call_timings(rocblas_handle handle,
+                                                       rocblas_call_timing* timings,
+                                                       size_t* count);
+
+/********************************************************************************
+ * \brief with rocblas_layer_mode_log_solution set in ROCBLAS_LAYER, get the Tensile
+ * solution picked for each gemm problem type, size and stride seen on the handle,
+ * with the number of calls it served and whether it is a generic fallback kernel.
+ * On entry *count is the capacity of selections, on exit the number of entries;
+ * with selections == nullptr only the number of entries is returned.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_selections(
+    rocblas_handle handle, rocblas_solution_selection* selections, size_t* count);
+
+/********************************************************************************
+ * \brief get the hit and miss counts of the process-wide cache of the Tensile
+ * solution picked per gemm problem. Set ROCBLAS_SOLUTION_CACHE=0 to disable it.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_solution_cache_counters(uint64_t* hits,
+                                                                  uint64_t* misses);
+
+/********************************************************************************
+ * \brief load a file of gemm solution overrides for the device of the handle,
+ * replacing the overrides loaded for that device before; with path == nullptr
+ * the overrides of the device are removed. Each line of the file maps a problem
+ * to a solution by its position in the Logic file of its problem type for the
+ * device, as rocblas_gemm_ex_get_solutions lists it:
+ *
+ *   # precision transA transB m n k batch_count solution
+ *   SB N T 1000 1000 1000 1 42
+ *
+ * Entries are checked against the solutions built into the library; if any is
+ * invalid, it is reported on stderr, nothing is loaded and
+ * rocblas_status_invalid_size is returned. The file named by
+ * ROCBLAS_SOLUTION_OVERRIDE_PATH is loaded when the first handle of each device
+ * is created.
+ *******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_load_solution_overrides(rocblas_handle handle,
+                                                              const char* path);
+
 #ifdef __cplusplus
 }
 #endif
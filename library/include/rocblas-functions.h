@@ -1127,29 +1127,35 @@ rocblas_qgemm(
           rocblas_half_complex *C, rocblas_int ldc);
 */
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cgemm(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_float_complex *alpha,
-    const rocblas_float_complex *A, rocblas_int lda,
-    const rocblas_float_complex *B, rocblas_int ldb,
-    const rocblas_float_complex *beta,
-          rocblas_float_complex *C, rocblas_int ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm(rocblas_handle handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const rocblas_float_complex* alpha,
+                                            const rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            const rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            const rocblas_float_complex* beta,
+                                            rocblas_float_complex* C,
+                                            rocblas_int ldc);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zgemm(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_double_complex *alpha,
-    const rocblas_double_complex *A, rocblas_int lda,
-    const rocblas_double_complex *B, rocblas_int ldb,
-    const rocblas_double_complex *beta,
-          rocblas_double_complex *C, rocblas_int ldc);
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle handle,
+                                            rocblas_operation transa,
+                                            rocblas_operation transb,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex* C,
+                                            rocblas_int ldc);
 
 /***************************************************************************
  * batched
@@ -1287,31 +1293,98 @@ rocblas_qgemm_strided_batched(
     rocblas_int batch_count );
 */
 
-/* not implemented
-ROCBLAS_EXPORT rocblas_status
-rocblas_cgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_float_complex *alpha,
-    const rocblas_float_complex *A, rocblas_int lda, rocblas_int bsa,
-    const rocblas_float_complex *B, rocblas_int ldb, rocblas_int bsb,
-    const rocblas_float_complex *beta,
-          rocblas_float_complex *C, rocblas_int ldc, rocblas_int bsc,
-    rocblas_int batch_count );
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const rocblas_float_complex* alpha,
+                                                            const rocblas_float_complex* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const rocblas_float_complex* B,
+                                                            rocblas_int ldb,
+                                                            rocblas_int bsb,
+                                                            const rocblas_float_complex* beta,
+                                                            rocblas_float_complex* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
 
-ROCBLAS_EXPORT rocblas_status
-rocblas_zgemm_strided_batched(
-    rocblas_handle handle,
-    rocblas_operation transa, rocblas_operation transb,
-    rocblas_int m, rocblas_int n, rocblas_int k,
-    const rocblas_double_complex *alpha,
-    const rocblas_double_complex *A, rocblas_int lda, rocblas_int bsa,
-    const rocblas_double_complex *B, rocblas_int ldb, rocblas_int bsb,
-    const rocblas_double_complex *beta,
-          rocblas_double_complex *C, rocblas_int ldc, rocblas_int bsc,
-    rocblas_int batch_count );
-*/
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_strided_batched(rocblas_handle handle,
+                                                            rocblas_operation transa,
+                                                            rocblas_operation transb,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            const rocblas_double_complex* alpha,
+                                                            const rocblas_double_complex* A,
+                                                            rocblas_int lda,
+                                                            rocblas_int bsa,
+                                                            const rocblas_double_complex* B,
+                                                            rocblas_int ldb,
+                                                            rocblas_int bsb,
+                                                            const rocblas_double_complex* beta,
+                                                            rocblas_double_complex* C,
+                                                            rocblas_int ldc,
+                                                            rocblas_int bsc,
+                                                            rocblas_int batch_count);
+
+/***************************************************************************
+ * batched over arrays of matrix pointers
+ * A, B, C - device arrays of batch_count device pointers, one per matrix;
+ *           the matrices may be anywhere in device memory
+ * batch_count - numbers of gemm's in the batch
+ **************************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_batched(rocblas_handle handle,
+                                                    rocblas_operation transa,
+                                                    rocblas_operation transb,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const rocblas_half* alpha,
+                                                    const rocblas_half* const A[],
+                                                    rocblas_int lda,
+                                                    const rocblas_half* const B[],
+                                                    rocblas_int ldb,
+                                                    const rocblas_half* beta,
+                                                    rocblas_half* const C[],
+                                                    rocblas_int ldc,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_batched(rocblas_handle handle,
+                                                    rocblas_operation transa,
+                                                    rocblas_operation transb,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const float* alpha,
+                                                    const float* const A[],
+                                                    rocblas_int lda,
+                                                    const float* const B[],
+                                                    rocblas_int ldb,
+                                                    const float* beta,
+                                                    float* const C[],
+                                                    rocblas_int ldc,
+                                                    rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_batched(rocblas_handle handle,
+                                                    rocblas_operation transa,
+                                                    rocblas_operation transb,
+                                                    rocblas_int m,
+                                                    rocblas_int n,
+                                                    rocblas_int k,
+                                                    const double* alpha,
+                                                    const double* const A[],
+                                                    rocblas_int lda,
+                                                    const double* const B[],
+                                                    rocblas_int ldb,
+                                                    const double* beta,
+                                                    double* const C[],
+                                                    rocblas_int ldc,
+                                                    rocblas_int batch_count);
 
 /*! \brief BLAS Level 3 API
 
@@ -1456,6 +1529,363 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle han
                                                               size_t* workspace_size,
                                                               void* workspace);
 
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_batched_ex(rocblas_handle handle,
+                                                      rocblas_operation trans_a,
+                                                      rocblas_operation trans_b,
+                                                      rocblas_int m,
+                                                      rocblas_int n,
+                                                      rocblas_int k,
+                                                      const void* alpha,
+                                                      const void* a,
+                                                      rocblas_datatype a_type,
+                                                      rocblas_int lda,
+                                                      const void* b,
+                                                      rocblas_datatype b_type,
+                                                      rocblas_int ldb,
+                                                      const void* beta,
+                                                      const void* c,
+                                                      rocblas_datatype c_type,
+                                                      rocblas_int ldc,
+                                                      void* d,
+                                                      rocblas_datatype d_type,
+                                                      rocblas_int ldd,
+                                                      rocblas_int batch_count,
+                                                      rocblas_datatype compute_type,
+                                                      rocblas_gemm_algo algo,
+                                                      int32_t solution_index,
+                                                      uint32_t flags,
+                                                      size_t* workspace_size,
+                                                      void* workspace);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle handle,
+                                                       rocblas_operation trans_a,
+                                                       rocblas_operation trans_b,
+                                                       rocblas_int m,
+                                                       rocblas_int n,
+                                                       rocblas_int k,
+                                                       const void* alpha,
+                                                       const void* a,
+                                                       rocblas_datatype a_type,
+                                                       rocblas_int lda,
+                                                       const void* b,
+                                                       rocblas_datatype b_type,
+                                                       rocblas_int ldb,
+                                                       const void* beta,
+                                                       const void* c,
+                                                       rocblas_datatype c_type,
+                                                       rocblas_int ldc,
+                                                       void* d,
+                                                       rocblas_datatype d_type,
+                                                       rocblas_int ldd,
+                                                       const rocblas_gemm_epilogue* epilogue,
+                                                       rocblas_datatype compute_type,
+                                                       rocblas_gemm_algo algo,
+                                                       int32_t solution_index,
+                                                       uint32_t flags,
+                                                       size_t* workspace_size,
+                                                       void* workspace);
+
+/*
+ * 64-bit sizes, leading dimensions and strides. Problems within the range of
+ * rocblas_int run as the 32-bit routines; larger ones run as chunks that fit
+ * the 32-bit indexing of the gemm kernels.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_64(rocblas_handle handle,
+                                                 rocblas_operation trans_a,
+                                                 rocblas_operation trans_b,
+                                                 rocblas_long m,
+                                                 rocblas_long n,
+                                                 rocblas_long k,
+                                                 const void* alpha,
+                                                 const void* a,
+                                                 rocblas_datatype a_type,
+                                                 rocblas_long lda,
+                                                 const void* b,
+                                                 rocblas_datatype b_type,
+                                                 rocblas_long ldb,
+                                                 const void* beta,
+                                                 const void* c,
+                                                 rocblas_datatype c_type,
+                                                 rocblas_long ldc,
+                                                 void* d,
+                                                 rocblas_datatype d_type,
+                                                 rocblas_long ldd,
+                                                 rocblas_datatype compute_type,
+                                                 rocblas_gemm_algo algo,
+                                                 int32_t solution_index,
+                                                 uint32_t flags,
+                                                 size_t* workspace_size,
+                                                 void* workspace);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_strided_batched_ex_64(rocblas_handle handle,
+                                                                 rocblas_operation trans_a,
+                                                                 rocblas_operation trans_b,
+                                                                 rocblas_long m,
+                                                                 rocblas_long n,
+                                                                 rocblas_long k,
+                                                                 const void* alpha,
+                                                                 const void* a,
+                                                                 rocblas_datatype a_type,
+                                                                 rocblas_long lda,
+                                                                 rocblas_long stride_a,
+                                                                 const void* b,
+                                                                 rocblas_datatype b_type,
+                                                                 rocblas_long ldb,
+                                                                 rocblas_long stride_b,
+                                                                 const void* beta,
+                                                                 const void* c,
+                                                                 rocblas_datatype c_type,
+                                                                 rocblas_long ldc,
+                                                                 rocblas_long stride_c,
+                                                                 void* d,
+                                                                 rocblas_datatype d_type,
+                                                                 rocblas_long ldd,
+                                                                 rocblas_long stride_d,
+                                                                 rocblas_long batch_count,
+                                                                 rocblas_datatype compute_type,
+                                                                 rocblas_gemm_algo algo,
+                                                                 int32_t solution_index,
+                                                                 uint32_t flags,
+                                                                 size_t* workspace_size,
+                                                                 void* workspace);
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_64(rocblas_handle handle,
+                                               rocblas_operation transa,
+                                               rocblas_operation transb,
+                                               rocblas_long m,
+                                               rocblas_long n,
+                                               rocblas_long k,
+                                               const rocblas_half* alpha,
+                                               const rocblas_half* A,
+                                               rocblas_long lda,
+                                               const rocblas_half* B,
+                                               rocblas_long ldb,
+                                               const rocblas_half* beta,
+                                               rocblas_half* C,
+                                               rocblas_long ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_64(rocblas_handle handle,
+                                               rocblas_operation transa,
+                                               rocblas_operation transb,
+                                               rocblas_long m,
+                                               rocblas_long n,
+                                               rocblas_long k,
+                                               const float* alpha,
+                                               const float* A,
+                                               rocblas_long lda,
+                                               const float* B,
+                                               rocblas_long ldb,
+                                               const float* beta,
+                                               float* C,
+                                               rocblas_long ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_64(rocblas_handle handle,
+                                               rocblas_operation transa,
+                                               rocblas_operation transb,
+                                               rocblas_long m,
+                                               rocblas_long n,
+                                               rocblas_long k,
+                                               const double* alpha,
+                                               const double* A,
+                                               rocblas_long lda,
+                                               const double* B,
+                                               rocblas_long ldb,
+                                               const double* beta,
+                                               double* C,
+                                               rocblas_long ldc);
+
+ROCBLAS_EXPORT rocblas_status rocblas_hgemm_strided_batched_64(rocblas_handle handle,
+                                                               rocblas_operation transa,
+                                                               rocblas_operation transb,
+                                                               rocblas_long m,
+                                                               rocblas_long n,
+                                                               rocblas_long k,
+                                                               const rocblas_half* alpha,
+                                                               const rocblas_half* A,
+                                                               rocblas_long lda,
+                                                               rocblas_long bsa,
+                                                               const rocblas_half* B,
+                                                               rocblas_long ldb,
+                                                               rocblas_long bsb,
+                                                               const rocblas_half* beta,
+                                                               rocblas_half* C,
+                                                               rocblas_long ldc,
+                                                               rocblas_long bsc,
+                                                               rocblas_long batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_strided_batched_64(rocblas_handle handle,
+                                                               rocblas_operation transa,
+                                                               rocblas_operation transb,
+                                                               rocblas_long m,
+                                                               rocblas_long n,
+                                                               rocblas_long k,
+                                                               const float* alpha,
+                                                               const float* A,
+                                                               rocblas_long lda,
+                                                               rocblas_long bsa,
+                                                               const float* B,
+                                                               rocblas_long ldb,
+                                                               rocblas_long bsb,
+                                                               const float* beta,
+                                                               float* C,
+                                                               rocblas_long ldc,
+                                                               rocblas_long bsc,
+                                                               rocblas_long batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_strided_batched_64(rocblas_handle handle,
+                                                               rocblas_operation transa,
+                                                               rocblas_operation transb,
+                                                               rocblas_long m,
+                                                               rocblas_long n,
+                                                               rocblas_long k,
+                                                               const double* alpha,
+                                                               const double* A,
+                                                               rocblas_long lda,
+                                                               rocblas_long bsa,
+                                                               const double* B,
+                                                               rocblas_long ldb,
+                                                               rocblas_long bsb,
+                                                               const double* beta,
+                                                               double* C,
+                                                               rocblas_long ldc,
+                                                               rocblas_long bsc,
+                                                               rocblas_long batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_grouped_ex(rocblas_handle handle,
+                                                      const rocblas_operation* trans_a,
+                                                      const rocblas_operation* trans_b,
+                                                      const rocblas_int* m,
+                                                      const rocblas_int* n,
+                                                      const rocblas_int* k,
+                                                      const void* alpha,
+                                                      const void* a,
+                                                      rocblas_datatype a_type,
+                                                      const rocblas_int* lda,
+                                                      const void* b,
+                                                      rocblas_datatype b_type,
+                                                      const rocblas_int* ldb,
+                                                      const void* beta,
+                                                      const void* c,
+                                                      rocblas_datatype c_type,
+                                                      const rocblas_int* ldc,
+                                                      void* d,
+                                                      rocblas_datatype d_type,
+                                                      const rocblas_int* ldd,
+                                                      rocblas_int group_count,
+                                                      const rocblas_int* group_size,
+                                                      rocblas_datatype compute_type,
+                                                      rocblas_gemm_algo algo,
+                                                      int32_t solution_index,
+                                                      uint32_t flags,
+                                                      size_t* workspace_size,
+                                                      void* workspace);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemm_ex_tune times every compiled solution of the device that can run the
+    gemm_ex problem of the given sizes and types, and the one picked without
+    tuning, on scratch memory of the handle. gemm_ex runs the fastest for the
+    problem from then on, and the result is kept in the tuning cache in
+    ROCBLAS_TUNING_CACHE_PATH (default $XDG_CACHE_HOME/rocblas or
+    $HOME/.cache/rocblas), which later handles on a device of the same
+    architecture load when their library was built with the same solutions.
+    A cache that cannot be written is warned of on stderr. If the timing
+    fails, the solution tuned before is kept. Solutions loaded with
+    rocblas_load_solution_overrides take precedence.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    trans_a   rocblas_operation
+    @param[in]
+    trans_b   rocblas_operation
+    @param[in]
+    m, n, k   rocblas_int
+              sizes of the problem.
+    @param[in]
+    batch_count rocblas_int
+              number of gemm operations in the batch.
+    @param[in]
+    a_type    rocblas_datatype
+              type of A and B.
+    @param[in]
+    c_type    rocblas_datatype
+              type of C and D.
+    @param[in]
+    compute_type rocblas_datatype
+    @param[out]
+    solution_index rocblas_int*
+              index in the Logic file of the solution picked, or -1 if the
+              one picked without tuning is fastest, as gemm_ex takes it with
+              rocblas_gemm_algo_solution_index. May be nullptr.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_tune(rocblas_handle handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   rocblas_int k,
+                                                   rocblas_int batch_count,
+                                                   rocblas_datatype a_type,
+                                                   rocblas_datatype c_type,
+                                                   rocblas_datatype compute_type,
+                                                   rocblas_int* solution_index);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemm_ex_get_solutions lists the compiled solutions of the device that can
+    run the gemm_ex problem of the given sizes and types, with their tile
+    parameters. Any of them runs the problem when its solution_index, its
+    position in the Logic file of the device, is passed to gemm_ex with
+    rocblas_gemm_algo_solution_index. When ROCBLAS_TENSILE_LOGIC_PATH holds
+    the Logic file, they are sorted fastest predicted first; otherwise they are
+    in the order of the file. rocblas_status_not_implemented is returned if no
+    solutions of the types are built for the device.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    trans_a   rocblas_operation
+    @param[in]
+    trans_b   rocblas_operation
+    @param[in]
+    m, n, k   rocblas_int
+              sizes of the problem.
+    @param[in]
+    batch_count rocblas_int
+              number of gemm operations in the batch.
+    @param[in]
+    a_type    rocblas_datatype
+              type of A and B.
+    @param[in]
+    c_type    rocblas_datatype
+              type of C and D.
+    @param[in]
+    compute_type rocblas_datatype
+    @param[out]
+    solutions rocblas_gemm_solution*
+              the solutions; with nullptr only the number is returned.
+    @param[in, out]
+    count     size_t*
+              on entry the capacity of solutions, on exit the number of solutions.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex_get_solutions(rocblas_handle handle,
+                                                            rocblas_operation trans_a,
+                                                            rocblas_operation trans_b,
+                                                            rocblas_int m,
+                                                            rocblas_int n,
+                                                            rocblas_int k,
+                                                            rocblas_int batch_count,
+                                                            rocblas_datatype a_type,
+                                                            rocblas_datatype c_type,
+                                                            rocblas_datatype compute_type,
+                                                            rocblas_gemm_solution* solutions,
+                                                            size_t* count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,6 +30,11 @@ typedef double2 rocblas_double_complex;
 // half type TODO put name of half here
 typedef uint16_t rocblas_half;
 typedef float2 rocblas_half_complex;
+// bfloat16 type: the upper 16 bits of an IEEE single precision float
+typedef struct rocblas_bfloat16_
+{
+    uint16_t data;
+} rocblas_bfloat16;
 
 typedef struct _rocblas_handle* rocblas_handle;
 
@@ -93,20 +98,22 @@ typedef enum rocblas_status_ {
 
 /*! \brief Indicates the precision width of data stored in a blas type. */
 typedef enum rocblas_datatype_ {
-    rocblas_datatype_f16_r = 150,
-    rocblas_datatype_f32_r = 151,
-    rocblas_datatype_f64_r = 152,
-    rocblas_datatype_f16_c = 153,
-    rocblas_datatype_f32_c = 154,
-    rocblas_datatype_f64_c = 155,
-    rocblas_datatype_i8_r  = 160,
-    rocblas_datatype_u8_r  = 161,
-    rocblas_datatype_i32_r = 162,
-    rocblas_datatype_u32_r = 163,
-    rocblas_datatype_i8_c  = 164,
-    rocblas_datatype_u8_c  = 165,
-    rocblas_datatype_i32_c = 166,
-    rocblas_datatype_u32_c = 167,
+    rocblas_datatype_f16_r  = 150,
+    rocblas_datatype_f32_r  = 151,
+    rocblas_datatype_f64_r  = 152,
+    rocblas_datatype_f16_c  = 153,
+    rocblas_datatype_f32_c  = 154,
+    rocblas_datatype_f64_c  = 155,
+    rocblas_datatype_i8_r   = 160,
+    rocblas_datatype_u8_r   = 161,
+    rocblas_datatype_i32_r  = 162,
+    rocblas_datatype_u32_r  = 163,
+    rocblas_datatype_i8_c   = 164,
+    rocblas_datatype_u8_c   = 165,
+    rocblas_datatype_i32_c  = 166,
+    rocblas_datatype_u32_c  = 167,
+    rocblas_datatype_bf16_r = 168,
+    rocblas_datatype_bf16_c = 169,
 } rocblas_datatype;
 
 /*! \brief Indicates the pointer is device pointer or host pointer */
@@ -115,18 +122,159 @@ typedef enum rocblas_pointer_mode_ {
     rocblas_pointer_mode_device = 1
 } rocblas_pointer_mode;
 
+/*! \brief Indicates how complex gemm forms the product from real products */
+typedef enum rocblas_complex_gemm_mode_ {
+    rocblas_complex_gemm_mode_4m = 0, /**< four real products, as accurate as the real gemm */
+    rocblas_complex_gemm_mode_3m = 1, /**< three real products (Karatsuba), 25% fewer flops */
+} rocblas_complex_gemm_mode;
+
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocblas_layer_mode_ {
-    rocblas_layer_mode_none      = 0b0000000000,
-    rocblas_layer_mode_log_trace = 0b0000000001,
-    rocblas_layer_mode_log_bench = 0b0000000010,
+    rocblas_layer_mode_none         = 0b0000000000,
+    rocblas_layer_mode_log_trace    = 0b0000000001,
+    rocblas_layer_mode_log_bench    = 0b0000000010,
+    rocblas_layer_mode_log_profile  = 0b0000000100,
+    rocblas_layer_mode_log_capture  = 0b0000001000, /**< binary records to ROCBLAS_LOG_CAPTURE_PATH, which is
+                                                         truncated when a process first opens it, so each
+                                                         process needs a path of its own */
+    rocblas_layer_mode_log_timing   = 0b0000010000,
+    rocblas_layer_mode_log_solution = 0b0000100000,
 } rocblas_layer_mode;
 
+/*! \brief Header at the start of a file written by rocblas_layer_mode_log_capture */
+typedef struct rocblas_capture_header_
+{
+    char magic[8];        /**< "rbcapt" followed by two zero bytes */
+    uint32_t record_size; /**< sizeof(rocblas_capture_record) of the writer */
+    uint32_t reserved;
+} rocblas_capture_header;
+
+/*! \brief Binary record of one call, written by rocblas_layer_mode_log_capture.
+ *  Arguments that do not apply to the routine are 0, except batch_count which is 1.
+ */
+typedef struct rocblas_capture_record_
+{
+    char function[32];    /**< rocblas-bench function name, e.g. gemm_strided_batched */
+    char precision;       /**< h, s, d, c or z */
+    char trans_a;         /**< N, T or C */
+    char trans_b;         /**< N, T or C */
+    char side;            /**< L or R */
+    char uplo;            /**< U or L */
+    char diag;            /**< U or N */
+    uint8_t pointer_mode; /**< rocblas_pointer_mode of the handle */
+    uint8_t reserved;
+    uint64_t handle; /**< identity of the handle */
+    uint64_t stream; /**< identity of the stream the call was queued on */
+    int64_t m;
+    int64_t n;
+    int64_t k;
+    int64_t lda;
+    int64_t ldb;
+    int64_t ldc;
+    int64_t ldd;
+    int64_t incx;
+    int64_t incy;
+    int64_t stride_a;
+    int64_t stride_b;
+    int64_t stride_c;
+    int64_t stride_d;
+    int64_t batch_count;
+    int32_t a_type; /**< rocblas_datatype of the _ex routines */
+    int32_t b_type;
+    int32_t c_type;
+    int32_t d_type;
+    int32_t compute_type;
+    uint32_t algo;
+    int32_t solution_index;
+    uint32_t flags;
+    uint64_t workspace_size;
+    uint8_t alpha[16]; /**< value of alpha in its own type, also in device pointer mode */
+    uint8_t beta[16];  /**< value of beta in its own type, also in device pointer mode */
+} rocblas_capture_record;
+
+/*! \brief GPU time of the calls of one routine with one set of sizes, collected
+ *  by rocblas_layer_mode_log_timing
+ */
+typedef struct rocblas_call_timing_
+{
+    char function[32]; /**< routine, e.g. rocblas_sgemm */
+    char shape[128];   /**< arguments that tell calls apart, e.g. transA: "N", M: 128 */
+    uint64_t calls;
+    double milliseconds; /**< total time of the calls */
+    double gflops;       /**< achieved GFLOP/s over all the calls */
+} rocblas_call_timing;
+
+/*! \brief Tensile solution picked for one gemm problem, collected by
+ *  rocblas_layer_mode_log_solution
+ */
+typedef struct rocblas_solution_selection_
+{
+    char problem_type[32]; /**< Tensile problem type, e.g. Cijk_Ailk_Bljk_SB */
+    uint32_t size_i;       /**< m */
+    uint32_t size_j;       /**< n */
+    uint32_t size_k;       /**< batch count */
+    uint32_t size_l;       /**< k */
+    uint32_t stride_c1;
+    uint32_t stride_c2;
+    uint32_t stride_a1;
+    uint32_t stride_a2;
+    uint32_t stride_b1;
+    uint32_t stride_b2;
+    char solution[256]; /**< name of the Tensile solution */
+    uint64_t calls;
+    int32_t fallback; /**< 1 if the solution is a generic source kernel, not a tuned one */
+} rocblas_solution_selection;
+
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocblas_gemm_algo_ {
-    rocblas_gemm_algo_standard = 0b0000000000,
+    rocblas_gemm_algo_standard       = 0b0000000000,
+    rocblas_gemm_algo_solution_index = 0b0000000001, /**< run the solution of solution_index */
 } rocblas_gemm_algo;
 
+/*! \brief Tensile solution that can run a gemm_ex problem, listed by
+ *  rocblas_gemm_ex_get_solutions
+ */
+typedef struct rocblas_gemm_solution_
+{
+    int32_t solution_index; /**< for rocblas_gemm_algo_solution_index */
+    char name[256];         /**< name of the Tensile solution */
+    int32_t macro_tile0;    /**< rows of D per work-group */
+    int32_t macro_tile1;    /**< columns of D per work-group */
+    int32_t depth_u;        /**< k unroll */
+    int32_t global_split_u; /**< work-groups k is split across */
+    int32_t local_split_u;  /**< wavefronts k is split across in a work-group */
+    int32_t workgroup_size;
+    double predicted_gflops; /**< of the performance model of the Logic file; 0 if it is off */
+} rocblas_gemm_solution;
+
+/*! \brief Activation applied to D by the epilogue of rocblas_gemm_ex_epilogue */
+typedef enum rocblas_activation_ {
+    rocblas_activation_none = 0,
+    rocblas_activation_relu = 1, /**< max(x, 0) */
+    rocblas_activation_gelu = 2, /**< GELU, tanh approximation */
+} rocblas_activation;
+
+/*! \brief Indicates which dimension of D the bias vector of an epilogue runs along */
+typedef enum rocblas_bias_mode_ {
+    rocblas_bias_none   = 0,
+    rocblas_bias_row    = 1, /**< m values, bias[i] is added to row i of D */
+    rocblas_bias_column = 2, /**< n values, bias[j] is added to column j of D */
+} rocblas_bias_mode;
+
+/*! \brief Work rocblas_gemm_ex_epilogue does on the product before it stores D:
+ *
+ *      aux = alpha*op( A )*op( B ) + beta*C + bias
+ *      D   = activation( aux )
+ */
+typedef struct rocblas_gemm_epilogue_
+{
+    rocblas_bias_mode bias_mode;
+    const void* bias; /**< device vector of c_type, unused with rocblas_bias_none */
+    rocblas_activation activation;
+    void* aux;          /**< optional device m by n matrix of c_type, nullptr to skip it */
+    rocblas_int ld_aux; /**< leading dimension of aux */
+} rocblas_gemm_epilogue;
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,7 +9,6 @@
 #include "definitions.h"
 #include "device_template.h"
 #include "fetch_template.h"
-#include "rocblas_unique_ptr.hpp"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
@@ -212,11 +211,29 @@ rocblas_status rocblas_iamin_template(
 
     log_bench(handle, "./rocblas-bench -f iamin -r", replaceX<T1>("X"), "-n", n, "--incx", incx);
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T1>(handle, "iamin");
+
+        record.n    = n;
+        record.incx = incx;
+        log_capture(handle, record);
+    }
+
     if(x == nullptr)
         return rocblas_status_invalid_pointer;
     else if(result == nullptr)
         return rocblas_status_invalid_pointer;
 
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+    {
+        if(n <= 0 || incx <= 0)
+            return rocblas_status_success;
+        return handle->set_optimal_device_memory_size(sizeof(T2) * ((n - 1) / NB_X + 1),
+                                                      sizeof(rocblas_int) * ((n - 1) / NB_X + 1));
+    }
+
     /*
      * Quick return if possible.
      */
@@ -237,15 +254,13 @@ rocblas_status rocblas_iamin_template(
 
     rocblas_status status;
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T2) * blocks), rocblas::device_free};
+    auto workspace = handle->device_malloc(sizeof(T2) * blocks);
     if(!workspace)
     {
         return rocblas_status_memory_error;
     }
 
-    auto workspace_index = rocblas_unique_ptr{rocblas::device_malloc(sizeof(rocblas_int) * blocks),
-                                              rocblas::device_free};
+    auto workspace_index = handle->device_malloc(sizeof(rocblas_int) * blocks);
     if(!workspace_index)
     {
         return rocblas_status_memory_error;
@@ -268,6 +268,16 @@ rocblas_status rocblas_axpy_template(rocblas_handle handle,
                   incy);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "axpy", alpha);
+
+        record.n    = n;
+        record.incx = incx;
+        record.incy = incy;
+        log_capture(handle, record);
+    }
+
     if(nullptr == alpha)
         return rocblas_status_invalid_pointer;
     else if(nullptr == x)
@@ -280,6 +290,12 @@ rocblas_status rocblas_axpy_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_axpy_flop_count<T>(n),
+                             replaceX<T>("rocblas_Xaxpy"),
+                             "N",
+                             n);
+
     int blocks = ((n - 1) / NB_X) + 1;
 
     dim3 grid(blocks, 1, 1);
@@ -8,7 +8,6 @@
 #include "status.h"
 #include "definitions.h"
 #include "device_template.h"
-#include "rocblas_unique_ptr.hpp"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
@@ -258,6 +257,16 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
               "--incy",
               incy);
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "dot");
+
+        record.n    = n;
+        record.incx = incx;
+        record.incy = incy;
+        log_capture(handle, record);
+    }
+
     if(nullptr == x)
         return rocblas_status_invalid_pointer;
     else if(nullptr == y)
@@ -265,6 +274,14 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
     else if(nullptr == result)
         return rocblas_status_invalid_pointer;
 
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+    {
+        if(n <= 0)
+            return rocblas_status_success;
+        return handle->set_optimal_device_memory_size(sizeof(T) * ((n - 1) / NB_X + 1));
+    }
+
     /*
      * Quick return if possible.
      */
@@ -281,12 +298,17 @@ rocblas_status rocblas_dot_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_dot_flop_count<T>(n),
+                             replaceX<T>("rocblas_Xdot"),
+                             "N",
+                             n);
+
     rocblas_int blocks = (n - 1) / NB_X + 1;
 
     rocblas_status status;
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T) * blocks), rocblas::device_free};
+    auto workspace = handle->device_malloc(sizeof(T) * blocks);
     if(!workspace)
     {
         return rocblas_status_memory_error;
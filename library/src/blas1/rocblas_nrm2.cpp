@@ -9,7 +9,6 @@
 #include "definitions.h"
 #include "device_template.h"
 #include "fetch_template.h"
-#include "rocblas_unique_ptr.hpp"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
@@ -199,11 +198,28 @@ rocblas_status rocblas_nrm2_template(
 
     log_bench(handle, "./rocblas-bench -f nrm2 -r", replaceX<T1>("X"), "-n", n, "--incx", incx);
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T1>(handle, "nrm2");
+
+        record.n    = n;
+        record.incx = incx;
+        log_capture(handle, record);
+    }
+
     if(nullptr == x)
         return rocblas_status_invalid_pointer;
     else if(nullptr == result)
         return rocblas_status_invalid_pointer;
 
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+    {
+        if(n <= 0 || incx <= 0)
+            return rocblas_status_success;
+        return handle->set_optimal_device_memory_size(sizeof(T2) * ((n - 1) / NB_X + 1));
+    }
+
     /*
      * Quick return if possible.
      */
@@ -220,12 +236,17 @@ rocblas_status rocblas_nrm2_template(
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_nrm2_flop_count<T1>(n),
+                             replaceX<T1>("rocblas_Xnrm2"),
+                             "N",
+                             n);
+
     rocblas_int blocks = (n - 1) / NB_X + 1;
 
     rocblas_status status;
 
-    auto workspace =
-        rocblas_unique_ptr{rocblas::device_malloc(sizeof(T2) * blocks), rocblas::device_free};
+    auto workspace = handle->device_malloc(sizeof(T2) * blocks);
     if(!workspace)
     {
         return rocblas_status_memory_error;
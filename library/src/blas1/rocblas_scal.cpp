@@ -85,6 +85,15 @@ rocblas_scal_template(rocblas_handle handle, rocblas_int n, const T* alpha, T* x
             handle, replaceX<T>("rocblas_Xscal"), n, (const void*&)alpha, (const void*&)x, incx);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "scal", alpha);
+
+        record.n    = n;
+        record.incx = incx;
+        log_capture(handle, record);
+    }
+
     if(nullptr == x)
         return rocblas_status_invalid_pointer;
     if(nullptr == alpha)
@@ -94,6 +103,12 @@ rocblas_scal_template(rocblas_handle handle, rocblas_int n, const T* alpha, T* x
     if(n <= 0 || incx <= 0)
         return rocblas_status_success;
 
+    auto timing = log_timing(handle,
+                             rocblas_scal_flop_count<T>(n),
+                             replaceX<T>("rocblas_Xscal"),
+                             "N",
+                             n);
+
     rocblas_int blocks = (n - 1) / NB_X + 1;
 
     dim3 grid(blocks, 1, 1);
@@ -101,6 +101,16 @@ rocblas_status rocblas_swap_template(
               "--incy",
               incy);
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "swap");
+
+        record.n    = n;
+        record.incx = incx;
+        record.incy = incy;
+        log_capture(handle, record);
+    }
+
     if(x == nullptr)
         return rocblas_status_invalid_pointer;
     else if(y == nullptr)
@@ -153,7 +153,7 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
                   (const void*&)y,
                   incy);
 
-        std::string transA_letter = rocblas_transpose_letter(transA);
+        const char* transA_letter = rocblas_transpose_letter(transA);
 
         log_bench(handle,
                   "./rocblas-bench -f gemv -r",
@@ -192,6 +192,19 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
                   incy);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "gemv", alpha, beta);
+
+        record.trans_a = *rocblas_transpose_letter(transA);
+        record.m       = m;
+        record.n       = n;
+        record.lda     = lda;
+        record.incx    = incx;
+        record.incy    = incy;
+        log_capture(handle, record);
+    }
+
     if(m < 0 || n < 0 || lda < m || lda < 1 || incx == 0 || incy == 0)
         return rocblas_status_invalid_size;
 
@@ -204,6 +217,16 @@ rocblas_status rocblas_gemv_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_gemv_flop_count<T>(m, n),
+                             replaceX<T>("rocblas_Xgemv"),
+                             "transA",
+                             rocblas_transpose_letter(transA),
+                             "M",
+                             m,
+                             "N",
+                             n);
+
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
     if(transA == rocblas_operation_none)
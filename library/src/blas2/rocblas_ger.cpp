@@ -142,6 +142,18 @@ rocblas_status rocblas_ger_template(rocblas_handle handle,
                   lda);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "ger", alpha);
+
+        record.m    = m;
+        record.n    = n;
+        record.incx = incx;
+        record.incy = incy;
+        record.lda  = lda;
+        log_capture(handle, record);
+    }
+
     if(nullptr == alpha)
         return rocblas_status_invalid_pointer;
     else if(nullptr == x)
@@ -170,6 +182,14 @@ rocblas_status rocblas_ger_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_ger_flop_count<T>(m, n),
+                             replaceX<T>("rocblas_Xger"),
+                             "M",
+                             m,
+                             "N",
+                             n);
+
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
 #define GEMV_DIM_X 128
@@ -98,7 +98,7 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
                   (const void*&)A,
                   lda);
 
-        std::string uplo_letter = rocblas_fill_letter(uplo);
+        const char* uplo_letter = rocblas_fill_letter(uplo);
 
         log_bench(handle,
                   "./rocblas-bench -f syr -r",
@@ -127,6 +127,17 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
                   lda);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "syr", alpha);
+
+        record.uplo = *rocblas_fill_letter(uplo);
+        record.n    = n;
+        record.incx = incx;
+        record.lda  = lda;
+        log_capture(handle, record);
+    }
+
     if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
         return rocblas_status_not_implemented;
     else if(nullptr == alpha)
@@ -151,6 +162,14 @@ rocblas_status rocblas_syr_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_syr_flop_count<T>(n),
+                             replaceX<T>("rocblas_Xsyr"),
+                             "uplo",
+                             rocblas_fill_letter(uplo),
+                             "N",
+                             n);
+
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
 #define GEMV_DIM_X 128
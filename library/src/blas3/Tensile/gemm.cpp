@@ -4,43 +4,23 @@
 
 #include <hip/hip_runtime.h>
 #include <sys/time.h>
+#include <string>
 #include "rocblas.h"
 #include "Tensile.h"
 #include "gemm.h"
+#include "gemm_batched.h"
+#include "gemm_complex.h"
+#include "gemm_device.h"
+#include "gemm_small.h"
+#include "gemm_split_k.h"
+#include "tensile_dispatch.h"
 #include "definitions.h"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
 
 /*******************************************************************************
- * Helper enumeration over different transpose combinations
- ******************************************************************************/
-typedef enum transpose_mode_ {
-    // First letter refers to A, second letter refers to B
-    NN,
-    NT,
-    TN,
-    TT
-} transpose_mode;
-
-transpose_mode GetTransposeMode(rocblas_operation trans_a, rocblas_operation trans_b)
-{
-    if(trans_a == rocblas_operation_none)
-    {
-        if(trans_b == rocblas_operation_none)
-            return NN;
-        return NT;
-    }
-    else
-    {
-        if(trans_b == rocblas_operation_none)
-            return TN;
-        return TT;
-    }
-}
-
-/*******************************************************************************
- * Tensile Solution Name (debug only)
+ * Tensile Solution Name
  ******************************************************************************/
 template <typename T>
 const char* tensileGetSolutionName(rocblas_operation trans_a,
@@ -57,47 +37,284 @@ const char* tensileGetSolutionName(rocblas_operation trans_a,
                                    rocblas_int sizeL,
                                    rocblas_handle handle)
 {
-// This macro condenses all the identical arguments to the various
-// tensileGetSolutionName function calls for consistency / brevity
-#define TENSILE_ARG_NAMES                                                                   \
-    strideC1, strideC2, strideA1, strideA2, strideB1, strideB2, sizeI, sizeJ, sizeK, sizeL, \
-        handle->rocblas_stream
+    typedef typename tensile_type<T>::type tensile_t;
+
+    return tensile_dispatch<tensile_t, tensile_t, tensile_t>::get(GetTransposeMode(trans_a, trans_b))
+        .solution_name(strideC1,
+                       strideC2,
+                       strideA1,
+                       strideA2,
+                       strideB1,
+                       strideB2,
+                       sizeI,
+                       sizeJ,
+                       sizeK,
+                       sizeL,
+                       handle->device,
+                       handle->rocblas_stream,
+                       nullptr);
+}
+
+/*******************************************************************************
+ * Tensile Function call with alpha and beta on the host
+ ******************************************************************************/
+template <typename T>
+hipError_t callTensileHost(typename tensile_type<T>::type alpha,
+                           typename tensile_type<T>::type beta,
+                           const T* A,
+                           const T* B,
+                           T* C,
+                           rocblas_operation trans_a,
+                           rocblas_operation trans_b,
+                           rocblas_int strideC1,
+                           rocblas_int strideC2,
+                           rocblas_int strideA1,
+                           rocblas_int strideA2,
+                           rocblas_int strideB1,
+                           rocblas_int strideB2,
+                           rocblas_int sizeI,
+                           rocblas_int sizeJ,
+                           rocblas_int sizeK,
+                           rocblas_int sizeL,
+                           rocblas_handle handle)
+{
+    typedef typename tensile_type<T>::type tensile_t;
 
-    transpose_mode transposeMode = GetTransposeMode(trans_a, trans_b);
+    const tensile_entry<tensile_t, tensile_t, tensile_t>& tensile =
+        tensile_dispatch<tensile_t, tensile_t, tensile_t>::get(GetTransposeMode(trans_a, trans_b));
+
+#ifndef NDEBUG
+    std::cout << "Solution Name: " << tensileGetSolutionName<T>(trans_a,
+                                                                trans_b,
+                                                                strideC1,
+                                                                strideC2,
+                                                                strideA1,
+                                                                strideA2,
+                                                                strideB1,
+                                                                strideB2,
+                                                                sizeI,
+                                                                sizeJ,
+                                                                sizeK,
+                                                                sizeL,
+                                                                handle)
+              << std::endl;
+#endif
 
-    if(std::is_same<T, rocblas_half>::value)
+    if(rocblas_solution_log_enabled(handle))
     {
-        switch(transposeMode)
-        {
-        case NN: return tensileGetSolutionName_Cijk_Ailk_Bljk_HB(TENSILE_ARG_NAMES);
-        case NT: return tensileGetSolutionName_Cijk_Ailk_Bjlk_HB(TENSILE_ARG_NAMES);
-        case TN: return tensileGetSolutionName_Cijk_Alik_Bljk_HB(TENSILE_ARG_NAMES);
-        case TT: return tensileGetSolutionName_Cijk_Alik_Bjlk_HB(TENSILE_ARG_NAMES);
-        }
+        const char* solution = tensile.solution_name(strideC1,
+                                                     strideC2,
+                                                     strideA1,
+                                                     strideA2,
+                                                     strideB1,
+                                                     strideB2,
+                                                     sizeI,
+                                                     sizeJ,
+                                                     sizeK,
+                                                     sizeL,
+                                                     handle->device,
+                                                     handle->rocblas_stream,
+                                                     nullptr);
+        log_solution(handle,
+                     trans_a,
+                     trans_b,
+                     tensile_dispatch<tensile_t, tensile_t, tensile_t>::precision(),
+                     sizeI,
+                     sizeJ,
+                     sizeK,
+                     sizeL,
+                     strideC1,
+                     strideC2,
+                     strideA1,
+                     strideA2,
+                     strideB1,
+                     strideB2,
+                     solution);
     }
-    else if(std::is_same<T, float>::value)
+
+    hipError_t status = tensile.call(reinterpret_cast<tensile_t*>(C),
+                                     reinterpret_cast<const tensile_t*>(A),
+                                     reinterpret_cast<const tensile_t*>(B),
+                                     alpha,
+                                     beta,
+                                     strideC1,
+                                     strideC2,
+                                     strideA1,
+                                     strideA2,
+                                     strideB1,
+                                     strideB2,
+                                     sizeI,
+                                     sizeJ,
+                                     sizeK,
+                                     sizeL,
+                                     handle->device,
+                                     handle->rocblas_stream,
+                                     nullptr);
+
+#ifndef NDEBUG
+    std::cout << "Return Status: " << status << std::endl;
+#endif
+
+    return status;
+}
+
+/*******************************************************************************
+ * Tensile Function call with k split over a batch of chunks (see gemm_split_k.h)
+ ******************************************************************************/
+template <typename T>
+hipError_t callTensileSplitK(const T* alpha,
+                             const T* beta,
+                             const T* A,
+                             const T* B,
+                             T* C,
+                             rocblas_operation trans_a,
+                             rocblas_operation trans_b,
+                             rocblas_int strideC1,
+                             rocblas_int strideA1,
+                             rocblas_int strideB1,
+                             rocblas_int sizeI,
+                             rocblas_int sizeJ,
+                             const gemm_split_k_plan& split,
+                             rocblas_handle handle)
+{
+    typedef typename tensile_type<T>::type tensile_t;
+
+    size_t size = gemm_split_k_workspace_size(sizeI, sizeJ, split, sizeof(T));
+    auto W      = handle->device_malloc(size);
+    if(!W)
+        return hipErrorMemoryAllocation;
+
+    T* w            = static_cast<T*>(W.get());
+    rocblas_int mn  = sizeI * sizeJ;
+    rocblas_int s_a = gemm_split_k_stride_a(trans_a, strideA1, split.chunk);
+    rocblas_int s_b = gemm_split_k_stride_b(trans_b, strideB1, split.chunk);
+
+    hipError_t status = gemm_device_pointer_clear(handle, w, size);
+    if(status != hipSuccess)
+        return status;
+
+    status = callTensileHost<T>(1,
+                                0,
+                                A,
+                                B,
+                                w,
+                                trans_a,
+                                trans_b,
+                                sizeI,
+                                mn,
+                                strideA1,
+                                s_a,
+                                strideB1,
+                                s_b,
+                                sizeI,
+                                sizeJ,
+                                split.splits,
+                                split.chunk,
+                                handle);
+    if(status != hipSuccess)
+        return status;
+
+    if(split.tail)
     {
-        switch(transposeMode)
-        {
-        case NN: return tensileGetSolutionName_Cijk_Ailk_Bljk_SB(TENSILE_ARG_NAMES);
-        case NT: return tensileGetSolutionName_Cijk_Ailk_Bjlk_SB(TENSILE_ARG_NAMES);
-        case TN: return tensileGetSolutionName_Cijk_Alik_Bljk_SB(TENSILE_ARG_NAMES);
-        case TT: return tensileGetSolutionName_Cijk_Alik_Bjlk_SB(TENSILE_ARG_NAMES);
-        }
+        status = callTensileHost<T>(1,
+                                    0,
+                                    A + size_t(s_a) * split.splits,
+                                    B + size_t(s_b) * split.splits,
+                                    w + size_t(mn) * split.splits,
+                                    trans_a,
+                                    trans_b,
+                                    sizeI,
+                                    mn,
+                                    strideA1,
+                                    s_a,
+                                    strideB1,
+                                    s_b,
+                                    sizeI,
+                                    sizeJ,
+                                    1,
+                                    split.tail,
+                                    handle);
+        if(status != hipSuccess)
+            return status;
     }
-    else if(std::is_same<T, double>::value)
+
+    return gemm_split_k_reduce(handle,
+                               sizeI,
+                               sizeJ,
+                               split.slices(),
+                               reinterpret_cast<const tensile_t*>(alpha),
+                               reinterpret_cast<const tensile_t*>(w),
+                               reinterpret_cast<const tensile_t*>(beta),
+                               reinterpret_cast<const tensile_t*>(C),
+                               strideC1,
+                               reinterpret_cast<tensile_t*>(C),
+                               strideC1);
+}
+
+/*******************************************************************************
+ * Small gemm call, in place of Tensile (see gemm_small.h)
+ ******************************************************************************/
+template <typename T>
+hipError_t callGemmSmall(const T* alpha,
+                         const T* beta,
+                         const T* A,
+                         const T* B,
+                         T* C,
+                         rocblas_operation trans_a,
+                         rocblas_operation trans_b,
+                         rocblas_int m,
+                         rocblas_int n,
+                         rocblas_int k,
+                         rocblas_int ld_a,
+                         rocblas_int stride_a,
+                         rocblas_int ld_b,
+                         rocblas_int stride_b,
+                         rocblas_int ld_c,
+                         rocblas_int stride_c,
+                         rocblas_int b_c,
+                         rocblas_handle handle)
+{
+    typedef typename tensile_type<T>::type tensile_t;
+
+    if(rocblas_solution_log_enabled(handle))
     {
-        switch(transposeMode)
-        {
-        case NN: return tensileGetSolutionName_Cijk_Ailk_Bljk_DB(TENSILE_ARG_NAMES);
-        case NT: return tensileGetSolutionName_Cijk_Ailk_Bjlk_DB(TENSILE_ARG_NAMES);
-        case TN: return tensileGetSolutionName_Cijk_Alik_Bljk_DB(TENSILE_ARG_NAMES);
-        case TT: return tensileGetSolutionName_Cijk_Alik_Bjlk_DB(TENSILE_ARG_NAMES);
-        }
+        std::string solution = "rocblas_gemm_small_MT" + std::to_string(gemm_small_dim(m)) + "x" +
+                               std::to_string(gemm_small_dim(n));
+        log_solution(handle,
+                     trans_a,
+                     trans_b,
+                     tensile_dispatch<tensile_t, tensile_t, tensile_t>::precision(),
+                     m,
+                     n,
+                     b_c,
+                     k,
+                     ld_c,
+                     stride_c,
+                     ld_a,
+                     stride_a,
+                     ld_b,
+                     stride_b,
+                     solution.c_str());
     }
-    return "";
 
-#undef TENSILE_ARG_NAMES
+    return gemm_small(handle,
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      reinterpret_cast<const tensile_t*>(alpha),
+                      reinterpret_cast<const tensile_t*>(A),
+                      ld_a,
+                      stride_a,
+                      reinterpret_cast<const tensile_t*>(B),
+                      ld_b,
+                      stride_b,
+                      reinterpret_cast<const tensile_t*>(beta),
+                      reinterpret_cast<tensile_t*>(C),
+                      ld_c,
+                      stride_c,
+                      b_c);
 }
 
 /*******************************************************************************
@@ -123,86 +340,439 @@ hipError_t callTensile(const T* alpha,
                        rocblas_int sizeL,
                        rocblas_handle handle)
 {
-#ifndef NDEBUG
-    std::cout << "Solution Name: " << tensileGetSolutionName<T>(trans_a,
-                                                                trans_b,
-                                                                strideC1,
-                                                                strideC2,
-                                                                strideA1,
-                                                                strideA2,
-                                                                strideB1,
-                                                                strideB2,
-                                                                sizeI,
-                                                                sizeJ,
-                                                                sizeK,
-                                                                sizeL,
-                                                                handle->rocblas_stream)
-              << std::endl;
-#endif
+    typedef typename tensile_type<T>::type tensile_t;
+
+    // few output tiles and a long k leave most compute units idle
+    gemm_split_k_plan split =
+        gemm_split_k_choose<tensile_t>(handle, sizeI, sizeJ, sizeL, sizeK);
+    if(split.splits > 1)
+        return callTensileSplitK<T>(alpha,
+                                    beta,
+                                    A,
+                                    B,
+                                    C,
+                                    trans_a,
+                                    trans_b,
+                                    strideC1,
+                                    strideA1,
+                                    strideB1,
+                                    sizeI,
+                                    sizeJ,
+                                    split,
+                                    handle);
 
-    // Collect alpha / beta (either from host or device)
-    T alpha_h;
-    T beta_h;
     if(rocblas_pointer_mode_host == handle->pointer_mode)
     {
-        alpha_h = *alpha;
-        beta_h  = *beta;
-    }
-    else
-    {
-        hipMemcpy(&alpha_h, alpha, sizeof(T), hipMemcpyDeviceToHost);
-        hipMemcpy(&beta_h, beta, sizeof(T), hipMemcpyDeviceToHost);
+        return callTensileHost<T>(*reinterpret_cast<const tensile_t*>(alpha),
+                                  *reinterpret_cast<const tensile_t*>(beta),
+                                  A,
+                                  B,
+                                  C,
+                                  trans_a,
+                                  trans_b,
+                                  strideC1,
+                                  strideC2,
+                                  strideA1,
+                                  strideA2,
+                                  strideB1,
+                                  strideB2,
+                                  sizeI,
+                                  sizeJ,
+                                  sizeK,
+                                  sizeL,
+                                  handle);
     }
 
-// Helper macros for function call brevity
-#define TENSILE_ARGS(T)                                                                     \
-    reinterpret_cast<T*>(C), reinterpret_cast<const T*>(A), reinterpret_cast<const T*>(B),  \
-        *reinterpret_cast<T*>(&alpha_h), *reinterpret_cast<T*>(&beta_h), 0, 0, 0, strideC1, \
-        strideC2, strideA1, strideA2, strideB1, strideB2, sizeI, sizeJ, sizeK, sizeL,       \
-        handle->rocblas_stream, 0, nullptr, nullptr
+    // Device pointer mode: Tensile computes the product alone into W, and
+    // alpha and beta are applied on the device afterwards, so nothing waits
+    // for the stream. W holds a bounded chunk of the product at a time (see
+    // gemm_device.h).
+    gemm_device_pointer_plan plan = gemm_device_pointer_choose(sizeI, sizeJ, sizeK, sizeof(T));
+    auto W = handle->device_malloc(
+        gemm_device_pointer_workspace_size(handle, sizeI, sizeJ, sizeK, sizeof(T)));
+    if(!W)
+        return hipErrorMemoryAllocation;
 
-    hipError_t status;
-    transpose_mode transposeMode = GetTransposeMode(trans_a, trans_b);
-    if(std::is_same<T, rocblas_half>::value)
-    {
-        switch(transposeMode)
-        {
-        case NN: status = tensile_Cijk_Ailk_Bljk_HB(TENSILE_ARGS(_Float16)); break;
-        case NT: status = tensile_Cijk_Ailk_Bjlk_HB(TENSILE_ARGS(_Float16)); break;
-        case TN: status = tensile_Cijk_Alik_Bljk_HB(TENSILE_ARGS(_Float16)); break;
-        case TT: status = tensile_Cijk_Alik_Bjlk_HB(TENSILE_ARGS(_Float16)); break;
-        }
-    }
-    else if(std::is_same<T, float>::value)
+    T* w = static_cast<T*>(W.get());
+
+    for(rocblas_int b = 0; b < sizeK; b += plan.batches)
     {
-        switch(transposeMode)
+        rocblas_int batches = sizeK - b < plan.batches ? sizeK - b : plan.batches;
+
+        for(rocblas_int j = 0; j < sizeJ; j += plan.columns)
         {
-        case NN: status = tensile_Cijk_Ailk_Bljk_SB(TENSILE_ARGS(float)); break;
-        case NT: status = tensile_Cijk_Ailk_Bjlk_SB(TENSILE_ARGS(float)); break;
-        case TN: status = tensile_Cijk_Alik_Bljk_SB(TENSILE_ARGS(float)); break;
-        case TT: status = tensile_Cijk_Alik_Bjlk_SB(TENSILE_ARGS(float)); break;
+            rocblas_int columns = sizeJ - j < plan.columns ? sizeJ - j : plan.columns;
+
+            for(rocblas_int i = 0; i < sizeI; i += plan.rows)
+            {
+                rocblas_int rows = sizeI - i < plan.rows ? sizeI - i : plan.rows;
+
+                size_t off_a = size_t(strideA2) * b +
+                               (trans_a == rocblas_operation_none ? i : size_t(strideA1) * i);
+                size_t off_b = size_t(strideB2) * b +
+                               (trans_b == rocblas_operation_none ? size_t(strideB1) * j : j);
+                T* c = C + size_t(strideC2) * b + size_t(strideC1) * j + i;
+
+                // not every Tensile kernel skips reading C when beta is 0
+                hipError_t status = gemm_device_pointer_clear(
+                    handle, w, size_t(rows) * columns * batches * sizeof(T));
+                if(status != hipSuccess)
+                    return status;
+
+                status = callTensileHost<T>(1,
+                                            0,
+                                            A + off_a,
+                                            B + off_b,
+                                            w,
+                                            trans_a,
+                                            trans_b,
+                                            rows,
+                                            rows * columns,
+                                            strideA1,
+                                            strideA2,
+                                            strideB1,
+                                            strideB2,
+                                            rows,
+                                            columns,
+                                            batches,
+                                            sizeL,
+                                            handle);
+                if(status != hipSuccess)
+                    return status;
+
+                status = gemm_device_pointer_scale(handle,
+                                                   rows,
+                                                   columns,
+                                                   batches,
+                                                   reinterpret_cast<const tensile_t*>(alpha),
+                                                   reinterpret_cast<const tensile_t*>(w),
+                                                   reinterpret_cast<const tensile_t*>(beta),
+                                                   reinterpret_cast<const tensile_t*>(c),
+                                                   strideC1,
+                                                   strideC2,
+                                                   reinterpret_cast<tensile_t*>(c),
+                                                   strideC1,
+                                                   strideC2);
+                if(status != hipSuccess)
+                    return status;
+            }
         }
     }
-    else if(std::is_same<T, double>::value)
+
+    return hipSuccess;
+}
+
+/*******************************************************************************
+ * Complex Tensile Function call, from real products (see gemm_complex.h)
+ ******************************************************************************/
+template <typename T, typename Tr>
+hipError_t callTensileComplex(const T* alpha,
+                              const T* beta,
+                              const T* A,
+                              const T* B,
+                              T* C,
+                              rocblas_operation trans_a,
+                              rocblas_operation trans_b,
+                              rocblas_int strideC1,
+                              rocblas_int strideC2,
+                              rocblas_int strideA1,
+                              rocblas_int strideA2,
+                              rocblas_int strideB1,
+                              rocblas_int strideB2,
+                              rocblas_int sizeI,
+                              rocblas_int sizeJ,
+                              rocblas_int sizeK,
+                              rocblas_int sizeL,
+                              rocblas_handle handle)
+{
+    // stored shapes of A and B
+    rocblas_int rows_a = trans_a == rocblas_operation_none ? sizeI : sizeL;
+    rocblas_int cols_a = trans_a == rocblas_operation_none ? sizeL : sizeI;
+    rocblas_int rows_b = trans_b == rocblas_operation_none ? sizeL : sizeJ;
+    rocblas_int cols_b = trans_b == rocblas_operation_none ? sizeJ : sizeL;
+
+    // the real products never conjugate; the splits already have
+    rocblas_operation op_a =
+        trans_a == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose;
+    rocblas_operation op_b =
+        trans_b == rocblas_operation_none ? rocblas_operation_none : rocblas_operation_transpose;
+
+    bool three_m  = rocblas_complex_gemm_mode_3m == handle->complex_gemm_mode;
+    size_t parts  = gemm_complex_parts(handle);
+    size_t size_a = size_t(sizeI) * sizeL * sizeK;
+    size_t size_b = size_t(sizeL) * sizeJ * sizeK;
+    size_t size_c = size_t(sizeI) * sizeJ * sizeK;
+
+    auto W = handle->device_malloc(
+        gemm_complex_workspace_size<Tr>(handle, sizeI, sizeJ, sizeL, sizeK));
+    if(!W)
+        return hipErrorMemoryAllocation;
+
+    Tr* Ar = static_cast<Tr*>(W.get());
+    Tr* Ai = Ar + size_a;
+    Tr* As = three_m ? Ai + size_a : nullptr;
+    Tr* Br = Ar + parts * size_a;
+    Tr* Bi = Br + size_b;
+    Tr* Bs = three_m ? Bi + size_b : nullptr;
+    Tr* P1 = Br + parts * size_b;
+    Tr* P2 = P1 + size_c;
+    Tr* P3 = three_m ? P2 + size_c : nullptr;
+
+    hipError_t status = gemm_complex_split(handle,
+                                           rows_a,
+                                           cols_a,
+                                           sizeK,
+                                           A,
+                                           strideA1,
+                                           strideA2,
+                                           trans_a == rocblas_operation_conjugate_transpose,
+                                           Ar,
+                                           Ai,
+                                           As);
+    if(status != hipSuccess)
+        return status;
+
+    status = gemm_complex_split(handle,
+                                rows_b,
+                                cols_b,
+                                sizeK,
+                                B,
+                                strideB1,
+                                strideB2,
+                                trans_b == rocblas_operation_conjugate_transpose,
+                                Br,
+                                Bi,
+                                Bs);
+    if(status != hipSuccess)
+        return status;
+
+    // not every Tensile kernel skips reading C when beta is 0
+    status = gemm_device_pointer_clear(handle, P1, parts * size_c * sizeof(Tr));
+    if(status != hipSuccess)
+        return status;
+
+    // P += alpha_r * X * Y, or P = alpha_r * X * Y when beta_r is 0
+    auto product = [&](const Tr* X, const Tr* Y, Tr alpha_r, Tr beta_r, Tr* P) {
+        return callTensileHost<Tr>(alpha_r,
+                                   beta_r,
+                                   X,
+                                   Y,
+                                   P,
+                                   op_a,
+                                   op_b,
+                                   sizeI,
+                                   sizeI * sizeJ,
+                                   rows_a,
+                                   rows_a * cols_a,
+                                   rows_b,
+                                   rows_b * cols_b,
+                                   sizeI,
+                                   sizeJ,
+                                   sizeK,
+                                   sizeL,
+                                   handle);
+    };
+
+    if(three_m)
     {
-        switch(transposeMode)
-        {
-        case NN: status = tensile_Cijk_Ailk_Bljk_DB(TENSILE_ARGS(double)); break;
-        case NT: status = tensile_Cijk_Ailk_Bjlk_DB(TENSILE_ARGS(double)); break;
-        case TN: status = tensile_Cijk_Alik_Bljk_DB(TENSILE_ARGS(double)); break;
-        case TT: status = tensile_Cijk_Alik_Bjlk_DB(TENSILE_ARGS(double)); break;
-        }
+        status = product(Ar, Br, 1, 0, P1);
+        if(status == hipSuccess)
+            status = product(Ai, Bi, 1, 0, P2);
+        if(status == hipSuccess)
+            status = product(As, Bs, 1, 0, P3);
     }
     else
     {
-        std::cerr << "Unsupported input format" << std::endl;
+        status = product(Ar, Br, 1, 0, P1);
+        if(status == hipSuccess)
+            status = product(Ai, Bi, -1, 1, P1);
+        if(status == hipSuccess)
+            status = product(Ar, Bi, 1, 0, P2);
+        if(status == hipSuccess)
+            status = product(Ai, Br, 1, 1, P2);
     }
+    if(status != hipSuccess)
+        return status;
 
-#ifndef NDEBUG
-    std::cout << "Return Status: " << status << std::endl;
-#endif
+    return gemm_complex_combine(
+        handle, sizeI, sizeJ, sizeK, P1, P2, P3, alpha, beta, C, strideC1, strideC2);
+}
 
-    return status;
+#define CALL_TENSILE_COMPLEX(T, Tr)                                                            \
+    template <>                                                                                \
+    hipError_t callTensile<T>(const T* alpha,                                                  \
+                              const T* beta,                                                   \
+                              const T* A,                                                      \
+                              const T* B,                                                      \
+                              T* C,                                                            \
+                              rocblas_operation trans_a,                                       \
+                              rocblas_operation trans_b,                                       \
+                              rocblas_int strideC1,                                            \
+                              rocblas_int strideC2,                                            \
+                              rocblas_int strideA1,                                            \
+                              rocblas_int strideA2,                                            \
+                              rocblas_int strideB1,                                            \
+                              rocblas_int strideB2,                                            \
+                              rocblas_int sizeI,                                               \
+                              rocblas_int sizeJ,                                               \
+                              rocblas_int sizeK,                                               \
+                              rocblas_int sizeL,                                               \
+                              rocblas_handle handle)                                           \
+    {                                                                                          \
+        return callTensileComplex<T, Tr>(alpha,                                                \
+                                         beta,                                                 \
+                                         A,                                                    \
+                                         B,                                                    \
+                                         C,                                                    \
+                                         trans_a,                                              \
+                                         trans_b,                                              \
+                                         strideC1,                                             \
+                                         strideC2,                                             \
+                                         strideA1,                                             \
+                                         strideA2,                                             \
+                                         strideB1,                                             \
+                                         strideB2,                                             \
+                                         sizeI,                                                \
+                                         sizeJ,                                                \
+                                         sizeK,                                                \
+                                         sizeL,                                                \
+                                         handle);                                              \
+    }                                                                                          \
+                                                                                               \
+    template <>                                                                                \
+    size_t gemm_workspace_size<T>(                                                             \
+        rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int b_c)   \
+    {                                                                                          \
+        return gemm_complex_workspace_size<Tr>(handle, m, n, k, b_c);                          \
+    }                                                                                          \
+                                                                                               \
+    /* gemm_small_fits is false for complex, so this is never called */                        \
+    template <>                                                                                \
+    hipError_t callGemmSmall<T>(const T* alpha,                                                \
+                                const T* beta,                                                 \
+                                const T* A,                                                    \
+                                const T* B,                                                    \
+                                T* C,                                                          \
+                                rocblas_operation trans_a,                                     \
+                                rocblas_operation trans_b,                                     \
+                                rocblas_int m,                                                 \
+                                rocblas_int n,                                                 \
+                                rocblas_int k,                                                 \
+                                rocblas_int ld_a,                                              \
+                                rocblas_int stride_a,                                          \
+                                rocblas_int ld_b,                                              \
+                                rocblas_int stride_b,                                          \
+                                rocblas_int ld_c,                                              \
+                                rocblas_int stride_c,                                          \
+                                rocblas_int b_c,                                               \
+                                rocblas_handle handle)                                         \
+    {                                                                                          \
+        return hipErrorInvalidValue;                                                           \
+    }
+
+// bytes of scratch callTensile draws from the handle
+template <typename T>
+size_t gemm_workspace_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int b_c)
+{
+    gemm_split_k_plan split =
+        gemm_split_k_choose<typename tensile_type<T>::type>(handle, m, n, k, b_c);
+    if(split.splits > 1)
+        return gemm_split_k_workspace_size(m, n, split, sizeof(T));
+
+    return gemm_device_pointer_workspace_size(handle, m, n, b_c, sizeof(T));
+}
+
+CALL_TENSILE_COMPLEX(rocblas_float_complex, float)
+CALL_TENSILE_COMPLEX(rocblas_double_complex, double)
+
+#undef CALL_TENSILE_COMPLEX
+
+/*******************************************************************************
+ * Tensile Function call over arrays of matrix pointers (see gemm_batched.h)
+ ******************************************************************************/
+template <typename T>
+hipError_t callTensileBatched(const T* alpha,
+                              const T* beta,
+                              const T* const* A,
+                              const T* const* B,
+                              T* const* C,
+                              rocblas_operation trans_a,
+                              rocblas_operation trans_b,
+                              rocblas_int ld_a,
+                              rocblas_int ld_b,
+                              rocblas_int ld_c,
+                              rocblas_int m,
+                              rocblas_int n,
+                              rocblas_int k,
+                              rocblas_int b_c,
+                              rocblas_int chunk,
+                              T* W,
+                              rocblas_handle handle)
+{
+    typedef typename tensile_type<T>::type tensile_t;
+
+    rocblas_int rows_a = trans_a == rocblas_operation_none ? m : k;
+    rocblas_int cols_a = trans_a == rocblas_operation_none ? k : m;
+    rocblas_int rows_b = trans_b == rocblas_operation_none ? k : n;
+    rocblas_int cols_b = trans_b == rocblas_operation_none ? n : k;
+
+    T* W_A = W + size_t(m) * n * chunk;
+    T* W_B = W_A + size_t(m) * k * chunk;
+
+    // W holds a chunk of the batch at a time (see gemm_batched.h)
+    for(rocblas_int first = 0; first < b_c; first += chunk)
+    {
+        rocblas_int count = std::min(chunk, b_c - first);
+
+        hipError_t status = gemm_batched_gather(handle, rows_a, cols_a, count, A + first, ld_a, W_A);
+        if(status != hipSuccess)
+            return status;
+
+        status = gemm_batched_gather(handle, rows_b, cols_b, count, B + first, ld_b, W_B);
+        if(status != hipSuccess)
+            return status;
+
+        status = gemm_device_pointer_clear(handle, W, size_t(m) * n * count * sizeof(T));
+        if(status != hipSuccess)
+            return status;
+
+        status = callTensileHost<T>(1,
+                                    0,
+                                    W_A,
+                                    W_B,
+                                    W,
+                                    trans_a,
+                                    trans_b,
+                                    m,
+                                    m * n,
+                                    rows_a,
+                                    rows_a * cols_a,
+                                    rows_b,
+                                    rows_b * cols_b,
+                                    m,
+                                    n,
+                                    count,
+                                    k,
+                                    handle);
+        if(status != hipSuccess)
+            return status;
+
+        status = gemm_batched_scatter(handle,
+                                      m,
+                                      n,
+                                      count,
+                                      reinterpret_cast<const tensile_t*>(alpha),
+                                      reinterpret_cast<const tensile_t*>(W),
+                                      reinterpret_cast<const tensile_t*>(beta),
+                                      reinterpret_cast<const tensile_t* const*>(C + first),
+                                      ld_c,
+                                      reinterpret_cast<tensile_t* const*>(C + first),
+                                      ld_c);
+        if(status != hipSuccess)
+            return status;
+    }
+    return hipSuccess;
 }
 
 /*******************************************************************************
@@ -226,7 +796,7 @@ rocblas_status rocblas_gemm_impl(rocblas_handle handle,
 {
     // clang-format off
     // Perform logging
-    if(nullptr != handle)
+    if(rocblas_logging_enabled(handle))
     {
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
@@ -238,8 +808,8 @@ rocblas_status rocblas_gemm_impl(rocblas_handle handle,
                       *beta,
                       (const void*&)C, ld_c);
 
-            std::string trans_a_letter = rocblas_transpose_letter(trans_a);
-            std::string trans_b_letter = rocblas_transpose_letter(trans_b);
+            const char* trans_a_letter = rocblas_transpose_letter(trans_a);
+            const char* trans_b_letter = rocblas_transpose_letter(trans_b);
 
             log_bench(handle,
                       "./rocblas-bench -f gemm -r", replaceX<T>("X"),
@@ -264,6 +834,28 @@ rocblas_status rocblas_gemm_impl(rocblas_handle handle,
                       (const void*&)beta,
                       (const void*&)C, ld_c);
         }
+
+        log_profile(handle, replaceX<T>("rocblas_Xgemm"),
+                    "transA", rocblas_transpose_letter(trans_a),
+                    "transB", rocblas_transpose_letter(trans_b),
+                    "M", m,
+                    "N", n,
+                    "K", k);
+    }
+
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "gemm", alpha, beta);
+
+        record.trans_a = *rocblas_transpose_letter(trans_a);
+        record.trans_b = *rocblas_transpose_letter(trans_b);
+        record.m       = m;
+        record.n       = n;
+        record.k       = k;
+        record.lda     = ld_a;
+        record.ldb     = ld_b;
+        record.ldc     = ld_c;
+        log_capture(handle, record);
     }
 
     rocblas_int b_c = 1;
@@ -287,6 +879,19 @@ rocblas_status rocblas_gemm_impl(rocblas_handle handle,
     if(validArgs != rocblas_status_success)
         return validArgs;
 
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(
+                   gemm_workspace_size<T>(handle, m, n, k, b_c));
+
+    auto timing = log_timing(handle, rocblas_gemm_flop_count<T>(m, n, k),
+                             replaceX<T>("rocblas_Xgemm"),
+                             "transA", rocblas_transpose_letter(trans_a),
+                             "transB", rocblas_transpose_letter(trans_b),
+                             "M", m,
+                             "N", n,
+                             "K", k);
+
     unsigned int strideC1 = static_cast<unsigned int>(ld_c);
     unsigned int strideC2 = static_cast<unsigned int>(stride_c);
     unsigned int strideA1 = static_cast<unsigned int>(ld_a);
@@ -341,52 +946,83 @@ rocblas_status rocblas_gemm_strided_batched_impl(rocblas_handle handle,
                                             B, ld_b, stride_b, beta,
                                             C, ld_c, stride_c, b_c);
 
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    if(rocblas_logging_enabled(handle))
     {
-        log_trace(handle,
-                  replaceX<T>("rocblas_Xgemm_strided_batched"),
-                  trans_a, trans_b,
-                  m, n, k,
-                  *alpha,
-                  (const void*&)A, ld_a, stride_a,
-                  (const void*&)B, ld_b, stride_b,
-                  *beta,
-                  (const void*&)C, ld_c, stride_c,
-                  b_c);
-
-        std::string trans_a_letter = rocblas_transpose_letter(trans_a);
-        std::string trans_b_letter = rocblas_transpose_letter(trans_b);
-
-        log_bench(handle,
-                  "./rocblas-bench -f gemm_strided_batched -r",
-                  replaceX<T>("X"),
-                  "--transposeA", trans_a_letter,
-                  "--transposeB", trans_b_letter,
-                  "-m", m,
-                  "-n", n,
-                  "-k", k,
-                  "--alpha", *alpha,
-                  "--lda", ld_a,
-                  "--stride_a", stride_a,
-                  "--ldb", ld_b,
-                  "--stride_b", stride_b,
-                  "--beta", *beta,
-                  "--ldc", ld_c,
-                  "--stride_c", stride_c,
-                  "--batch", b_c);
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_strided_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      *alpha,
+                      (const void*&)A, ld_a, stride_a,
+                      (const void*&)B, ld_b, stride_b,
+                      *beta,
+                      (const void*&)C, ld_c, stride_c,
+                      b_c);
+
+            const char* trans_a_letter = rocblas_transpose_letter(trans_a);
+            const char* trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            log_bench(handle,
+                      "./rocblas-bench -f gemm_strided_batched -r",
+                      replaceX<T>("X"),
+                      "--transposeA", trans_a_letter,
+                      "--transposeB", trans_b_letter,
+                      "-m", m,
+                      "-n", n,
+                      "-k", k,
+                      "--alpha", *alpha,
+                      "--lda", ld_a,
+                      "--stride_a", stride_a,
+                      "--ldb", ld_b,
+                      "--stride_b", stride_b,
+                      "--beta", *beta,
+                      "--ldc", ld_c,
+                      "--stride_c", stride_c,
+                      "--batch", b_c);
+        }
+        else
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_strided_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      (const void*&)alpha,
+                      (const void*&)A, ld_a, stride_a,
+                      (const void*&)B, ld_b, stride_b,
+                      (const void*&)beta,
+                      (const void*&)C, ld_c, stride_c,
+                      b_c);
+        }
+
+        log_profile(handle, replaceX<T>("rocblas_Xgemm_strided_batched"),
+                    "transA", rocblas_transpose_letter(trans_a),
+                    "transB", rocblas_transpose_letter(trans_b),
+                    "M", m,
+                    "N", n,
+                    "K", k,
+                    "batch", b_c);
     }
-    else
+
+    if(rocblas_capture_enabled(handle))
     {
-        log_trace(handle,
-                  replaceX<T>("rocblas_Xgemm_strided_batched"),
-                  trans_a, trans_b,
-                  m, n, k,
-                  (const void*&)alpha,
-                  (const void*&)A, ld_a, stride_a,
-                  (const void*&)B, ld_b, stride_b,
-                  (const void*&)beta,
-                  (const void*&)C, ld_c, stride_c,
-                  b_c);
+        rocblas_capture_record record =
+            rocblas_capture_start<T>(handle, "gemm_strided_batched", alpha, beta);
+
+        record.trans_a     = *rocblas_transpose_letter(trans_a);
+        record.trans_b     = *rocblas_transpose_letter(trans_b);
+        record.m           = m;
+        record.n           = n;
+        record.k           = k;
+        record.lda         = ld_a;
+        record.ldb         = ld_b;
+        record.ldc         = ld_c;
+        record.stride_a    = stride_a;
+        record.stride_b    = stride_b;
+        record.stride_c    = stride_c;
+        record.batch_count = b_c;
+        log_capture(handle, record);
     }
 
     if(m == 0 || n == 0 || k == 0 || b_c == 0)
@@ -397,6 +1033,33 @@ rocblas_status rocblas_gemm_strided_batched_impl(rocblas_handle handle,
     if(validArgs != rocblas_status_success)
         return validArgs;
 
+    // tiny matrices run many to a workgroup instead of one per Tensile macro tile
+    bool small = gemm_small_fits<T>(handle, trans_a, trans_b, m, n, k, b_c);
+
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(
+                   small ? 0 : gemm_workspace_size<T>(handle, m, n, k, b_c));
+
+    auto timing = log_timing(handle, rocblas_gemm_flop_count<T>(m, n, k) * b_c,
+                             replaceX<T>("rocblas_Xgemm_strided_batched"),
+                             "transA", rocblas_transpose_letter(trans_a),
+                             "transB", rocblas_transpose_letter(trans_b),
+                             "M", m,
+                             "N", n,
+                             "K", k,
+                             "batch", b_c);
+
+    if(small)
+        return get_rocblas_status_for_hip_status(
+                   callGemmSmall<T>(alpha, beta, A, B, C,
+                                    trans_a, trans_b,
+                                    m, n, k,
+                                    ld_a, stride_a,
+                                    ld_b, stride_b,
+                                    ld_c, stride_c,
+                                    b_c, handle));
+
     unsigned int strideC1 = static_cast<unsigned int>(ld_c);
     unsigned int strideC2 = static_cast<unsigned int>(stride_c);
     unsigned int strideA1 = static_cast<unsigned int>(ld_a);
@@ -420,6 +1083,129 @@ rocblas_status rocblas_gemm_strided_batched_impl(rocblas_handle handle,
     // clang-format on
 }
 
+/*******************************************************************************
+ * Batched GEMM implementation, over arrays of matrix pointers
+ ******************************************************************************/
+template <typename T>
+rocblas_status rocblas_gemm_batched_impl(rocblas_handle handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const T* alpha,
+                                         const T* const A[],
+                                         rocblas_int ld_a,
+                                         const T* const B[],
+                                         rocblas_int ld_b,
+                                         const T* beta,
+                                         T* const C[],
+                                         rocblas_int ld_c,
+                                         rocblas_int b_c)
+{
+    // clang-format off
+    rocblas_status validArgs = validateArgs(handle, trans_a, trans_b,
+                                            m, n, k, alpha,
+                                            A, ld_a, 0,
+                                            B, ld_b, 0, beta,
+                                            C, ld_c, 0, b_c);
+
+    if(rocblas_logging_enabled(handle))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      *alpha,
+                      (const void*&)A, ld_a,
+                      (const void*&)B, ld_b,
+                      *beta,
+                      (const void*&)C, ld_c,
+                      b_c);
+        }
+        else
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      (const void*&)alpha,
+                      (const void*&)A, ld_a,
+                      (const void*&)B, ld_b,
+                      (const void*&)beta,
+                      (const void*&)C, ld_c,
+                      b_c);
+        }
+
+        log_profile(handle, replaceX<T>("rocblas_Xgemm_batched"),
+                    "transA", rocblas_transpose_letter(trans_a),
+                    "transB", rocblas_transpose_letter(trans_b),
+                    "M", m,
+                    "N", n,
+                    "K", k,
+                    "batch", b_c);
+    }
+
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record =
+            rocblas_capture_start<T>(handle, "gemm_batched", alpha, beta);
+
+        record.trans_a     = *rocblas_transpose_letter(trans_a);
+        record.trans_b     = *rocblas_transpose_letter(trans_b);
+        record.m           = m;
+        record.n           = n;
+        record.k           = k;
+        record.lda         = ld_a;
+        record.ldb         = ld_b;
+        record.ldc         = ld_c;
+        record.batch_count = b_c;
+        log_capture(handle, record);
+    }
+
+    if(m == 0 || n == 0 || k == 0 || b_c == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    if(validArgs != rocblas_status_success)
+        return validArgs;
+
+    rocblas_int chunk = gemm_batched_chunk<T, T>(m, n, k, b_c);
+    if(!chunk)
+        return rocblas_status_invalid_size;
+
+    // only report the workspace size while the handle is in a size query
+    size_t size = gemm_batched_workspace_size<T, T>(m, n, k, chunk);
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(size);
+
+    auto timing = log_timing(handle, rocblas_gemm_flop_count<T>(m, n, k) * b_c,
+                             replaceX<T>("rocblas_Xgemm_batched"),
+                             "transA", rocblas_transpose_letter(trans_a),
+                             "transB", rocblas_transpose_letter(trans_b),
+                             "M", m,
+                             "N", n,
+                             "K", k,
+                             "batch", b_c);
+
+    auto W = handle->device_malloc(size);
+    if(!W)
+        return rocblas_status_memory_error;
+
+    hipError_t status = callTensileBatched<T>(alpha, beta, A, B, C,
+                                              trans_a, trans_b,
+                                              ld_a, ld_b, ld_c,
+                                              m, n, k, b_c, chunk,
+                                              static_cast<T*>(W.get()),
+                                              handle);
+    return get_rocblas_status_for_hip_status(status);
+
+    // clang-format on
+}
+
 /*******************************************************************************
  * Batched / Strided GEMM Kernel name implementation
  ******************************************************************************/
@@ -450,52 +1236,55 @@ rocblas_status rocblas_gemm_kernel_name_impl(rocblas_handle handle,
                                             B, ld_b, stride_b, beta,
                                             C, ld_c, stride_c, b_c);
 
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    if(rocblas_logging_enabled(handle))
     {
-        log_trace(handle,
-                  replaceX<T>("rocblas_Xgemm_strided_batched"),
-                  trans_a, trans_b,
-                  m, n, k,
-                  *alpha,
-                  (const void*&)A, ld_a, stride_a,
-                  (const void*&)B, ld_b, stride_b,
-                  *beta,
-                  (const void*&)C, ld_c, stride_c,
-                  b_c);
-
-        std::string trans_a_letter = rocblas_transpose_letter(trans_a);
-        std::string trans_b_letter = rocblas_transpose_letter(trans_b);
-
-        log_bench(handle,
-                  "./rocblas-bench -f gemm_strided_batched -r",
-                  replaceX<T>("X"),
-                  "--transposeA", trans_a_letter,
-                  "--transposeB", trans_b_letter,
-                  "-m", m,
-                  "-n", n,
-                  "-k", k,
-                  "--alpha", *alpha,
-                  "--lda", ld_a,
-                  "--bsa", stride_a,
-                  "--ldb", ld_b,
-                  "--bsb", stride_b,
-                  "--beta", *beta,
-                  "--ldc", ld_c,
-                  "--bsc", stride_c,
-                  "--batch", b_c);
-    }
-    else
-    {
-        log_trace(handle,
-                  replaceX<T>("rocblas_Xgemm_strided_batched"),
-                  trans_a, trans_b,
-                  m, n, k,
-                  (const void*&)alpha,
-                  (const void*&)A, ld_a, stride_a,
-                  (const void*&)B, ld_b, stride_b,
-                  (const void*&)beta,
-                  (const void*&)C, ld_c, stride_c,
-                  b_c);
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_strided_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      *alpha,
+                      (const void*&)A, ld_a, stride_a,
+                      (const void*&)B, ld_b, stride_b,
+                      *beta,
+                      (const void*&)C, ld_c, stride_c,
+                      b_c);
+
+            const char* trans_a_letter = rocblas_transpose_letter(trans_a);
+            const char* trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            log_bench(handle,
+                      "./rocblas-bench -f gemm_strided_batched -r",
+                      replaceX<T>("X"),
+                      "--transposeA", trans_a_letter,
+                      "--transposeB", trans_b_letter,
+                      "-m", m,
+                      "-n", n,
+                      "-k", k,
+                      "--alpha", *alpha,
+                      "--lda", ld_a,
+                      "--bsa", stride_a,
+                      "--ldb", ld_b,
+                      "--bsb", stride_b,
+                      "--beta", *beta,
+                      "--ldc", ld_c,
+                      "--bsc", stride_c,
+                      "--batch", b_c);
+        }
+        else
+        {
+            log_trace(handle,
+                      replaceX<T>("rocblas_Xgemm_strided_batched"),
+                      trans_a, trans_b,
+                      m, n, k,
+                      (const void*&)alpha,
+                      (const void*&)A, ld_a, stride_a,
+                      (const void*&)B, ld_b, stride_b,
+                      (const void*&)beta,
+                      (const void*&)C, ld_c, stride_c,
+                      b_c);
+        }
     }
 
     if(validArgs != rocblas_status_success)
@@ -592,6 +1381,46 @@ rocblas_status rocblas_dgemm(rocblas_handle handle,
                                      B, ld_b, beta, C, ld_c);
 }
 
+rocblas_status rocblas_cgemm(rocblas_handle handle,
+                             rocblas_operation trans_a,
+                             rocblas_operation trans_b,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             const rocblas_float_complex *alpha,
+                             const rocblas_float_complex *A,
+                             rocblas_int ld_a,
+                             const rocblas_float_complex *B,
+                             rocblas_int ld_b,
+                             const rocblas_float_complex *beta,
+                             rocblas_float_complex *C,
+                             rocblas_int ld_c)
+{
+    return rocblas_gemm_impl<rocblas_float_complex>(handle, trans_a, trans_b,
+                                                    m, n, k, alpha, A, ld_a,
+                                                    B, ld_b, beta, C, ld_c);
+}
+
+rocblas_status rocblas_zgemm(rocblas_handle handle,
+                             rocblas_operation trans_a,
+                             rocblas_operation trans_b,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             const rocblas_double_complex *alpha,
+                             const rocblas_double_complex *A,
+                             rocblas_int ld_a,
+                             const rocblas_double_complex *B,
+                             rocblas_int ld_b,
+                             const rocblas_double_complex *beta,
+                             rocblas_double_complex *C,
+                             rocblas_int ld_c)
+{
+    return rocblas_gemm_impl<rocblas_double_complex>(handle, trans_a, trans_b,
+                                                     m, n, k, alpha, A, ld_a,
+                                                     B, ld_b, beta, C, ld_c);
+}
+
 
 /*******************************************************************************
  * Batched / Strided GEMM APIs
@@ -684,6 +1513,146 @@ rocblas_status rocblas_dgemm_strided_batched(rocblas_handle handle,
         C, ld_c, stride_c, b_c);
 }
 
+rocblas_status rocblas_cgemm_strided_batched(rocblas_handle handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const rocblas_float_complex *alpha,
+                                             const rocblas_float_complex *A,
+                                             rocblas_int ld_a,
+                                             rocblas_int stride_a,
+                                             const rocblas_float_complex *B,
+                                             rocblas_int ld_b,
+                                             rocblas_int stride_b,
+                                             const rocblas_float_complex *beta,
+                                             rocblas_float_complex *C,
+                                             rocblas_int ld_c,
+                                             rocblas_int stride_c,
+                                             rocblas_int b_c)
+{
+    return rocblas_gemm_strided_batched_impl<rocblas_float_complex>(
+        handle, trans_a, trans_b,
+        m, n, k,
+        alpha,
+        A, ld_a, stride_a,
+        B, ld_b, stride_b,
+        beta,
+        C, ld_c, stride_c, b_c);
+}
+
+rocblas_status rocblas_zgemm_strided_batched(rocblas_handle handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             const rocblas_double_complex *alpha,
+                                             const rocblas_double_complex *A,
+                                             rocblas_int ld_a,
+                                             rocblas_int stride_a,
+                                             const rocblas_double_complex *B,
+                                             rocblas_int ld_b,
+                                             rocblas_int stride_b,
+                                             const rocblas_double_complex *beta,
+                                             rocblas_double_complex *C,
+                                             rocblas_int ld_c,
+                                             rocblas_int stride_c,
+                                             rocblas_int b_c)
+{
+    return rocblas_gemm_strided_batched_impl<rocblas_double_complex>(
+        handle, trans_a, trans_b,
+        m, n, k,
+        alpha,
+        A, ld_a, stride_a,
+        B, ld_b, stride_b,
+        beta,
+        C, ld_c, stride_c, b_c);
+}
+
+/*******************************************************************************
+ * Batched GEMM APIs
+ ******************************************************************************/
+
+rocblas_status rocblas_hgemm_batched(rocblas_handle handle,
+                                     rocblas_operation trans_a,
+                                     rocblas_operation trans_b,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const rocblas_half *alpha,
+                                     const rocblas_half *const A[],
+                                     rocblas_int ld_a,
+                                     const rocblas_half *const B[],
+                                     rocblas_int ld_b,
+                                     const rocblas_half *beta,
+                                     rocblas_half *const C[],
+                                     rocblas_int ld_c,
+                                     rocblas_int b_c)
+{
+    return rocblas_gemm_batched_impl<rocblas_half>(
+        handle, trans_a, trans_b,
+        m, n, k,
+        alpha,
+        A, ld_a,
+        B, ld_b,
+        beta,
+        C, ld_c, b_c);
+}
+
+rocblas_status rocblas_sgemm_batched(rocblas_handle handle,
+                                     rocblas_operation trans_a,
+                                     rocblas_operation trans_b,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const float *alpha,
+                                     const float *const A[],
+                                     rocblas_int ld_a,
+                                     const float *const B[],
+                                     rocblas_int ld_b,
+                                     const float *beta,
+                                     float *const C[],
+                                     rocblas_int ld_c,
+                                     rocblas_int b_c)
+{
+    return rocblas_gemm_batched_impl<float>(
+        handle, trans_a, trans_b,
+        m, n, k,
+        alpha,
+        A, ld_a,
+        B, ld_b,
+        beta,
+        C, ld_c, b_c);
+}
+
+rocblas_status rocblas_dgemm_batched(rocblas_handle handle,
+                                     rocblas_operation trans_a,
+                                     rocblas_operation trans_b,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int k,
+                                     const double *alpha,
+                                     const double *const A[],
+                                     rocblas_int ld_a,
+                                     const double *const B[],
+                                     rocblas_int ld_b,
+                                     const double *beta,
+                                     double *const C[],
+                                     rocblas_int ld_c,
+                                     rocblas_int b_c)
+{
+    return rocblas_gemm_batched_impl<double>(
+        handle, trans_a, trans_b,
+        m, n, k,
+        alpha,
+        A, ld_a,
+        B, ld_b,
+        beta,
+        C, ld_c, b_c);
+}
+
 /*******************************************************************************
  * Batched / Strided GEMM Kernel name APIs
  ******************************************************************************/
@@ -47,7 +47,7 @@ inline rocblas_status validateArgs(rocblas_handle handle,
                                    rocblas_int ld_b,
                                    rocblas_int stride_b,
                                    const void* beta,
-                                   void* c,
+                                   const void* c,
                                    rocblas_int ld_c,
                                    rocblas_int stride_c,
                                    rocblas_int batch_count)
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_BATCHED_H
+#define GEMM_BATCHED_H
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <climits>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * Batched gemm over device arrays of matrix pointers
+ *
+ * The Tensile kernels in this library only address a batch through a stride,
+ * so the batched routines gather the matrices A[i] and B[i] point at into
+ * packed slabs in scratch memory, run one strided batched Tensile launch with
+ * alpha = 1 and beta = 0 into a packed W, and gemm_finish.h scatters
+ * D[i] = alpha * W[i] + beta * C[i] back through the C and D arrays. Packed
+ * matrices keep the stored layout of A and B, with leading dimension rows and
+ * batch stride rows * cols; W is m x n x batch.
+ *
+ * The scratch holds at most GEMM_BATCHED_MAX_WORKSPACE bytes, so a large batch
+ * runs as chunks of whole problems that reuse it in turn, as in device pointer
+ * mode (see gemm_device.h); a problem larger than that is a chunk of one. A
+ * chunk is also kept to stride * batch within the unsigned int sizes Tensile
+ * takes. The grouped and bfloat16 routines chunk their scratch the same way.
+ ******************************************************************************/
+#define GEMM_BATCHED_DIM_X 16
+#define GEMM_BATCHED_DIM_Y 16
+#define GEMM_BATCHED_MAX_WORKSPACE (size_t(64) << 20)
+
+template <typename T>
+__global__ void gemm_batched_gather_kernel(
+    rocblas_int rows, rocblas_int cols, const T* const* X, rocblas_int ld, T* W)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
+
+    if(tx < rows && ty < cols)
+        W[tx + size_t(rows) * (ty + cols * batch)] = X[batch][tx + size_t(ld) * ty];
+}
+
+// bytes of scratch for W, followed by the packed A and B; W comes first so
+// that each part stays aligned for its type
+template <typename Ti, typename To>
+size_t gemm_batched_workspace_size(rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   rocblas_int batch_count)
+{
+    return (size_t(m) * n * sizeof(To) + (size_t(m) * k + size_t(k) * n) * sizeof(Ti)) *
+           batch_count;
+}
+
+// problems of a batch that run at once, from the bytes of scratch and the
+// largest packed matrix, in elements, of one problem; 0 if that matrix alone
+// is beyond the unsigned int sizes of Tensile
+inline rocblas_int
+    gemm_batched_chunk(size_t problem_bytes, size_t problem_extent, rocblas_int batch_count)
+{
+    if(problem_extent > UINT_MAX)
+        return 0;
+
+    size_t chunk = GEMM_BATCHED_MAX_WORKSPACE / std::max<size_t>(problem_bytes, 1);
+    chunk        = std::min<size_t>(chunk, UINT_MAX / std::max<size_t>(problem_extent, 1));
+    chunk        = std::min<size_t>(chunk, batch_count);
+    return rocblas_int(std::max<size_t>(chunk, 1));
+}
+
+// chunk of the batched and grouped routines, whose problem is m x n x k
+template <typename Ti, typename To>
+rocblas_int gemm_batched_chunk(rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int batch_count)
+{
+    size_t extent = std::max({size_t(m) * n, size_t(m) * k, size_t(k) * n});
+    return gemm_batched_chunk(
+        gemm_batched_workspace_size<Ti, To>(m, n, k, 1), extent, batch_count);
+}
+
+template <typename T>
+hipError_t gemm_batched_gather(rocblas_handle handle,
+                               rocblas_int rows,
+                               rocblas_int cols,
+                               rocblas_int batch_count,
+                               const T* const* X,
+                               rocblas_int ld,
+                               T* W)
+{
+    rocblas_int blocksX = (rows - 1) / GEMM_BATCHED_DIM_X + 1;
+    rocblas_int blocksY = (cols - 1) / GEMM_BATCHED_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_BATCHED_DIM_X, GEMM_BATCHED_DIM_Y, 1);
+
+    hipLaunchKernelGGL(gemm_batched_gather_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       rows,
+                       cols,
+                       X,
+                       ld,
+                       W);
+
+    return hipGetLastError();
+}
+
+// alpha and beta are read as the handle's pointer mode says
+template <typename Tc, typename To>
+hipError_t gemm_batched_scatter(rocblas_handle handle,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int batch_count,
+                                const Tc* alpha,
+                                const To* W,
+                                const Tc* beta,
+                                const To* const* C,
+                                rocblas_int ldc,
+                                To* const* D,
+                                rocblas_int ldd)
+{
+    return gemm_finish(
+        handle, m, n, batch_count, 1, alpha, W, beta, gemm_finish_pointers<To>{C, ldc, D, ldd});
+}
+
+#endif
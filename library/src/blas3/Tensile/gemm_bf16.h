@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_BF16_H
+#define GEMM_BF16_H
+#include <hip/hip_runtime.h>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * bfloat16 gemm
+ *
+ * The Tensile library built here has no bfloat16 kernels. A bfloat16 is the
+ * upper half of a float, so widening A and B to float is exact, and a single
+ * precision Tensile launch over the widened copies computes what a bfloat16
+ * kernel accumulating in float would. A and B are widened into packed slabs
+ * W_A and W_B, the product goes with alpha = 1 and beta = 0 into W, in the
+ * slices of gemm_split_k.h when k is split, and gemm_finish.h forms D in
+ * float, rounding to nearest even when C and D are bfloat16.
+ ******************************************************************************/
+#define GEMM_BF16_DIM_X 16
+#define GEMM_BF16_DIM_Y 16
+
+__host__ __device__ inline float rocblas_bfloat16_to_float(rocblas_bfloat16 x)
+{
+    union
+    {
+        uint32_t u;
+        float f;
+    } v = {uint32_t(x.data) << 16};
+    return v.f;
+}
+
+// round to nearest even; NaN stays a quiet NaN of the same sign
+__host__ __device__ inline rocblas_bfloat16 rocblas_float_to_bfloat16(float x)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } v = {x};
+
+    rocblas_bfloat16 r;
+    if((v.u & 0x7f800000) == 0x7f800000 && (v.u & 0x7fffff))
+        r.data = uint16_t(v.u >> 16) | 0x40;
+    else
+        r.data = uint16_t((v.u + 0x7fff + ((v.u >> 16) & 1)) >> 16);
+    return r;
+}
+
+__device__ inline float gemm_bf16_load(float x) { return x; }
+__device__ inline float gemm_bf16_load(rocblas_bfloat16 x) { return rocblas_bfloat16_to_float(x); }
+
+template <typename To>
+__device__ To gemm_bf16_round(float x);
+
+template <>
+__device__ inline float gemm_bf16_round<float>(float x)
+{
+    return x;
+}
+
+template <>
+__device__ inline rocblas_bfloat16 gemm_bf16_round<rocblas_bfloat16>(float x)
+{
+    return rocblas_float_to_bfloat16(x);
+}
+
+// widen a rows x cols x batch_count matrix into a packed float slab
+template <typename Ti>
+__global__ void gemm_bf16_widen_kernel(rocblas_int rows,
+                                       rocblas_int cols,
+                                       const Ti* __restrict__ X,
+                                       rocblas_int ld,
+                                       rocblas_int stride,
+                                       float* __restrict__ W)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
+
+    if(tx < rows && ty < cols)
+        W[tx + size_t(rows) * (ty + cols * batch)] =
+            gemm_bf16_load(X[tx + size_t(ld) * ty + stride * batch]);
+}
+
+// bfloat16 C is widened to float and D rounded back
+struct gemm_bf16_convert
+{
+    template <typename Tc, typename T>
+    static __device__ Tc load(T x)
+    {
+        return gemm_bf16_load(x);
+    }
+
+    template <typename T, typename Tc>
+    static __device__ T store(Tc x)
+    {
+        return gemm_bf16_round<T>(x);
+    }
+};
+
+template <typename Ti>
+hipError_t gemm_bf16_widen(rocblas_handle handle,
+                           rocblas_int rows,
+                           rocblas_int cols,
+                           rocblas_int batch_count,
+                           const Ti* X,
+                           rocblas_int ld,
+                           rocblas_int stride,
+                           float* W)
+{
+    rocblas_int blocksX = (rows - 1) / GEMM_BF16_DIM_X + 1;
+    rocblas_int blocksY = (cols - 1) / GEMM_BF16_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_BF16_DIM_X, GEMM_BF16_DIM_Y, 1);
+
+    hipLaunchKernelGGL((gemm_bf16_widen_kernel<Ti>),
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       rows,
+                       cols,
+                       X,
+                       ld,
+                       stride,
+                       W);
+
+    return hipGetLastError();
+}
+
+// alpha and beta are read as the handle's pointer mode says
+template <typename To>
+hipError_t gemm_bf16_store(rocblas_handle handle,
+                           rocblas_int m,
+                           rocblas_int n,
+                           rocblas_int batch_count,
+                           rocblas_int slices,
+                           const float* alpha,
+                           const float* W,
+                           const float* beta,
+                           const To* C,
+                           rocblas_int ldc,
+                           rocblas_int stride_c,
+                           To* D,
+                           rocblas_int ldd,
+                           rocblas_int stride_d)
+{
+    return gemm_finish(handle,
+                       m,
+                       n,
+                       batch_count,
+                       slices,
+                       alpha,
+                       W,
+                       beta,
+                       gemm_finish_strided<To, gemm_bf16_convert>{
+                           C, ldc, stride_c, D, ldd, stride_d});
+}
+
+#endif
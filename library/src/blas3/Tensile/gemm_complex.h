@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_COMPLEX_H
+#define GEMM_COMPLEX_H
+#include <hip/hip_runtime.h>
+#include "rocblas.h"
+#include "handle.h"
+
+/*******************************************************************************
+ * Complex gemm from real gemm
+ *
+ * Tensile ships no complex problem types, so cgemm and zgemm split A and B
+ * into planar real and imaginary parts in scratch memory and form the complex
+ * product from real Tensile products of the planar matrices:
+ *
+ *   4M: P1 = Ar*Br - Ai*Bi, P2 = Ar*Bi + Ai*Br
+ *       re = P1, im = P2
+ *   3M: P1 = Ar*Br, P2 = Ai*Bi, P3 = (Ar + Ai)*(Br + Bi)
+ *       re = P1 - P2, im = P3 - P1 - P2
+ *
+ * gemm_complex_combine_* then computes C = alpha * (re, im) + beta * C.
+ * Conjugate transposes are applied while splitting, so the real products only
+ * see none or transpose. The planar copies keep A and B in their stored
+ * layout, packed with leading dimension rows and batch stride rows * cols.
+ ******************************************************************************/
+#define GEMM_COMPLEX_DIM_X 16
+#define GEMM_COMPLEX_DIM_Y 16
+
+// split X into Xr and Xi, negating Xi if conj; Xs = Xr + Xi when not null (3M)
+template <typename T, typename Tr>
+__global__ void gemm_complex_split_kernel(rocblas_int rows,
+                                          rocblas_int cols,
+                                          const T* X,
+                                          rocblas_int ld,
+                                          rocblas_int stride,
+                                          bool conj,
+                                          Tr* Xr,
+                                          Tr* Xi,
+                                          Tr* Xs)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
+
+    if(tx < rows && ty < cols)
+    {
+        T x      = X[tx + size_t(ld) * ty + stride * batch];
+        Tr re    = x.x;
+        Tr im    = conj ? -x.y : x.y;
+        size_t i = tx + size_t(rows) * (ty + cols * batch);
+
+        Xr[i] = re;
+        Xi[i] = im;
+        if(Xs)
+            Xs[i] = re + im;
+    }
+}
+
+template <typename T, typename Tr>
+__device__ void gemm_complex_combine_element(rocblas_int m,
+                                             rocblas_int n,
+                                             const Tr* P1,
+                                             const Tr* P2,
+                                             const Tr* P3,
+                                             T alpha,
+                                             T beta,
+                                             T* C,
+                                             rocblas_int ldc,
+                                             rocblas_int stride_c)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
+
+    if(tx < m && ty < n)
+    {
+        size_t i = tx + size_t(m) * (ty + n * batch);
+        Tr re, im;
+        if(P3)
+        {
+            re = P1[i] - P2[i];
+            im = P3[i] - P1[i] - P2[i];
+        }
+        else
+        {
+            re = P1[i];
+            im = P2[i];
+        }
+
+        T value;
+        value.x = alpha.x * re - alpha.y * im;
+        value.y = alpha.x * im + alpha.y * re;
+
+        T* c = C + tx + size_t(ldc) * ty + stride_c * batch;
+
+        // C is left unread when beta is 0, as in gemm_finish.h
+        if(beta.x != 0 || beta.y != 0)
+        {
+            T old = *c;
+            value.x += beta.x * old.x - beta.y * old.y;
+            value.y += beta.x * old.y + beta.y * old.x;
+        }
+        *c = value;
+    }
+}
+
+template <typename T, typename Tr>
+__global__ void gemm_complex_combine_host_scalar(rocblas_int m,
+                                                 rocblas_int n,
+                                                 const Tr* P1,
+                                                 const Tr* P2,
+                                                 const Tr* P3,
+                                                 T alpha,
+                                                 T beta,
+                                                 T* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_int stride_c)
+{
+    gemm_complex_combine_element(m, n, P1, P2, P3, alpha, beta, C, ldc, stride_c);
+}
+
+template <typename T, typename Tr>
+__global__ void gemm_complex_combine_device_scalar(rocblas_int m,
+                                                   rocblas_int n,
+                                                   const Tr* P1,
+                                                   const Tr* P2,
+                                                   const Tr* P3,
+                                                   const T* alpha,
+                                                   const T* beta,
+                                                   T* C,
+                                                   rocblas_int ldc,
+                                                   rocblas_int stride_c)
+{
+    gemm_complex_combine_element(m, n, P1, P2, P3, *alpha, *beta, C, ldc, stride_c);
+}
+
+// number of planar copies of each of A, B and the products
+inline size_t gemm_complex_parts(rocblas_handle handle)
+{
+    return rocblas_complex_gemm_mode_3m == handle->complex_gemm_mode ? 3 : 2;
+}
+
+// bytes of scratch for the planar copies of A and B and the real products
+template <typename Tr>
+size_t gemm_complex_workspace_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int batch_count)
+{
+    return gemm_complex_parts(handle) * (size_t(m) * k + size_t(k) * n + size_t(m) * n) *
+           batch_count * sizeof(Tr);
+}
+
+template <typename T, typename Tr>
+hipError_t gemm_complex_split(rocblas_handle handle,
+                              rocblas_int rows,
+                              rocblas_int cols,
+                              rocblas_int batch_count,
+                              const T* X,
+                              rocblas_int ld,
+                              rocblas_int stride,
+                              bool conj,
+                              Tr* Xr,
+                              Tr* Xi,
+                              Tr* Xs)
+{
+    rocblas_int blocksX = (rows - 1) / GEMM_COMPLEX_DIM_X + 1;
+    rocblas_int blocksY = (cols - 1) / GEMM_COMPLEX_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_COMPLEX_DIM_X, GEMM_COMPLEX_DIM_Y, 1);
+
+    hipLaunchKernelGGL((gemm_complex_split_kernel<T, Tr>),
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       rows,
+                       cols,
+                       X,
+                       ld,
+                       stride,
+                       conj,
+                       Xr,
+                       Xi,
+                       Xs);
+
+    return hipGetLastError();
+}
+
+// P3 is null for 4M; alpha and beta are read as the handle's pointer mode says
+template <typename T, typename Tr>
+hipError_t gemm_complex_combine(rocblas_handle handle,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int batch_count,
+                                const Tr* P1,
+                                const Tr* P2,
+                                const Tr* P3,
+                                const T* alpha,
+                                const T* beta,
+                                T* C,
+                                rocblas_int ldc,
+                                rocblas_int stride_c)
+{
+    rocblas_int blocksX = (m - 1) / GEMM_COMPLEX_DIM_X + 1;
+    rocblas_int blocksY = (n - 1) / GEMM_COMPLEX_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_COMPLEX_DIM_X, GEMM_COMPLEX_DIM_Y, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((gemm_complex_combine_device_scalar<T, Tr>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           m,
+                           n,
+                           P1,
+                           P2,
+                           P3,
+                           alpha,
+                           beta,
+                           C,
+                           ldc,
+                           stride_c);
+    }
+    else
+    {
+        hipLaunchKernelGGL((gemm_complex_combine_host_scalar<T, Tr>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           m,
+                           n,
+                           P1,
+                           P2,
+                           P3,
+                           *alpha,
+                           *beta,
+                           C,
+                           ldc,
+                           stride_c);
+    }
+
+    return hipGetLastError();
+}
+
+#endif
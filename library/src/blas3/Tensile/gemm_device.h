@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_DEVICE_H
+#define GEMM_DEVICE_H
+#include <hip/hip_runtime.h>
+#include <cstdint>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * Device pointer mode
+ *
+ * Tensile takes alpha and beta by value, and copying them to the host would
+ * block until the work queued before the gemm is done. Instead the product is
+ * computed with alpha = 1 and beta = 0 into a scratch matrix W, and
+ * gemm_finish.h applies the scalars where they are, in stream order.
+ *
+ * W holds at most GEMM_DEVICE_POINTER_MAX_WORKSPACE bytes, so the problem runs
+ * as chunks of whole matrices of the batch, or of columns or rows of one
+ * matrix when a matrix alone is larger, that reuse it in turn. That is the
+ * device memory a size query started with rocblas_start_device_memory_size_query
+ * reports for the gemm in device pointer mode: m x n x batch_count elements,
+ * capped at GEMM_DEVICE_POINTER_MAX_WORKSPACE bytes.
+ ******************************************************************************/
+#define GEMM_DEVICE_POINTER_MAX_WORKSPACE (size_t(32) << 20)
+
+// the part of an m x n x batch_count product that W holds at once: batches
+// whole matrices; or columns of one matrix when batches is 1; or rows of one
+// column when columns is 1 too
+struct gemm_device_pointer_plan
+{
+    rocblas_int rows    = 1;
+    rocblas_int columns = 1;
+    rocblas_int batches = 1;
+};
+
+inline gemm_device_pointer_plan gemm_device_pointer_choose(int64_t m,
+                                                           int64_t n,
+                                                           int64_t batch_count,
+                                                           size_t elem_size)
+{
+    gemm_device_pointer_plan plan;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return plan;
+
+    int64_t limit = GEMM_DEVICE_POINTER_MAX_WORKSPACE / elem_size;
+    if(m > limit)
+    {
+        plan.rows = rocblas_int(limit);
+        return plan;
+    }
+
+    plan.rows       = rocblas_int(m);
+    int64_t columns = limit / m;
+    if(columns < n)
+    {
+        plan.columns = rocblas_int(columns);
+        return plan;
+    }
+
+    int64_t batches = columns / n;
+    plan.columns    = rocblas_int(n);
+    plan.batches    = rocblas_int(batches < batch_count ? batches : batch_count);
+    return plan;
+}
+
+// bytes of scratch for W, 0 in host pointer mode
+inline size_t gemm_device_pointer_workspace_size(rocblas_handle handle,
+                                                 int64_t m,
+                                                 int64_t n,
+                                                 int64_t batch_count,
+                                                 size_t elem_size)
+{
+    if(rocblas_pointer_mode_device != handle->pointer_mode || m <= 0 || n <= 0 ||
+       batch_count <= 0)
+        return 0;
+
+    gemm_device_pointer_plan plan = gemm_device_pointer_choose(m, n, batch_count, elem_size);
+    return size_t(plan.rows) * plan.columns * plan.batches * elem_size;
+}
+
+// zero a scratch matrix, in stream order
+inline hipError_t gemm_device_pointer_clear(rocblas_handle handle, void* W, size_t size)
+{
+    return hipMemsetAsync(W, 0, size, handle->rocblas_stream);
+}
+
+template <typename Tc, typename To>
+hipError_t gemm_device_pointer_scale(rocblas_handle handle,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int batch_count,
+                                     const Tc* alpha,
+                                     const To* W,
+                                     const Tc* beta,
+                                     const To* C,
+                                     int64_t ldc,
+                                     int64_t stride_c,
+                                     To* D,
+                                     int64_t ldd,
+                                     int64_t stride_d)
+{
+    return gemm_finish_launch<Tc>(handle,
+                                  m,
+                                  n,
+                                  batch_count,
+                                  1,
+                                  gemm_finish_device_scalars<Tc>{alpha, beta},
+                                  W,
+                                  gemm_finish_strided<To>{C, ldc, stride_c, D, ldd, stride_d});
+}
+
+#endif
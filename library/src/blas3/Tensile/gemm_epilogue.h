@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_EPILOGUE_H
+#define GEMM_EPILOGUE_H
+#include <hip/hip_runtime.h>
+#include <type_traits>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * Fused gemm epilogue
+ *
+ * Tensile stores its product with alpha = 1 and beta = 0 into a scratch matrix
+ * W, in as many slices as gemm_split_k.h split k into, and gemm_finish.h sums
+ * the slices and finishes D in the same pass, through gemm_epilogue_output:
+ *
+ *   aux = alpha * sum(W[s]) + beta * C + bias
+ *   D   = activation(aux)
+ *
+ * so a bias, an activation and a narrower D cost no pass over D of their own.
+ * aux keeps the value before the activation, in the type of C, for callers
+ * that need it later, e.g. for the gradient of the activation.
+ ******************************************************************************/
+// rocblas_gemm_epilogue with its pointers typed
+template <typename To>
+struct gemm_epilogue_args
+{
+    rocblas_bias_mode bias_mode;
+    const To* bias;
+    rocblas_activation activation;
+    To* aux;
+    rocblas_int ld_aux;
+};
+
+// half and integer values are activated in float
+template <typename T>
+__device__ T gemm_epilogue_activate(T x, rocblas_activation activation)
+{
+    typedef typename std::conditional<std::is_same<T, double>{}, double, float>::type Tf;
+
+    if(activation == rocblas_activation_relu)
+        return x > T(0) ? x : T(0);
+
+    if(activation == rocblas_activation_gelu)
+    {
+        Tf v = static_cast<Tf>(x);
+        Tf t = tanh(Tf(0.7978845608028654) * (v + Tf(0.044715) * v * v * v));
+        return static_cast<T>(Tf(0.5) * v * (Tf(1) + t));
+    }
+
+    return x;
+}
+
+// C and D may be the same matrix when To and Td are the same type
+template <typename To, typename Td>
+struct gemm_epilogue_output
+{
+    const To* C;
+    rocblas_int ldc;
+    Td* D;
+    rocblas_int ldd;
+    gemm_epilogue_args<To> epilogue;
+
+    __device__ bool contains(rocblas_int, rocblas_int, size_t) const { return true; }
+
+    template <typename Tc>
+    __device__ Tc load(rocblas_int i, rocblas_int j, size_t) const
+    {
+        return static_cast<Tc>(C[i + size_t(ldc) * j]);
+    }
+
+    template <typename Tc>
+    __device__ void store(rocblas_int i, rocblas_int j, size_t, Tc value) const
+    {
+        if(epilogue.bias_mode == rocblas_bias_row)
+            value += static_cast<Tc>(epilogue.bias[i]);
+        else if(epilogue.bias_mode == rocblas_bias_column)
+            value += static_cast<Tc>(epilogue.bias[j]);
+
+        if(epilogue.aux)
+            epilogue.aux[i + size_t(epilogue.ld_aux) * j] = static_cast<To>(value);
+
+        D[i + size_t(ldd) * j] = static_cast<Td>(gemm_epilogue_activate(value, epilogue.activation));
+    }
+};
+
+// alpha and beta are read as the handle's pointer mode says
+template <typename Tc, typename To, typename Td>
+hipError_t gemm_epilogue_apply(rocblas_handle handle,
+                               rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int slices,
+                               const Tc* alpha,
+                               const To* W,
+                               const Tc* beta,
+                               const To* C,
+                               rocblas_int ldc,
+                               Td* D,
+                               rocblas_int ldd,
+                               const gemm_epilogue_args<To>& epilogue)
+{
+    return gemm_finish(handle,
+                       m,
+                       n,
+                       1,
+                       slices,
+                       alpha,
+                       W,
+                       beta,
+                       gemm_epilogue_output<To, Td>{C, ldc, D, ldd, epilogue});
+}
+
+#endif
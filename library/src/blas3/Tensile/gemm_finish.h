@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_FINISH_H
+#define GEMM_FINISH_H
+#include <hip/hip_runtime.h>
+#include <cstdint>
+#include "rocblas.h"
+#include "handle.h"
+
+/*******************************************************************************
+ * Finishing a gemm from a scratch product
+ *
+ * Split-K, device pointer mode, the batched and grouped routines, bfloat16 and
+ * the epilogue have Tensile store its product with alpha = 1 and beta = 0 into
+ * a packed scratch matrix W, m x n x slices per batch, and then form
+ *
+ *   D = alpha * sum(W[s]) + beta * C
+ *
+ * in the compute type Tc. gemm_finish_kernel does that for all of them. A
+ * scalar source S says where alpha and beta are, and an output O says where C
+ * and D are and how their elements convert to and from Tc:
+ *
+ *   S::alpha(out, batch), S::beta(out, batch)
+ *   O::contains(i, j, batch)        element (i, j) of W belongs to D
+ *   O::load<Tc>(i, j, batch)        element of C
+ *   O::store(i, j, batch, value)    element of D
+ *
+ * C is not read when beta is 0, so NaN in C does not propagate. C and D may
+ * be the same matrix.
+ ******************************************************************************/
+#define GEMM_FINISH_DIM_X 16
+#define GEMM_FINISH_DIM_Y 16
+
+// alpha and beta by value, in host pointer mode
+template <typename Tc>
+struct gemm_finish_host_scalars
+{
+    Tc alpha_value;
+    Tc beta_value;
+
+    template <typename O>
+    __device__ Tc alpha(const O&, size_t) const
+    {
+        return alpha_value;
+    }
+
+    template <typename O>
+    __device__ Tc beta(const O&, size_t) const
+    {
+        return beta_value;
+    }
+};
+
+// alpha and beta in device memory, in device pointer mode
+template <typename Tc>
+struct gemm_finish_device_scalars
+{
+    const Tc* alpha_ptr;
+    const Tc* beta_ptr;
+
+    template <typename O>
+    __device__ Tc alpha(const O&, size_t) const
+    {
+        return *alpha_ptr;
+    }
+
+    template <typename O>
+    __device__ Tc beta(const O&, size_t) const
+    {
+        return *beta_ptr;
+    }
+};
+
+// C and D elements converted with static_cast
+struct gemm_finish_cast
+{
+    template <typename Tc, typename T>
+    static __device__ Tc load(T x)
+    {
+        return static_cast<Tc>(x);
+    }
+
+    template <typename T, typename Tc>
+    static __device__ T store(Tc x)
+    {
+        return static_cast<T>(x);
+    }
+};
+
+// C and D a batch stride apart
+template <typename To, typename Convert = gemm_finish_cast>
+struct gemm_finish_strided
+{
+    const To* C;
+    int64_t ldc;
+    int64_t stride_c;
+    To* D;
+    int64_t ldd;
+    int64_t stride_d;
+
+    __device__ bool contains(rocblas_int, rocblas_int, size_t) const { return true; }
+
+    template <typename Tc>
+    __device__ Tc load(rocblas_int i, rocblas_int j, size_t batch) const
+    {
+        return Convert::template load<Tc>(C[i + size_t(ldc) * j + stride_c * batch]);
+    }
+
+    template <typename Tc>
+    __device__ void store(rocblas_int i, rocblas_int j, size_t batch, Tc value) const
+    {
+        D[i + size_t(ldd) * j + stride_d * batch] = Convert::template store<To>(value);
+    }
+};
+
+// C and D through device arrays of matrix pointers
+template <typename To>
+struct gemm_finish_pointers
+{
+    const To* const* C;
+    rocblas_int ldc;
+    To* const* D;
+    rocblas_int ldd;
+
+    __device__ bool contains(rocblas_int, rocblas_int, size_t) const { return true; }
+
+    template <typename Tc>
+    __device__ Tc load(rocblas_int i, rocblas_int j, size_t batch) const
+    {
+        return static_cast<Tc>(C[batch][i + size_t(ldc) * j]);
+    }
+
+    template <typename Tc>
+    __device__ void store(rocblas_int i, rocblas_int j, size_t batch, Tc value) const
+    {
+        D[batch][i + size_t(ldd) * j] = static_cast<To>(value);
+    }
+};
+
+template <typename Tc, typename Tw, typename S, typename O>
+__global__ void gemm_finish_kernel(
+    rocblas_int m, rocblas_int n, rocblas_int slices, S scalars, const Tw* __restrict__ W, O out)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
+
+    if(tx < m && ty < n && out.contains(tx, ty, batch))
+    {
+        Tc sum = 0;
+        for(rocblas_int s = 0; s < slices; s++)
+            sum += static_cast<Tc>(W[tx + size_t(m) * (ty + size_t(n) * (s + slices * batch))]);
+
+        Tc value = scalars.alpha(out, batch) * sum;
+        Tc beta  = scalars.beta(out, batch);
+
+        if(beta != 0)
+            value += beta * out.template load<Tc>(tx, ty, batch);
+
+        out.store(tx, ty, batch, value);
+    }
+}
+
+template <typename Tc, typename Tw, typename S, typename O>
+hipError_t gemm_finish_launch(rocblas_handle handle,
+                              rocblas_int m,
+                              rocblas_int n,
+                              rocblas_int batch_count,
+                              rocblas_int slices,
+                              const S& scalars,
+                              const Tw* W,
+                              const O& out)
+{
+    rocblas_int blocksX = (m - 1) / GEMM_FINISH_DIM_X + 1;
+    rocblas_int blocksY = (n - 1) / GEMM_FINISH_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_FINISH_DIM_X, GEMM_FINISH_DIM_Y, 1);
+
+    hipLaunchKernelGGL((gemm_finish_kernel<Tc, Tw, S, O>),
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       m,
+                       n,
+                       slices,
+                       scalars,
+                       W,
+                       out);
+
+    return hipGetLastError();
+}
+
+// alpha and beta are read as the handle's pointer mode says
+template <typename Tc, typename Tw, typename O>
+hipError_t gemm_finish(rocblas_handle handle,
+                       rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int batch_count,
+                       rocblas_int slices,
+                       const Tc* alpha,
+                       const Tw* W,
+                       const Tc* beta,
+                       const O& out)
+{
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        return gemm_finish_launch<Tc>(handle,
+                                      m,
+                                      n,
+                                      batch_count,
+                                      slices,
+                                      gemm_finish_device_scalars<Tc>{alpha, beta},
+                                      W,
+                                      out);
+
+    return gemm_finish_launch<Tc>(
+        handle, m, n, batch_count, slices, gemm_finish_host_scalars<Tc>{*alpha, *beta}, W, out);
+}
+
+#endif
@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_GROUPED_H
+#define GEMM_GROUPED_H
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <vector>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * Grouped gemm
+ *
+ * A group is group_size problems sharing transposes, sizes and leading
+ * dimensions; groups differ from each other. Groups with the same transposes
+ * and k are put in buckets, and each bucket runs as one strided batched
+ * Tensile launch of the largest m and n in the bucket, so it gets one
+ * solution lookup and one launch however many groups it holds. As in
+ * gemm_batched.h, the matrices are gathered into packed slabs, here padded
+ * with zeros to the bucket's m and n, and gemm_finish.h scatters the product
+ * back through the C and D pointer arrays, skipping the padding.
+ *
+ * A group only joins a bucket while the padded work of the bucket stays within
+ * GEMM_GROUPED_WASTE of the work its groups ask for, so very different sizes
+ * still run apart. The group descriptors of a bucket are passed to the
+ * kernels as arguments, which bounds a bucket to GEMM_GROUPED_MAX_BUCKET
+ * groups. A bucket whose scratch is too large runs in chunks of its problems,
+ * as in gemm_batched.h, each with the groups it covers.
+ ******************************************************************************/
+#define GEMM_GROUPED_DIM_X 16
+#define GEMM_GROUPED_DIM_Y 16
+#define GEMM_GROUPED_MAX_BUCKET 32
+#define GEMM_GROUPED_WASTE 1.25
+
+// one group of a bucket, as the kernels see it
+struct gemm_grouped_group
+{
+    rocblas_int first; // first problem of the group in the bucket's launch
+    rocblas_int index; // first problem of the group in the pointer arrays
+    rocblas_int group; // index of the group in the caller's arrays
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int rows[2]; // stored A (0) and B (1)
+    rocblas_int cols[2];
+    rocblas_int ld[2];
+    rocblas_int ldc;
+    rocblas_int ldd;
+};
+
+// alpha and beta are only filled in host pointer mode
+template <typename Tc>
+struct gemm_grouped_bucket
+{
+    rocblas_int count;
+    gemm_grouped_group group[GEMM_GROUPED_MAX_BUCKET];
+    Tc alpha[GEMM_GROUPED_MAX_BUCKET];
+    Tc beta[GEMM_GROUPED_MAX_BUCKET];
+};
+
+// groups of the caller that run as one launch, and the padded sizes of it
+struct gemm_grouped_plan
+{
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int k;
+    rocblas_int batch_count;
+    double work; // sum of m * n * group_size over the groups
+    std::vector<rocblas_int> groups;
+};
+
+// group of the problem-th problem of the bucket's launch
+template <typename Tc>
+__device__ rocblas_int gemm_grouped_find(const gemm_grouped_bucket<Tc>& bucket, rocblas_int problem)
+{
+    rocblas_int g = bucket.count - 1;
+    while(bucket.group[g].first > problem)
+        g--;
+    return g;
+}
+
+// operand is 0 for A and 1 for B
+template <typename T, typename Tc>
+__global__ void gemm_grouped_gather_kernel(rocblas_int rows,
+                                           rocblas_int cols,
+                                           gemm_grouped_bucket<Tc> bucket,
+                                           int operand,
+                                           const T* const* X,
+                                           T* W)
+{
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int z  = hipBlockIdx_z;
+
+    if(tx < rows && ty < cols)
+    {
+        const gemm_grouped_group& p = bucket.group[gemm_grouped_find(bucket, z)];
+
+        // zero padding keeps the padded part of the product finite
+        T x = 0;
+        if(tx < p.rows[operand] && ty < p.cols[operand])
+            x = X[p.index + z - p.first][tx + size_t(p.ld[operand]) * ty];
+
+        W[tx + size_t(rows) * (ty + size_t(cols) * z)] = x;
+    }
+}
+
+// C and D of the problems of a bucket, through the pointer arrays
+template <typename Tc, typename To>
+struct gemm_grouped_output
+{
+    gemm_grouped_bucket<Tc> bucket;
+    const To* const* C;
+    To* const* D;
+
+    __device__ const gemm_grouped_group& group(size_t problem) const
+    {
+        return bucket.group[gemm_grouped_find(bucket, problem)];
+    }
+
+    __device__ bool contains(rocblas_int i, rocblas_int j, size_t problem) const
+    {
+        const gemm_grouped_group& p = group(problem);
+        return i < p.m && j < p.n;
+    }
+
+    template <typename T>
+    __device__ T load(rocblas_int i, rocblas_int j, size_t problem) const
+    {
+        const gemm_grouped_group& p = group(problem);
+        return static_cast<T>(C[p.index + problem - p.first][i + size_t(p.ldc) * j]);
+    }
+
+    template <typename T>
+    __device__ void store(rocblas_int i, rocblas_int j, size_t problem, T value) const
+    {
+        const gemm_grouped_group& p = group(problem);
+        D[p.index + problem - p.first][i + size_t(p.ldd) * j] = static_cast<To>(value);
+    }
+};
+
+// alpha and beta of a problem's group, copied into the bucket in host pointer mode
+template <typename Tc>
+struct gemm_grouped_host_scalars
+{
+    template <typename To>
+    __device__ Tc alpha(const gemm_grouped_output<Tc, To>& out, size_t problem) const
+    {
+        return out.bucket.alpha[gemm_grouped_find(out.bucket, problem)];
+    }
+
+    template <typename To>
+    __device__ Tc beta(const gemm_grouped_output<Tc, To>& out, size_t problem) const
+    {
+        return out.bucket.beta[gemm_grouped_find(out.bucket, problem)];
+    }
+};
+
+// alpha and beta of a problem's group, in the caller's device arrays
+template <typename Tc>
+struct gemm_grouped_device_scalars
+{
+    const Tc* alpha_ptr;
+    const Tc* beta_ptr;
+
+    template <typename To>
+    __device__ Tc alpha(const gemm_grouped_output<Tc, To>& out, size_t problem) const
+    {
+        return alpha_ptr[out.group(problem).group];
+    }
+
+    template <typename To>
+    __device__ Tc beta(const gemm_grouped_output<Tc, To>& out, size_t problem) const
+    {
+        return beta_ptr[out.group(problem).group];
+    }
+};
+
+// Put the non-empty groups into buckets, in order of first group. Each group
+// goes to the first open bucket it fits without too much padding.
+inline std::vector<gemm_grouped_plan> gemm_grouped_buckets(rocblas_int group_count,
+                                                           const rocblas_operation* trans_a,
+                                                           const rocblas_operation* trans_b,
+                                                           const rocblas_int* m,
+                                                           const rocblas_int* n,
+                                                           const rocblas_int* k,
+                                                           const rocblas_int* group_size)
+{
+    std::vector<gemm_grouped_plan> plans;
+
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        if(m[g] == 0 || n[g] == 0 || group_size[g] == 0)
+            continue;
+
+        double work = double(m[g]) * n[g] * group_size[g];
+        bool placed = false;
+
+        for(auto& plan : plans)
+        {
+            if(plan.trans_a != trans_a[g] || plan.trans_b != trans_b[g] || plan.k != k[g] ||
+               plan.groups.size() == GEMM_GROUPED_MAX_BUCKET)
+                continue;
+
+            rocblas_int pad_m = std::max(plan.m, m[g]);
+            rocblas_int pad_n = std::max(plan.n, n[g]);
+            double padded     = double(pad_m) * pad_n * (plan.batch_count + group_size[g]);
+            if(padded > GEMM_GROUPED_WASTE * (plan.work + work))
+                continue;
+
+            plan.m = pad_m;
+            plan.n = pad_n;
+            plan.batch_count += group_size[g];
+            plan.work += work;
+            plan.groups.push_back(g);
+            placed = true;
+            break;
+        }
+
+        if(!placed)
+        {
+            gemm_grouped_plan plan;
+            plan.trans_a     = trans_a[g];
+            plan.trans_b     = trans_b[g];
+            plan.m           = m[g];
+            plan.n           = n[g];
+            plan.k           = k[g];
+            plan.batch_count = group_size[g];
+            plan.work        = work;
+            plan.groups.push_back(g);
+            plans.push_back(plan);
+        }
+    }
+
+    return plans;
+}
+
+// the problems [begin, begin + count) of a bucket of batch_count problems, as a
+// bucket of their own: the groups they cover, with first and index moved to
+// the chunk's first problem
+template <typename Tc>
+gemm_grouped_bucket<Tc> gemm_grouped_chunk(const gemm_grouped_bucket<Tc>& bucket,
+                                           rocblas_int batch_count,
+                                           rocblas_int begin,
+                                           rocblas_int count)
+{
+    gemm_grouped_bucket<Tc> chunk = bucket;
+    chunk.count                   = 0;
+
+    for(rocblas_int i = 0; i < bucket.count; i++)
+    {
+        rocblas_int first = bucket.group[i].first;
+        rocblas_int end   = i + 1 < bucket.count ? bucket.group[i + 1].first : batch_count;
+        if(end <= begin || first >= begin + count)
+            continue;
+
+        rocblas_int skip = std::max(begin - first, 0);
+
+        gemm_grouped_group& p = chunk.group[chunk.count];
+        p                     = bucket.group[i];
+        p.first               = first + skip - begin;
+        p.index               = p.index + skip;
+
+        chunk.alpha[chunk.count] = bucket.alpha[i];
+        chunk.beta[chunk.count]  = bucket.beta[i];
+        chunk.count++;
+    }
+    return chunk;
+}
+
+template <typename T, typename Tc>
+hipError_t gemm_grouped_gather(rocblas_handle handle,
+                               rocblas_int rows,
+                               rocblas_int cols,
+                               rocblas_int batch_count,
+                               const gemm_grouped_bucket<Tc>& bucket,
+                               int operand,
+                               const T* const* X,
+                               T* W)
+{
+    rocblas_int blocksX = (rows - 1) / GEMM_GROUPED_DIM_X + 1;
+    rocblas_int blocksY = (cols - 1) / GEMM_GROUPED_DIM_Y + 1;
+
+    dim3 grid(blocksX, blocksY, batch_count);
+    dim3 threads(GEMM_GROUPED_DIM_X, GEMM_GROUPED_DIM_Y, 1);
+
+    hipLaunchKernelGGL((gemm_grouped_gather_kernel<T, Tc>),
+                       grid,
+                       threads,
+                       0,
+                       handle->rocblas_stream,
+                       rows,
+                       cols,
+                       bucket,
+                       operand,
+                       X,
+                       W);
+
+    return hipGetLastError();
+}
+
+// alpha and beta are read as the handle's pointer mode says; in host pointer
+// mode they were copied into the bucket
+template <typename Tc, typename To>
+hipError_t gemm_grouped_scatter(rocblas_handle handle,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int batch_count,
+                                const gemm_grouped_bucket<Tc>& bucket,
+                                const Tc* alpha,
+                                const To* W,
+                                const Tc* beta,
+                                const To* const* C,
+                                To* const* D)
+{
+    gemm_grouped_output<Tc, To> out = {bucket, C, D};
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+        return gemm_finish_launch<Tc>(
+            handle, m, n, batch_count, 1, gemm_grouped_device_scalars<Tc>{alpha, beta}, W, out);
+
+    return gemm_finish_launch<Tc>(
+        handle, m, n, batch_count, 1, gemm_grouped_host_scalars<Tc>(), W, out);
+}
+
+#endif
@@ -0,0 +1,451 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_SMALL_H
+#define GEMM_SMALL_H
+#include <hip/hip_runtime.h>
+#include <type_traits>
+#include "rocblas.h"
+#include "handle.h"
+#include "tensile_dispatch.h"
+
+/*******************************************************************************
+ * Small gemm
+ *
+ * A strided batched gemm of tiny matrices, e.g. a million 16 x 16 x 16
+ * products, runs one Tensile workgroup per matrix, and the smallest macro
+ * tiles of the Logic files are still larger than the whole output, so most of
+ * the threads and registers of every workgroup idle. gemm_small instead runs
+ * GEMM_SMALL_MATRICES matrices per workgroup, a team of GEMM_SMALL_TEAM
+ * threads per matrix. The teams of a workgroup stage chunks of GEMM_SMALL_KC
+ * columns of op(A) and rows of op(B) of all their matrices in LDS with
+ * coalesced loads, zero padded past m, n, k and the batch, and each thread
+ * accumulates a DIM_M / 4 x DIM_N / 4 block of the output in registers:
+ *
+ *   row tm + 4 * r, column tn + 4 * c of the team's matrix
+ *
+ * DIM_M and DIM_N are compile time size classes of 8, 16 or 32, the smallest
+ * at least m and n, so a kernel is instantiated per pair of classes, and k is
+ * looped over. Half products accumulate in float.
+ ******************************************************************************/
+#define GEMM_SMALL_THREADS 256
+
+// threads of a team along m and along n
+#define GEMM_SMALL_TEAM_DIM 4
+#define GEMM_SMALL_TEAM (GEMM_SMALL_TEAM_DIM * GEMM_SMALL_TEAM_DIM)
+#define GEMM_SMALL_MATRICES (GEMM_SMALL_THREADS / GEMM_SMALL_TEAM)
+
+// largest m, n and k gemm_small runs
+#define GEMM_SMALL_MAX_DIM 32
+
+// k staged in LDS per step; double halves it to keep LDS at 32 KB
+#define GEMM_SMALL_KC(T) (sizeof(T) > 4 ? 4 : 8)
+
+// fewest matrices gemm_small runs: with less than a workgroup of them, the
+// one workgroup per matrix of Tensile keeps more compute units busy
+#define GEMM_SMALL_MIN_BATCH GEMM_SMALL_MATRICES
+
+// true if an override or rocblas_gemm_ex_tune picked a Tensile solution for
+// the problem; they are keyed by sizes and device only. The false_type
+// overload, for the precisions without a dispatch entry, is never reached.
+template <typename Tt>
+bool gemm_small_solution_picked(rocblas_handle handle,
+                                rocblas_operation trans_a,
+                                rocblas_operation trans_b,
+                                rocblas_int m,
+                                rocblas_int n,
+                                rocblas_int k,
+                                rocblas_int batch_count,
+                                std::true_type)
+{
+    const tensile_entry<Tt, Tt, Tt>& tensile =
+        tensile_dispatch<Tt, Tt, Tt>::get(GetTransposeMode(trans_a, trans_b));
+    tensile_problem_key key =
+        tensile_make_problem_key(handle->device, 0, 0, 0, 0, 0, 0, m, n, batch_count, k);
+    return tensile_override_solution(tensile.problem_type(), key) != nullptr;
+}
+
+template <typename Tt>
+bool gemm_small_solution_picked(rocblas_handle,
+                                rocblas_operation,
+                                rocblas_operation,
+                                rocblas_int,
+                                rocblas_int,
+                                rocblas_int,
+                                rocblas_int,
+                                std::false_type)
+{
+    return true;
+}
+
+// true if gemm_small runs the problem instead of Tensile; only real
+// precisions are run, and a solution picked by index, by an override or by
+// rocblas_gemm_ex_tune is a Tensile one
+template <typename T>
+bool gemm_small_fits(rocblas_handle handle,
+                     rocblas_operation trans_a,
+                     rocblas_operation trans_b,
+                     rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int k,
+                     rocblas_int batch_count)
+{
+    typedef typename tensile_type<T>::type tensile_t;
+    typedef std::integral_constant<bool,
+                                   std::is_same<tensile_t, float>{} ||
+                                       std::is_same<tensile_t, double>{} ||
+                                       std::is_same<tensile_t, TensileHalf>{}>
+        real;
+
+    if(!real{} || handle->gemm_solution_index != -1)
+        return false;
+    if(m > GEMM_SMALL_MAX_DIM || n > GEMM_SMALL_MAX_DIM || k > GEMM_SMALL_MAX_DIM ||
+       batch_count < GEMM_SMALL_MIN_BATCH)
+        return false;
+
+    return !gemm_small_solution_picked<tensile_t>(
+        handle, trans_a, trans_b, m, n, k, batch_count, real{});
+}
+
+// size class of m or n
+inline rocblas_int gemm_small_dim(rocblas_int x) { return x <= 8 ? 8 : x <= 16 ? 16 : 32; }
+
+// type products accumulate in
+template <typename T>
+struct gemm_small_compute
+{
+    typedef T type;
+};
+
+template <>
+struct gemm_small_compute<TensileHalf>
+{
+    typedef float type;
+};
+
+// C is the output; it is not read when beta is 0
+template <typename T, typename Tc, rocblas_int DIM_M, rocblas_int DIM_N>
+__device__ void gemm_small_element(rocblas_operation trans_a,
+                                   rocblas_operation trans_b,
+                                   rocblas_int m,
+                                   rocblas_int n,
+                                   rocblas_int k,
+                                   Tc alpha,
+                                   const T* __restrict__ A,
+                                   rocblas_int lda,
+                                   rocblas_int stride_a,
+                                   const T* __restrict__ B,
+                                   rocblas_int ldb,
+                                   rocblas_int stride_b,
+                                   Tc beta,
+                                   T* C,
+                                   rocblas_int ldc,
+                                   rocblas_int stride_c,
+                                   rocblas_int batch)
+{
+    constexpr rocblas_int KC = GEMM_SMALL_KC(T);
+    constexpr rocblas_int RM = DIM_M / GEMM_SMALL_TEAM_DIM;
+    constexpr rocblas_int RN = DIM_N / GEMM_SMALL_TEAM_DIM;
+
+    __shared__ T sA[GEMM_SMALL_MATRICES][KC][DIM_M];
+    __shared__ T sB[GEMM_SMALL_MATRICES][KC][DIM_N];
+
+    rocblas_int tid   = hipThreadIdx_x;
+    rocblas_int team  = tid / GEMM_SMALL_TEAM;
+    rocblas_int tm    = tid % GEMM_SMALL_TEAM_DIM;
+    rocblas_int tn    = tid % GEMM_SMALL_TEAM / GEMM_SMALL_TEAM_DIM;
+    rocblas_int first = hipBlockIdx_x * GEMM_SMALL_MATRICES;
+
+    Tc acc[RM][RN];
+    for(rocblas_int r = 0; r < RM; r++)
+        for(rocblas_int c = 0; c < RN; c++)
+            acc[r][c] = 0;
+
+    // every team has the same k, so all threads of the workgroup reach the barriers
+    for(rocblas_int k0 = 0; k0 < k; k0 += KC)
+    {
+        // consecutive threads load consecutive elements of the stored matrices
+        for(rocblas_int e = tid; e < GEMM_SMALL_MATRICES * KC * DIM_M; e += GEMM_SMALL_THREADS)
+        {
+            rocblas_int mat = e / (KC * DIM_M);
+            rocblas_int i, l;
+            if(trans_a == rocblas_operation_none)
+            {
+                i = e % DIM_M;
+                l = e / DIM_M % KC;
+            }
+            else
+            {
+                l = e % KC;
+                i = e / KC % DIM_M;
+            }
+
+            T a = 0;
+            if(i < m && k0 + l < k && first + mat < batch)
+            {
+                const T* Ab = A + size_t(stride_a) * (first + mat);
+                a = trans_a == rocblas_operation_none ? Ab[i + size_t(lda) * (k0 + l)]
+                                                      : Ab[k0 + l + size_t(lda) * i];
+            }
+            sA[mat][l][i] = a;
+        }
+
+        for(rocblas_int e = tid; e < GEMM_SMALL_MATRICES * KC * DIM_N; e += GEMM_SMALL_THREADS)
+        {
+            rocblas_int mat = e / (KC * DIM_N);
+            rocblas_int j, l;
+            if(trans_b == rocblas_operation_none)
+            {
+                l = e % KC;
+                j = e / KC % DIM_N;
+            }
+            else
+            {
+                j = e % DIM_N;
+                l = e / DIM_N % KC;
+            }
+
+            T b = 0;
+            if(j < n && k0 + l < k && first + mat < batch)
+            {
+                const T* Bb = B + size_t(stride_b) * (first + mat);
+                b = trans_b == rocblas_operation_none ? Bb[k0 + l + size_t(ldb) * j]
+                                                      : Bb[j + size_t(ldb) * (k0 + l)];
+            }
+            sB[mat][l][j] = b;
+        }
+
+        __syncthreads();
+
+        for(rocblas_int l = 0; l < KC; l++)
+        {
+            Tc a[RM], b[RN];
+            for(rocblas_int r = 0; r < RM; r++)
+                a[r] = static_cast<Tc>(sA[team][l][tm + GEMM_SMALL_TEAM_DIM * r]);
+            for(rocblas_int c = 0; c < RN; c++)
+                b[c] = static_cast<Tc>(sB[team][l][tn + GEMM_SMALL_TEAM_DIM * c]);
+
+            for(rocblas_int r = 0; r < RM; r++)
+                for(rocblas_int c = 0; c < RN; c++)
+                    acc[r][c] += a[r] * b[c];
+        }
+
+        __syncthreads();
+    }
+
+    if(first + team >= batch)
+        return;
+
+    T* Cb = C + size_t(stride_c) * (first + team);
+    for(rocblas_int c = 0; c < RN; c++)
+    {
+        rocblas_int j = tn + GEMM_SMALL_TEAM_DIM * c;
+        for(rocblas_int r = 0; r < RM; r++)
+        {
+            rocblas_int i = tm + GEMM_SMALL_TEAM_DIM * r;
+            if(i < m && j < n)
+            {
+                Tc value = alpha * acc[r][c];
+
+                // C is left unread when beta is 0, as in gemm_finish.h
+                if(beta != 0)
+                    value += beta * static_cast<Tc>(Cb[i + size_t(ldc) * j]);
+
+                Cb[i + size_t(ldc) * j] = static_cast<T>(value);
+            }
+        }
+    }
+}
+
+template <typename T, typename Tc, rocblas_int DIM_M, rocblas_int DIM_N>
+__global__ void gemm_small_host_scalar(rocblas_operation trans_a,
+                                       rocblas_operation trans_b,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int k,
+                                       Tc alpha,
+                                       const T* __restrict__ A,
+                                       rocblas_int lda,
+                                       rocblas_int stride_a,
+                                       const T* __restrict__ B,
+                                       rocblas_int ldb,
+                                       rocblas_int stride_b,
+                                       Tc beta,
+                                       T* C,
+                                       rocblas_int ldc,
+                                       rocblas_int stride_c,
+                                       rocblas_int batch)
+{
+    gemm_small_element<T, Tc, DIM_M, DIM_N>(trans_a, trans_b, m, n, k, alpha, A, lda, stride_a,
+                                            B, ldb, stride_b, beta, C, ldc, stride_c, batch);
+}
+
+template <typename T, typename Tc, rocblas_int DIM_M, rocblas_int DIM_N>
+__global__ void gemm_small_device_scalar(rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int m,
+                                         rocblas_int n,
+                                         rocblas_int k,
+                                         const T* alpha,
+                                         const T* __restrict__ A,
+                                         rocblas_int lda,
+                                         rocblas_int stride_a,
+                                         const T* __restrict__ B,
+                                         rocblas_int ldb,
+                                         rocblas_int stride_b,
+                                         const T* beta,
+                                         T* C,
+                                         rocblas_int ldc,
+                                         rocblas_int stride_c,
+                                         rocblas_int batch)
+{
+    gemm_small_element<T, Tc, DIM_M, DIM_N>(trans_a,
+                                            trans_b,
+                                            m,
+                                            n,
+                                            k,
+                                            static_cast<Tc>(*alpha),
+                                            A,
+                                            lda,
+                                            stride_a,
+                                            B,
+                                            ldb,
+                                            stride_b,
+                                            static_cast<Tc>(*beta),
+                                            C,
+                                            ldc,
+                                            stride_c,
+                                            batch);
+}
+
+template <typename T, rocblas_int DIM_M, rocblas_int DIM_N>
+hipError_t gemm_small_launch(rocblas_handle handle,
+                             rocblas_operation trans_a,
+                             rocblas_operation trans_b,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             const T* alpha,
+                             const T* A,
+                             rocblas_int lda,
+                             rocblas_int stride_a,
+                             const T* B,
+                             rocblas_int ldb,
+                             rocblas_int stride_b,
+                             const T* beta,
+                             T* C,
+                             rocblas_int ldc,
+                             rocblas_int stride_c,
+                             rocblas_int batch)
+{
+    typedef typename gemm_small_compute<T>::type Tc;
+
+    dim3 grid((batch - 1) / GEMM_SMALL_MATRICES + 1, 1, 1);
+    dim3 threads(GEMM_SMALL_THREADS, 1, 1);
+
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        hipLaunchKernelGGL((gemm_small_device_scalar<T, Tc, DIM_M, DIM_N>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           stride_a,
+                           B,
+                           ldb,
+                           stride_b,
+                           beta,
+                           C,
+                           ldc,
+                           stride_c,
+                           batch);
+    }
+    else
+    {
+        hipLaunchKernelGGL((gemm_small_host_scalar<T, Tc, DIM_M, DIM_N>),
+                           grid,
+                           threads,
+                           0,
+                           handle->rocblas_stream,
+                           trans_a,
+                           trans_b,
+                           m,
+                           n,
+                           k,
+                           static_cast<Tc>(*alpha),
+                           A,
+                           lda,
+                           stride_a,
+                           B,
+                           ldb,
+                           stride_b,
+                           static_cast<Tc>(*beta),
+                           C,
+                           ldc,
+                           stride_c,
+                           batch);
+    }
+
+    return hipGetLastError();
+}
+
+// picks the size class of n for the size class DIM_M of m
+template <typename T, rocblas_int DIM_M, typename... Args>
+hipError_t gemm_small_choose_n(rocblas_int dim_n, Args... args)
+{
+    if(dim_n == 8)
+        return gemm_small_launch<T, DIM_M, 8>(args...);
+    if(dim_n == 16)
+        return gemm_small_launch<T, DIM_M, 16>(args...);
+    return gemm_small_launch<T, DIM_M, 32>(args...);
+}
+
+// T is Tensile's type of the elements; alpha and beta are read as the
+// handle's pointer mode says
+template <typename T>
+hipError_t gemm_small(rocblas_handle handle,
+                      rocblas_operation trans_a,
+                      rocblas_operation trans_b,
+                      rocblas_int m,
+                      rocblas_int n,
+                      rocblas_int k,
+                      const T* alpha,
+                      const T* A,
+                      rocblas_int lda,
+                      rocblas_int stride_a,
+                      const T* B,
+                      rocblas_int ldb,
+                      rocblas_int stride_b,
+                      const T* beta,
+                      T* C,
+                      rocblas_int ldc,
+                      rocblas_int stride_c,
+                      rocblas_int batch)
+{
+    rocblas_int dim_m = gemm_small_dim(m);
+    rocblas_int dim_n = gemm_small_dim(n);
+
+    if(dim_m == 8)
+        return gemm_small_choose_n<T, 8>(dim_n, handle, trans_a, trans_b, m, n, k, alpha, A,
+                                         lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+                                         stride_c, batch);
+    if(dim_m == 16)
+        return gemm_small_choose_n<T, 16>(dim_n, handle, trans_a, trans_b, m, n, k, alpha, A,
+                                          lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+                                          stride_c, batch);
+    return gemm_small_choose_n<T, 32>(dim_n, handle, trans_a, trans_b, m, n, k, alpha, A, lda,
+                                      stride_a, B, ldb, stride_b, beta, C, ldc, stride_c,
+                                      batch);
+}
+
+#endif
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GEMM_SPLIT_K_H
+#define GEMM_SPLIT_K_H
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <type_traits>
+#include "rocblas.h"
+#include "handle.h"
+#include "gemm_finish.h"
+
+/*******************************************************************************
+ * Split-K gemm
+ *
+ * Tensile parallelizes a gemm over its output tiles only, so a problem with a
+ * small m x n and a long k, e.g. 256 x 256 x 500000, keeps a few compute units
+ * busy for a long time. When the output has fewer tiles than the device has
+ * compute units, k is cut into chunks, and the chunks run as the batch of one
+ * strided batched Tensile launch: chunk s of op(A) and op(B) starts chunk * s
+ * columns of op(A) and rows of op(B) in, which is a fixed stride. Each chunk
+ * writes its partial product into a slice of a scratch matrix W of
+ * m x n x slices, a remainder of k that is not a whole chunk runs as one more
+ * launch into a last slice, and gemm_finish.h sums the slices into D.
+ *
+ * Only float and double outputs are split; partial products rounded to half
+ * would lose the precision the single pass keeps.
+ ******************************************************************************/
+// output tile edge the tile count is estimated with
+#define GEMM_SPLIT_K_TILE 64
+
+// fewest k per chunk, so a chunk amortizes its tile loads
+#define GEMM_SPLIT_K_MIN_CHUNK 1024
+
+#define GEMM_SPLIT_K_MAX_SPLITS 64
+
+struct gemm_split_k_plan
+{
+    rocblas_int splits; // whole chunks; 1 runs the gemm without splitting
+    rocblas_int chunk;  // k of each whole chunk
+    rocblas_int tail;   // k left over after the whole chunks, 0 if none
+
+    rocblas_int slices() const { return splits + (tail ? 1 : 0); }
+};
+
+template <typename To>
+gemm_split_k_plan gemm_split_k_choose(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int batch_count)
+{
+    gemm_split_k_plan plan = {1, k, 0};
+
+    if(!std::is_same<To, float>{} && !std::is_same<To, double>{})
+        return plan;
+    if(batch_count != 1 || !handle->device_properties)
+        return plan;
+    // a solution picked by index runs the whole product
+    if(handle->gemm_solution_index != -1)
+        return plan;
+
+    rocblas_int tiles = ((m - 1) / GEMM_SPLIT_K_TILE + 1) * ((n - 1) / GEMM_SPLIT_K_TILE + 1);
+    rocblas_int cus   = handle->device_properties->multiProcessorCount;
+    if(tiles >= cus)
+        return plan;
+
+    rocblas_int splits =
+        std::min({cus / tiles, k / GEMM_SPLIT_K_MIN_CHUNK, GEMM_SPLIT_K_MAX_SPLITS});
+    if(splits < 2)
+        return plan;
+
+    plan.splits = splits;
+    plan.chunk  = k / splits;
+    plan.tail   = k - plan.chunk * splits;
+    return plan;
+}
+
+// bytes of scratch for W
+inline size_t gemm_split_k_workspace_size(rocblas_int m,
+                                          rocblas_int n,
+                                          const gemm_split_k_plan& plan,
+                                          size_t elem_size)
+{
+    return size_t(m) * n * plan.slices() * elem_size;
+}
+
+// element offset from one chunk of the stored A to the next
+inline unsigned int gemm_split_k_stride_a(rocblas_operation trans_a, unsigned int lda, rocblas_int chunk)
+{
+    return trans_a == rocblas_operation_none ? lda * chunk : chunk;
+}
+
+// element offset from one chunk of the stored B to the next
+inline unsigned int gemm_split_k_stride_b(rocblas_operation trans_b, unsigned int ldb, rocblas_int chunk)
+{
+    return trans_b == rocblas_operation_none ? chunk : ldb * chunk;
+}
+
+// alpha and beta are read as the handle's pointer mode says
+template <typename Tc, typename To>
+hipError_t gemm_split_k_reduce(rocblas_handle handle,
+                               rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int slices,
+                               const Tc* alpha,
+                               const To* W,
+                               const Tc* beta,
+                               const To* C,
+                               rocblas_int ldc,
+                               To* D,
+                               rocblas_int ldd)
+{
+    return gemm_finish(
+        handle, m, n, 1, slices, alpha, W, beta, gemm_finish_strided<To>{C, ldc, 0, D, ldd, 0});
+}
+
+#endif
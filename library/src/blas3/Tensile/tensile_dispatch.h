@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TENSILE_DISPATCH_H
+#define TENSILE_DISPATCH_H
+#include "rocblas.h"
+#include "Tensile.h"
+#include "tensile_solution_cache.h"
+
+/*******************************************************************************
+ * Helper enumeration over different transpose combinations
+ ******************************************************************************/
+typedef enum transpose_mode_ {
+    // First letter refers to A, second letter refers to B
+    NN,
+    NT,
+    TN,
+    TT
+} transpose_mode;
+
+inline transpose_mode GetTransposeMode(rocblas_operation trans_a, rocblas_operation trans_b)
+{
+    if(trans_a == rocblas_operation_none)
+    {
+        if(trans_b == rocblas_operation_none)
+            return NN;
+        return NT;
+    }
+    else
+    {
+        if(trans_b == rocblas_operation_none)
+            return TN;
+        return TT;
+    }
+}
+
+/*******************************************************************************
+ * Tensile dispatch table
+ *
+ * tensile_dispatch<Ti, To, Tc>::get(transpose_mode) returns the Tensile entry
+ * points of the problem type with input type Ti, output type To and compute
+ * type Tc, in Tensile's own types (TensileHalf for rocblas_half). A
+ * precision is added with one TENSILE_DISPATCH line below; a precision
+ * without one does not compile.
+ ******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+struct tensile_entry
+{
+    // run the problem on device, the current device of the stream, with the
+    // solution picked for it, looked up through the cache (see
+    // tensile_solution_cache.h); or with forced, a compiled solution of the
+    // problem type, if it is not nullptr
+    TensileStatus (*call)(To* dataC,
+                          const Ti* dataA,
+                          const Ti* dataB,
+                          Tc alpha,
+                          Tc beta,
+                          unsigned int strideC1J,
+                          unsigned int strideC2K,
+                          unsigned int strideA1L,
+                          unsigned int strideA2K,
+                          unsigned int strideB1J,
+                          unsigned int strideB2K,
+                          unsigned int sizeI,
+                          unsigned int sizeJ,
+                          unsigned int sizeK,
+                          unsigned int sizeL,
+                          int device,
+                          hipStream_t stream,
+                          const tensile_table_solution* forced);
+
+    // name of the solution call runs for the problem
+    const char* (*solution_name)(unsigned int strideC1J,
+                                 unsigned int strideC2K,
+                                 unsigned int strideA1L,
+                                 unsigned int strideA2K,
+                                 unsigned int strideB1J,
+                                 unsigned int strideB2K,
+                                 unsigned int sizeI,
+                                 unsigned int sizeJ,
+                                 unsigned int sizeK,
+                                 unsigned int sizeL,
+                                 int device,
+                                 hipStream_t stream,
+                                 const tensile_table_solution* forced);
+
+    // the problem type, as the Logic files end in
+    const char* (*problem_type)();
+};
+
+// Tt is the type Tensile takes alpha and beta in, which can be narrower than Tc
+// TODO: alpha and beta need to have precision equal to compute type, not data type (HBH)
+template <typename Ti,
+          typename To,
+          typename Tc,
+          typename Tt,
+          typename P,
+          P (*GetSolution)(unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           unsigned int,
+                           hipStream_t),
+          const char* (*ProblemType)()>
+TensileStatus tensile_call(To* dataC,
+                           const Ti* dataA,
+                           const Ti* dataB,
+                           Tc alpha,
+                           Tc beta,
+                           unsigned int strideC1J,
+                           unsigned int strideC2K,
+                           unsigned int strideA1L,
+                           unsigned int strideA2K,
+                           unsigned int strideB1J,
+                           unsigned int strideB2K,
+                           unsigned int sizeI,
+                           unsigned int sizeJ,
+                           unsigned int sizeK,
+                           unsigned int sizeL,
+                           int device,
+                           hipStream_t stream,
+                           const tensile_table_solution* forced)
+{
+    P solution = forced ? tensile_table_pointer<P>(*forced)
+                        : tensile_cached_solution<P, GetSolution, ProblemType>(strideC1J,
+                                                                               strideC2K,
+                                                                               strideA1L,
+                                                                               strideA2K,
+                                                                               strideB1J,
+                                                                               strideB2K,
+                                                                               sizeI,
+                                                                               sizeJ,
+                                                                               sizeK,
+                                                                               sizeL,
+                                                                               device,
+                                                                               stream);
+    if(!solution)
+        return tensileStatusFailure;
+
+    return solution(dataC,
+                    dataA,
+                    dataB,
+                    static_cast<Tt>(alpha),
+                    static_cast<Tt>(beta),
+                    0,
+                    0,
+                    0,
+                    strideC1J,
+                    strideC2K,
+                    strideA1L,
+                    strideA2K,
+                    strideB1J,
+                    strideB2K,
+                    sizeI,
+                    sizeJ,
+                    sizeK,
+                    sizeL,
+                    stream,
+                    0,
+                    nullptr,
+                    nullptr);
+}
+
+template <typename Ti, typename To, typename Tc>
+struct tensile_dispatch;
+
+// the name of a problem type, as the Logic files end in
+#define TENSILE_PROBLEM_TYPE(PROBLEM_TYPE)                                    \
+    inline const char* tensile_problem_type_##PROBLEM_TYPE() { return #PROBLEM_TYPE; }
+
+#define TENSILE_ENTRY(Ti, To, Tc, Tt, PROBLEM_TYPE)                           \
+    {                                                                         \
+        &tensile_call<Ti,                                                     \
+                      To,                                                     \
+                      Tc,                                                     \
+                      Tt,                                                     \
+                      TensileSolutionPointer_##PROBLEM_TYPE,                  \
+                      tensileGetSolutionPointer_##PROBLEM_TYPE,               \
+                      tensile_problem_type_##PROBLEM_TYPE>,                   \
+            &tensile_solution_name<tensileGetSolutionName_##PROBLEM_TYPE,     \
+                                   tensile_problem_type_##PROBLEM_TYPE>,      \
+            &tensile_problem_type_##PROBLEM_TYPE                              \
+    }
+
+// one row of four entries, in transpose_mode order, per precision
+#define TENSILE_DISPATCH(Ti, To, Tc, Tt, PRECISION)                                    \
+    TENSILE_PROBLEM_TYPE(Cijk_Ailk_Bljk_##PRECISION)                                   \
+    TENSILE_PROBLEM_TYPE(Cijk_Ailk_Bjlk_##PRECISION)                                   \
+    TENSILE_PROBLEM_TYPE(Cijk_Alik_Bljk_##PRECISION)                                   \
+    TENSILE_PROBLEM_TYPE(Cijk_Alik_Bjlk_##PRECISION)                                   \
+                                                                                       \
+    template <>                                                                        \
+    struct tensile_dispatch<Ti, To, Tc>                                                \
+    {                                                                                  \
+        static const char* precision() { return #PRECISION; }                          \
+                                                                                       \
+        static const tensile_entry<Ti, To, Tc>& get(transpose_mode mode)               \
+        {                                                                              \
+            static constexpr tensile_entry<Ti, To, Tc> table[] = {                     \
+                TENSILE_ENTRY(Ti, To, Tc, Tt, Cijk_Ailk_Bljk_##PRECISION),             \
+                TENSILE_ENTRY(Ti, To, Tc, Tt, Cijk_Ailk_Bjlk_##PRECISION),             \
+                TENSILE_ENTRY(Ti, To, Tc, Tt, Cijk_Alik_Bljk_##PRECISION),             \
+                TENSILE_ENTRY(Ti, To, Tc, Tt, Cijk_Alik_Bjlk_##PRECISION)};            \
+            return table[mode];                                                        \
+        }                                                                              \
+    };
+
+//               Ti             To            Tc            Tt            precision
+TENSILE_DISPATCH(TensileHalf,   TensileHalf,  TensileHalf,  TensileHalf,  HB)
+TENSILE_DISPATCH(TensileHalf,   TensileHalf,  float,        TensileHalf,  HBH)
+TENSILE_DISPATCH(float,         float,        float,        float,        SB)
+TENSILE_DISPATCH(double,        double,       double,       double,       DB)
+TENSILE_DISPATCH(TensileInt8x4, TensileInt32, TensileInt32, TensileInt32, 4xi8BH)
+
+#undef TENSILE_DISPATCH
+#undef TENSILE_ENTRY
+#undef TENSILE_PROBLEM_TYPE
+
+// Tensile's type for a rocblas element type
+template <typename T>
+struct tensile_type
+{
+    typedef T type;
+};
+
+template <>
+struct tensile_type<rocblas_half>
+{
+    typedef TensileHalf type;
+};
+
+#endif
@@ -0,0 +1,365 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include "tensile_perf_model.h"
+
+/*******************************************************************************
+ * Logic YAML reader
+ *
+ * Tensile writes a Logic YAML as a list of nine items: the version, the
+ * schedule name, the architecture, the device names, the problem type, the
+ * solutions, the index order, the exact table and the range logic. Only the
+ * keys the model uses are read, line by line, from the layout Tensile writes
+ * rather than from YAML in general.
+ ******************************************************************************/
+namespace
+{
+    enum logic_item
+    {
+        item_schedule     = 1,
+        item_arch         = 2,
+        item_problem_type = 4,
+        item_solutions    = 5,
+        item_exact        = 7,
+        item_count        = 9,
+    };
+
+    // "Key: value" starting at column indent
+    bool split_key(const std::string& line, size_t indent, std::string& key, std::string& value)
+    {
+        if(line.size() <= indent || line[indent] == ' ' || line[indent] == '-')
+            return false;
+
+        size_t colon = line.find(": ", indent);
+        if(colon == std::string::npos)
+            return false;
+
+        key   = line.substr(indent, colon - indent);
+        value = line.substr(colon + 2);
+        return true;
+    }
+
+    // the numbers of a flow sequence, e.g. [4096, 7000, 1, 4096]
+    std::vector<double> read_numbers(const std::string& line)
+    {
+        std::vector<double> numbers;
+        size_t begin = line.find('[');
+        if(begin == std::string::npos)
+            return numbers;
+
+        const char* p = line.c_str() + begin + 1;
+        while(*p && *p != ']')
+        {
+            char* end;
+            double number = strtod(p, &end);
+            if(end == p)
+                break;
+            numbers.push_back(number);
+            p = end;
+            while(*p == ',' || *p == ' ')
+                p++;
+        }
+        return numbers;
+    }
+
+    void set_solution_key(tensile_logic_solution& s, const std::string& key, const std::string& value)
+    {
+        int number = atoi(value.c_str());
+
+        if(key == "SolutionNameMin")
+            s.name = value;
+        else if(key == "MacroTile0")
+            s.macro_tile0 = number;
+        else if(key == "MacroTile1")
+            s.macro_tile1 = number;
+        else if(key == "DepthU")
+            s.depth_u = number;
+        else if(key == "GlobalSplitU")
+            s.global_split_u = number;
+        else if(key == "LocalSplitU")
+            s.local_split_u = number;
+        else if(key == "NumThreads")
+            s.num_threads = number;
+        else if(key == "LdsNumElements")
+            s.lds_num_elements = number;
+        else if(key == "AssertFree0ElementMultiple")
+            s.assert_free0_multiple = number;
+        else if(key == "AssertFree1ElementMultiple")
+            s.assert_free1_multiple = number;
+        else if(key == "AssertSummationElementMultiple")
+            s.assert_summation_multiple = number;
+        else if(key == "Valid")
+            s.valid = value == "true";
+    }
+} // namespace
+
+bool tensile_read_logic(std::istream& is, tensile_logic& logic)
+{
+    logic = tensile_logic();
+
+    int item = -1;
+    std::string line, key, value;
+    while(std::getline(is, line))
+    {
+        if(!line.empty() && line[line.size() - 1] == '\r')
+            line.erase(line.size() - 1);
+
+        // a new top-level item; continuation lines are indented
+        if(line.compare(0, 2, "- ") == 0)
+            item++;
+
+        switch(item)
+        {
+        case item_schedule:
+            logic.schedule = line.substr(2);
+            break;
+
+        case item_arch:
+            logic.arch = line.substr(2);
+            break;
+
+        case item_problem_type:
+            if(split_key(line, 2, key, value) && key == "DataType")
+                logic.data_type = atoi(value.c_str());
+            break;
+
+        case item_solutions:
+            // "- - Key" opens the first solution, "  - Key" each next one
+            if(line.compare(1, 3, " - ") == 0 && (line[0] == '-' || line[0] == ' '))
+                logic.solutions.push_back(tensile_logic_solution());
+            if(!logic.solutions.empty() && split_key(line, 4, key, value))
+                set_solution_key(logic.solutions.back(), key, value);
+            break;
+
+        case item_exact:
+        {
+            // "- - - [sizes]" opens the table, "  - - [sizes]" each next entry,
+            // and "    - [solution, gflops]" follows its sizes
+            std::string prefix = line.substr(0, line.find('['));
+            std::vector<double> numbers = read_numbers(line);
+            if((prefix == "- - - " || prefix == "  - - ") && numbers.size() == 4)
+            {
+                tensile_logic_exact exact;
+                for(size_t i = 0; i < 4; i++)
+                    exact.size[i] = static_cast<unsigned int>(numbers[i]);
+                exact.solution = -1;
+                exact.gflops   = 0;
+                logic.exact.push_back(exact);
+            }
+            else if(prefix == "    - " && numbers.size() == 2 && !logic.exact.empty())
+            {
+                logic.exact.back().solution = static_cast<int>(numbers[0]);
+                logic.exact.back().gflops   = numbers[1];
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    if(item + 1 != item_count || logic.solutions.empty())
+        return false;
+
+    for(const tensile_logic_exact& exact : logic.exact)
+        if(exact.solution < 0 || size_t(exact.solution) >= logic.solutions.size())
+            return false;
+
+    return true;
+}
+
+size_t tensile_data_type_size(int data_type)
+{
+    switch(data_type)
+    {
+    case 1: // double
+    case 2: // single complex
+        return 8;
+    case 3: // double complex
+        return 16;
+    case 4: // half
+        return 2;
+    default: // single, int8x4, int32
+        return 4;
+    }
+}
+
+/*******************************************************************************
+ * performance model
+ ******************************************************************************/
+static double ceil_div(double a, double b) { return std::ceil(a / b); }
+
+static double problem_flops(const tensile_logic_size& size)
+{
+    return 2.0 * size[0] * size[1] * size[2] * size[3];
+}
+
+tensile_perf_model::tensile_perf_model(tensile_logic logic, const tensile_device_params& device)
+    : logic(std::move(logic)),
+      device(device),
+      element_size(tensile_data_type_size(this->logic.data_type)),
+      peak(this->logic.solutions.size(), 0.0)
+{
+    // the peak of a solution is the GFLOPS it would reach at full efficiency,
+    // the median over the sizes it won of what the exact table measured less
+    // the launch overhead, over the predicted efficiency; no solution is
+    // trusted to beat the fastest size the table measured
+    std::vector<std::vector<double>> samples(this->logic.solutions.size());
+    double ceiling = 0;
+
+    for(size_t e = 0; e < this->logic.exact.size(); e++)
+    {
+        const tensile_logic_exact& exact = this->logic.exact[e];
+        const tensile_logic_solution& s  = this->logic.solutions[exact.solution];
+
+        ceiling = std::max(ceiling, exact.gflops);
+
+        double flops = problem_flops(exact.size);
+        double eff   = efficiency(s, exact.size);
+        if(flops <= 0 || eff <= 0 || exact.gflops <= 0)
+            continue;
+
+        // a size bound by memory tells nothing of the peak
+        double compute_us = flops / (exact.gflops * 1e3) - overhead_us(s, exact.size);
+        if(compute_us > memory_us(s, exact.size))
+            samples[exact.solution].push_back(flops / (compute_us * 1e3) / eff);
+    }
+
+    for(size_t i = 0; i < samples.size(); i++)
+    {
+        std::vector<double>& v = samples[i];
+        if(!v.empty())
+        {
+            std::nth_element(v.begin(), v.begin() + v.size() / 2, v.end());
+            peak[i] = std::min(v[v.size() / 2], ceiling);
+        }
+    }
+}
+
+int tensile_perf_model::occupancy(const tensile_logic_solution& s) const
+{
+    int threads      = std::max(s.num_threads, 1);
+    int waves_per_wg = (threads + 63) / 64;
+    int waves_per_cu = device.max_waves_per_simd * 4;
+
+    // each thread holds its share of the tile of every local split in registers
+    double accumulators = double(s.macro_tile0) * s.macro_tile1 * std::max(s.local_split_u, 1) /
+                          threads * std::max<size_t>(element_size / 4, 1);
+    int vgprs          = static_cast<int>(accumulators) + 40;
+    int waves_per_simd = std::min(device.max_waves_per_simd, device.vgprs_per_simd_lane / vgprs);
+
+    int by_vgprs = waves_per_simd * 4 / waves_per_wg;
+    int by_waves = waves_per_cu / waves_per_wg;
+    int by_lds   = s.lds_num_elements ? device.lds_bytes / int(s.lds_num_elements * element_size)
+                                    : by_waves;
+
+    return std::max(1, std::min(by_vgprs, std::min(by_waves, by_lds)));
+}
+
+double tensile_perf_model::efficiency(const tensile_logic_solution& s,
+                                      const tensile_logic_size& size) const
+{
+    double m = size[0], n = size[1], batch = size[2], k = size[3];
+    if(s.macro_tile0 <= 0 || s.macro_tile1 <= 0 || s.depth_u <= 0 || m == 0 || n == 0)
+        return 0;
+
+    double tiles0 = ceil_div(m, s.macro_tile0);
+    double tiles1 = ceil_div(n, s.macro_tile1);
+    double tile   = m * n / (tiles0 * s.macro_tile0 * tiles1 * s.macro_tile1);
+
+    double gsu   = std::max(s.global_split_u, 1);
+    double steps = ceil_div(ceil_div(k, gsu), s.depth_u);
+    double depth = k > 0 ? k / (gsu * steps * s.depth_u) : 1;
+
+    double groups = tiles0 * tiles1 * gsu * batch;
+    double slots  = double(device.compute_units) * occupancy(s);
+    double wave   = groups / (ceil_div(groups, slots) * slots);
+
+    return tile * depth * wave;
+}
+
+double tensile_perf_model::memory_us(const tensile_logic_solution& s,
+                                     const tensile_logic_size& size) const
+{
+    // every work-group reads an MT0 x DepthU panel of A and a DepthU x MT1
+    // panel of B per step, mostly from the cache, and writes its tile of D
+    double tiles = ceil_div(size[0], s.macro_tile0) * ceil_div(size[1], s.macro_tile1) *
+                   size[2] * std::max(s.global_split_u, 1);
+    double steps = ceil_div(ceil_div(size[3], std::max(s.global_split_u, 1)), s.depth_u);
+    double reads  = tiles * steps * s.depth_u * (s.macro_tile0 + s.macro_tile1) * element_size;
+    double writes = double(size[0]) * size[1] * size[2] * element_size;
+
+    return reads / (device.cache_bandwidth_gb_per_s * 1e3) +
+           writes / (device.bandwidth_gb_per_s * 1e3);
+}
+
+double tensile_perf_model::overhead_us(const tensile_logic_solution& s,
+                                       const tensile_logic_size& size) const
+{
+    if(s.global_split_u <= 1)
+        return device.launch_us;
+
+    // D is scaled by beta in a launch of its own, and every split reads and
+    // writes D to add its partial sum
+    double bytes = 2.0 * s.global_split_u * size[0] * size[1] * size[2] * element_size;
+    return 2 * device.launch_us + bytes / (device.bandwidth_gb_per_s * 1e3);
+}
+
+bool tensile_perf_model::can_run(size_t solution, const tensile_logic_size& size) const
+{
+    const tensile_logic_solution& s = logic.solutions[solution];
+    return s.valid && size[0] % std::max(s.assert_free0_multiple, 1) == 0 &&
+           size[1] % std::max(s.assert_free1_multiple, 1) == 0 &&
+           size[3] % std::max(s.assert_summation_multiple, 1) == 0;
+}
+
+double tensile_perf_model::predict(size_t solution, const tensile_logic_size& size) const
+{
+    const tensile_logic_solution& s = logic.solutions[solution];
+    if(peak[solution] <= 0 || !can_run(solution, size))
+        return 0;
+
+    double flops = problem_flops(size);
+    double eff   = efficiency(s, size);
+    if(flops <= 0 || eff <= 0)
+        return 0;
+
+    double compute_us = flops / (peak[solution] * 1e3 * eff);
+    double time_us    = std::max(compute_us, memory_us(s, size)) + overhead_us(s, size);
+    return flops / (time_us * 1e3);
+}
+
+const tensile_logic_exact* tensile_perf_model::find_exact(const tensile_logic_size& size) const
+{
+    for(const tensile_logic_exact& exact : logic.exact)
+        if(exact.size == size)
+            return &exact;
+    return nullptr;
+}
+
+int tensile_perf_model::select(const tensile_logic_size& size) const
+{
+    const tensile_logic_exact* exact = find_exact(size);
+    if(exact)
+        return exact->solution;
+
+    int best           = -1;
+    double best_gflops = 0;
+    for(size_t i = 0; i < logic.solutions.size(); i++)
+    {
+        double gflops = predict(i, size);
+        if(gflops > best_gflops)
+        {
+            best        = static_cast<int>(i);
+            best_gflops = gflops;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TENSILE_PERF_MODEL_H
+#define TENSILE_PERF_MODEL_H
+#include <array>
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+/*******************************************************************************
+ * Tensile performance model
+ *
+ * A Logic YAML lists the solutions Tensile benchmarked for one problem type on
+ * one device, and an exact table of the sizes benchmarked with the solution
+ * that won each and its GFLOPS. Sizes off the table fall to coarse range rules.
+ * The model reads the solution parameters and predicts the GFLOPS of every
+ * candidate for any size from
+ *
+ *   - tile utilization: the share of the MacroTile0 x MacroTile1 tiles over
+ *     m x n that falls inside the matrix,
+ *   - depth utilization: the share of the DepthU steps over k, after
+ *     GlobalSplitU splits it, that falls inside k,
+ *   - wave quantization: the share of the work-group slots of the compute
+ *     units kept busy over the waves the work-groups run in,
+ *
+ * applied to the peak each solution reaches in the exact table, bounded by the
+ * time to stream the tiles through memory, plus a fixed cost per kernel launch
+ * and the traffic of GlobalSplitU's partial sums.
+ *
+ * The model is plain C++ without HIP, so it can be tested on the host against
+ * the YAML files.
+ ******************************************************************************/
+
+// the parameters of one solution the model uses
+struct tensile_logic_solution
+{
+    std::string name;
+    int macro_tile0               = 0;
+    int macro_tile1               = 0;
+    int depth_u                   = 0;
+    int global_split_u            = 1;
+    int local_split_u             = 1;
+    int num_threads               = 0;
+    int lds_num_elements          = 0;
+    int assert_free0_multiple     = 1;
+    int assert_free1_multiple     = 1;
+    int assert_summation_multiple = 1;
+    bool valid                    = true;
+};
+
+// a problem in Tensile's indices: free sizes I and J, batch K, summation L
+typedef std::array<unsigned int, 4> tensile_logic_size;
+
+struct tensile_logic_exact
+{
+    tensile_logic_size size;
+    int solution; // position in tensile_logic::solutions
+    double gflops;
+};
+
+struct tensile_logic
+{
+    std::string schedule; // e.g. vega10
+    std::string arch; // e.g. gfx900
+    int data_type = 0; // Tensile's DataType of the problem type
+    std::vector<tensile_logic_solution> solutions;
+    std::vector<tensile_logic_exact> exact;
+};
+
+// false if the stream does not hold a Logic YAML in the layout Tensile writes
+bool tensile_read_logic(std::istream& is, tensile_logic& logic);
+
+// bytes per element of a Tensile DataType
+size_t tensile_data_type_size(int data_type);
+
+// the device the model predicts for; the defaults are those of a Vega 10
+struct tensile_device_params
+{
+    int compute_units               = 64;
+    double launch_us                = 4; // fixed cost of a kernel launch
+    double bandwidth_gb_per_s       = 480;
+    double cache_bandwidth_gb_per_s = 2000; // L2 to the compute units
+    int lds_bytes                   = 65536; // per compute unit
+    int max_waves_per_simd          = 10;
+    int vgprs_per_simd_lane         = 256;
+};
+
+class tensile_perf_model
+{
+    tensile_logic logic;
+    tensile_device_params device;
+    size_t element_size;
+    std::vector<double> peak; // calibrated GFLOPS per solution; 0 if never benchmarked
+
+    double efficiency(const tensile_logic_solution& s, const tensile_logic_size& size) const;
+    double memory_us(const tensile_logic_solution& s, const tensile_logic_size& size) const;
+    double overhead_us(const tensile_logic_solution& s, const tensile_logic_size& size) const;
+
+    public:
+    tensile_perf_model(tensile_logic logic, const tensile_device_params& device);
+
+    const tensile_logic& get_logic() const { return logic; }
+
+    // work-groups of a solution one compute unit runs at once
+    int occupancy(const tensile_logic_solution& s) const;
+
+    // false if solutions[solution] is not valid or its size asserts fail for size
+    bool can_run(size_t solution, const tensile_logic_size& size) const;
+
+    // predicted GFLOPS of solutions[solution]; 0 if it cannot run the problem
+    double predict(size_t solution, const tensile_logic_size& size) const;
+
+    // the exact entry of a benchmarked size; nullptr if the size is off the table
+    const tensile_logic_exact* find_exact(const tensile_logic_size& size) const;
+
+    // position of the solution to run: the exact table's choice for a
+    // benchmarked size, else the best predicted one; -1 if none can run it
+    int select(const tensile_logic_size& size) const;
+};
+
+#endif
@@ -0,0 +1,764 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include "rocblas.h"
+#include "definitions.h"
+#include "handle.h"
+#include "tensile_perf_model.h"
+#include "tensile_solution_cache.h"
+#include "tensile_solution_table.h"
+
+tensile_solution_cache_counters& tensile_solution_cache_counts()
+{
+    static tensile_solution_cache_counters counters;
+    return counters;
+}
+
+bool tensile_solution_cache_enabled()
+{
+    static const bool enabled = [] {
+        const char* value = getenv("ROCBLAS_SOLUTION_CACHE");
+        return value == nullptr || strcmp(value, "0") != 0;
+    }();
+    return enabled;
+}
+
+std::atomic<uint64_t>& tensile_solution_generation()
+{
+    static std::atomic<uint64_t> generation{0};
+    return generation;
+}
+
+const tensile_table_schedule* tensile_table_schedule_for(const char* problem_type, int device)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<int, std::string>, const tensile_table_schedule*> found;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto key = std::make_pair(device, std::string(problem_type));
+    auto it  = found.find(key);
+    if(it != found.end())
+        return it->second;
+
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device) != hipSuccess)
+        return nullptr;
+
+    // as Tensile's own logic: the schedule naming the device, else the last one
+    size_t count;
+    const tensile_table_schedule* schedules = tensile_table_schedules(count);
+    const tensile_table_schedule* schedule  = nullptr;
+    for(size_t i = 0; i < count; i++)
+    {
+        if(strcmp(schedules[i].problem_type, problem_type) != 0)
+            continue;
+        schedule = &schedules[i];
+
+        bool named = false;
+        for(const char* const* name = schedule->device_names; *name && !named; name++)
+            named = strcmp(*name, props.name) == 0;
+        if(named)
+            break;
+    }
+
+    return found[key] = schedule;
+}
+
+/*******************************************************************************
+ * performance model of the Logic files in ROCBLAS_TENSILE_LOGIC_PATH
+ ******************************************************************************/
+static const std::string& tensile_logic_path()
+{
+    static const std::string path = [] {
+        const char* value = getenv("ROCBLAS_TENSILE_LOGIC_PATH");
+        return std::string(value ? value : "");
+    }();
+    return path;
+}
+
+static std::string tensile_device_arch(const hipDeviceProp_t& props)
+{
+    return "gfx" + std::to_string(props.gcnArch);
+}
+
+// false if the solutions of a Logic file are not those compiled for schedule
+static bool tensile_logic_matches(const tensile_logic& logic, const tensile_table_schedule& schedule)
+{
+    if(logic.schedule != schedule.schedule || logic.solutions.size() != schedule.solution_count)
+        return false;
+
+    for(size_t i = 0; i < schedule.solution_count; i++)
+    {
+        const tensile_logic_solution& a = logic.solutions[i];
+        const tensile_table_solution& b = schedule.solutions[i];
+        if(a.macro_tile0 != b.macro_tile0 || a.macro_tile1 != b.macro_tile1 ||
+           a.depth_u != b.depth_u || a.global_split_u != b.global_split_u ||
+           a.local_split_u != b.local_split_u || a.num_threads != b.num_threads ||
+           a.assert_free0_multiple != b.assert_free0_multiple ||
+           a.assert_free1_multiple != b.assert_free1_multiple ||
+           a.assert_summation_multiple != b.assert_summation_multiple ||
+           a.valid != (b.function != nullptr))
+            return false;
+    }
+    return true;
+}
+
+// the model of a problem type on a device, read on first use from the file in
+// ROCBLAS_TENSILE_LOGIC_PATH of that problem type with the schedule compiled
+// for the device; nullptr if the path is not set or has no such file. Only a
+// finished scan of the directory is remembered, so a failure to query the
+// device or open the directory is retried on the next call.
+static const tensile_perf_model* tensile_model(const char* problem_type, int device)
+{
+    const std::string& path = tensile_logic_path();
+    if(path.empty())
+        return nullptr;
+
+    static std::mutex mutex;
+    static std::map<std::pair<int, std::string>, std::unique_ptr<tensile_perf_model>> models;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto key = std::make_pair(device, std::string(problem_type));
+    auto it  = models.find(key);
+    if(it != models.end())
+        return it->second.get();
+
+    const tensile_table_schedule* schedule = tensile_table_schedule_for(problem_type, device);
+    hipDeviceProp_t props;
+    if(schedule == nullptr || hipGetDeviceProperties(&props, device) != hipSuccess)
+        return nullptr;
+
+    DIR* dir = opendir(path.c_str());
+    if(dir == nullptr)
+        return nullptr;
+
+    std::string suffix = std::string("_") + problem_type + ".yaml";
+    std::unique_ptr<tensile_perf_model> model;
+
+    while(struct dirent* entry = readdir(dir))
+    {
+        std::string name = entry->d_name;
+        if(name.size() <= suffix.size() ||
+           name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0)
+            continue;
+
+        std::ifstream file(path + "/" + name);
+        tensile_logic logic;
+        if(!tensile_read_logic(file, logic) || logic.schedule != schedule->schedule)
+            continue;
+
+        if(!tensile_logic_matches(logic, *schedule))
+        {
+            std::cerr << "rocblas warning: " << name << " does not list the solutions built for "
+                      << schedule->schedule << "; not used" << std::endl;
+            break;
+        }
+
+        tensile_device_params device_params;
+        device_params.compute_units = props.multiProcessorCount;
+        model.reset(new tensile_perf_model(std::move(logic), device_params));
+        break;
+    }
+    closedir(dir);
+
+    return (models[key] = std::move(model)).get();
+}
+
+const tensile_table_solution* tensile_model_solution(const char* problem_type,
+                                                     const tensile_problem_key& key)
+{
+    const tensile_perf_model* model = tensile_model(problem_type, key[0]);
+    if(model == nullptr)
+        return nullptr;
+
+    tensile_logic_size size = {{key[1], key[2], key[3], key[4]}};
+    if(model->find_exact(size))
+        return nullptr;
+
+    int solution = model->select(size);
+    if(solution < 0)
+        return nullptr;
+
+    // the model was checked against the schedule when it was read
+    return &tensile_table_schedule_for(problem_type, key[0])->solutions[solution];
+}
+
+/*******************************************************************************
+ * solution overrides
+ *
+ * An override file maps gemm problems to solutions, one per line:
+ *
+ *   # precision transA transB m n k batch_count solution
+ *   SB N T 1000 1000 1000 1 42
+ *
+ * precision is that of the problem type (HB, HBH, SB, DB or 4xi8BH), the
+ * sizes are those Tensile is called with, and solution is the position of the
+ * solution in the Logic file of the problem type for the device, as in the
+ * exact table. Entries are checked against the table of the solutions built
+ * into the library, whose function then runs the problem.
+ *
+ * The overrides and tuned solutions are looked up on every small strided
+ * batched gemm, so lookups read an immutable snapshot of the maps without
+ * the mutex, and changes, which are rare, publish a new one.
+ ******************************************************************************/
+namespace
+{
+    // device, problem type, then sizes I, J, K, L; the problem types of stored
+    // keys are those of the static solution table, and are compared by content
+    struct tensile_override_key
+    {
+        unsigned int device;
+        const char* problem_type;
+        tensile_logic_size size;
+
+        bool operator<(const tensile_override_key& other) const
+        {
+            if(device != other.device)
+                return device < other.device;
+            int order = strcmp(problem_type, other.problem_type);
+            return order != 0 ? order < 0 : size < other.size;
+        }
+    };
+
+    typedef std::map<tensile_override_key, const tensile_table_solution*> tensile_override_map;
+
+    struct tensile_override_maps
+    {
+        tensile_override_map problems;
+        tensile_override_map tuned;
+    };
+
+    struct tensile_overrides
+    {
+        std::mutex mutex; // of the writers
+        std::atomic<bool> any{false};
+        std::shared_ptr<const tensile_override_maps> maps; // read with std::atomic_load
+        std::set<int> devices_loaded_from_env;
+        std::set<int> devices_loaded_tuning;
+    };
+
+    tensile_overrides& tensile_override_table()
+    {
+        static tensile_overrides overrides;
+        return overrides;
+    }
+
+    // the key of a stored entry, with the problem type of the schedule, which
+    // outlives the maps
+    tensile_override_key tensile_make_override_key(int device,
+                                                   const tensile_table_schedule& schedule,
+                                                   const tensile_logic_size& size)
+    {
+        return {unsigned(device), schedule.problem_type, size};
+    }
+
+    // applies change to a copy of the maps and publishes the copy; the caller
+    // holds the mutex
+    template <typename F>
+    void tensile_change_overrides(tensile_overrides& overrides, F change)
+    {
+        std::shared_ptr<tensile_override_maps> maps =
+            overrides.maps ? std::make_shared<tensile_override_maps>(*overrides.maps)
+                           : std::make_shared<tensile_override_maps>();
+        change(*maps);
+        overrides.any = !maps->problems.empty() || !maps->tuned.empty();
+        std::atomic_store(&overrides.maps, std::shared_ptr<const tensile_override_maps>(maps));
+        tensile_solution_generation()++;
+    }
+
+    bool tensile_override_error(const char* path, int line, const char* message)
+    {
+        std::cerr << "rocblas ERROR: " << path << ":" << line << ": " << message << std::endl;
+        return false;
+    }
+
+    // reads "precision transA transB m n k batch_count" into a problem type and
+    // Tensile's sizes I, J, K, L
+    bool tensile_read_problem(std::istream& fields,
+                              std::string& problem_type,
+                              tensile_logic_size& size)
+    {
+        static const char* const precisions[] = {"HB", "HBH", "SB", "DB", "4xi8BH"};
+
+        std::string precision, trans_a, trans_b;
+        unsigned int m, n, k, batch_count;
+        if(!(fields >> precision >> trans_a >> trans_b >> m >> n >> k >> batch_count) ||
+           (trans_a != "N" && trans_a != "T") || (trans_b != "N" && trans_b != "T") ||
+           std::find(std::begin(precisions), std::end(precisions), precision) ==
+               std::end(precisions))
+            return false;
+
+        problem_type = std::string("Cijk_") + (trans_a == "N" ? "Ailk" : "Alik") +
+                       (trans_b == "N" ? "_Bljk_" : "_Bjlk_") + precision;
+        size = {{m, n, batch_count, k}};
+        return true;
+    }
+
+    // the inverse of tensile_read_problem
+    std::string tensile_write_problem(const std::string& problem_type,
+                                      const tensile_logic_size& size)
+    {
+        std::ostringstream fields;
+        fields << problem_type.substr(15) << (problem_type.compare(5, 4, "Ailk") ? " T" : " N")
+               << (problem_type.compare(10, 4, "Bljk") ? " T " : " N ") << size[0] << " "
+               << size[1] << " " << size[3] << " " << size[2];
+        return fields.str();
+    }
+
+    // false, with a message, if the line is not a valid entry for the device
+    bool tensile_read_override(const char* path,
+                               int line_number,
+                               const std::string& line,
+                               int device,
+                               tensile_override_map& problems)
+    {
+        std::istringstream fields(line);
+        std::string problem_type, rest;
+        tensile_logic_size size;
+        size_t solution;
+
+        if(!tensile_read_problem(fields, problem_type, size) || !(fields >> solution) ||
+           (fields >> rest))
+            return tensile_override_error(
+                path,
+                line_number,
+                "expected: precision transA transB m n k batch_count solution, "
+                "with precision HB, HBH, SB, DB or 4xi8BH and trans N or T");
+
+        const tensile_table_schedule* schedule =
+            tensile_table_schedule_for(problem_type.c_str(), device);
+        if(schedule == nullptr)
+            return tensile_override_error(
+                path, line_number, "no solutions of the problem type are built for the device");
+
+        if(solution >= schedule->solution_count)
+            return tensile_override_error(path, line_number, "no such solution");
+        if(!tensile_table_can_run(schedule->solutions[solution], size))
+            return tensile_override_error(path, line_number, "the solution cannot run the problem");
+
+        problems[tensile_make_override_key(device, *schedule, size)] = &schedule->solutions[solution];
+        return true;
+    }
+} // namespace
+
+rocblas_status tensile_load_overrides(int device, const char* path)
+{
+    tensile_override_map problems;
+
+    if(path != nullptr)
+    {
+        std::ifstream file(path);
+        if(!file)
+        {
+            std::cerr << "rocblas ERROR: cannot open " << path << std::endl;
+            return rocblas_status_invalid_pointer;
+        }
+
+        std::string line;
+        for(int line_number = 1; std::getline(file, line); line_number++)
+        {
+            size_t first = line.find_first_not_of(" \t\r");
+            if(first == std::string::npos || line[first] == '#')
+                continue;
+            if(!tensile_read_override(path, line_number, line, device, problems))
+                return rocblas_status_invalid_size;
+        }
+    }
+
+    // the entries of the device are replaced at once, or not at all
+    tensile_overrides& overrides = tensile_override_table();
+    std::lock_guard<std::mutex> lock(overrides.mutex);
+    tensile_change_overrides(overrides, [&](tensile_override_maps& maps) {
+        for(auto it = maps.problems.begin(); it != maps.problems.end();)
+        {
+            if(it->first.device == unsigned(device))
+                it = maps.problems.erase(it);
+            else
+                ++it;
+        }
+        maps.problems.insert(problems.begin(), problems.end());
+    });
+
+    return rocblas_status_success;
+}
+
+void tensile_load_overrides_from_env(int device)
+{
+    const char* path = getenv("ROCBLAS_SOLUTION_OVERRIDE_PATH");
+    if(path == nullptr)
+        return;
+
+    tensile_overrides& overrides = tensile_override_table();
+    {
+        std::lock_guard<std::mutex> lock(overrides.mutex);
+        if(!overrides.devices_loaded_from_env.insert(device).second)
+            return;
+    }
+
+    tensile_load_overrides(device, path);
+}
+
+const tensile_table_solution* tensile_override_solution(const char* problem_type,
+                                                        const tensile_problem_key& key)
+{
+    tensile_overrides& overrides = tensile_override_table();
+    if(!overrides.any)
+        return nullptr;
+
+    std::shared_ptr<const tensile_override_maps> maps = std::atomic_load(&overrides.maps);
+    if(!maps)
+        return nullptr;
+
+    // an override comes before a tuned solution
+    tensile_override_key problem = {key[0], problem_type, {{key[1], key[2], key[3], key[4]}}};
+    for(const tensile_override_map* table : {&maps->problems, &maps->tuned})
+    {
+        auto it = table->find(problem);
+        if(it != table->end())
+            return it->second;
+    }
+    return nullptr;
+}
+
+/*******************************************************************************
+ * solutions picked by index, with rocblas_gemm_algo_solution_index
+ ******************************************************************************/
+rocblas_status tensile_solution_at(const char* problem_type,
+                                   int device,
+                                   int index,
+                                   const tensile_logic_size& size,
+                                   const tensile_table_solution*& solution)
+{
+    const tensile_table_schedule* schedule = tensile_table_schedule_for(problem_type, device);
+    if(schedule == nullptr)
+        return rocblas_status_not_implemented;
+
+    if(index < 0 || size_t(index) >= schedule->solution_count ||
+       !tensile_table_can_run(schedule->solutions[index], size))
+        return rocblas_status_invalid_size;
+
+    solution = &schedule->solutions[index];
+    return rocblas_status_success;
+}
+
+rocblas_status tensile_list_solutions(const char* problem_type,
+                                      int device,
+                                      const tensile_logic_size& size,
+                                      std::vector<rocblas_gemm_solution>& solutions)
+{
+    solutions.clear();
+
+    const tensile_table_schedule* schedule = tensile_table_schedule_for(problem_type, device);
+    if(schedule == nullptr)
+        return rocblas_status_not_implemented;
+
+    // the model, when on, lists the solutions of the schedule in the same order
+    const tensile_perf_model* model = tensile_model(problem_type, device);
+
+    for(size_t i = 0; i < schedule->solution_count; i++)
+    {
+        const tensile_table_solution& s = schedule->solutions[i];
+        if(!tensile_table_can_run(s, size))
+            continue;
+
+        rocblas_gemm_solution info = {};
+        info.solution_index        = int32_t(i);
+        strncpy(info.name, s.name, sizeof(info.name) - 1);
+        info.macro_tile0      = s.macro_tile0;
+        info.macro_tile1      = s.macro_tile1;
+        info.depth_u          = s.depth_u;
+        info.global_split_u   = s.global_split_u;
+        info.local_split_u    = s.local_split_u;
+        info.workgroup_size   = s.num_threads;
+        info.predicted_gflops = model ? model->predict(i, size) : 0;
+        solutions.push_back(info);
+    }
+
+    std::stable_sort(solutions.begin(),
+                     solutions.end(),
+                     [](const rocblas_gemm_solution& a, const rocblas_gemm_solution& b) {
+                         return a.predicted_gflops > b.predicted_gflops;
+                     });
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * tuning cache
+ *
+ * rocblas_gemm_ex_tune keeps the fastest solution of each problem it tunes in
+ * a file per architecture and compiled solution table, named by the hash of
+ * the table, in ROCBLAS_TUNING_CACHE_PATH, else $XDG_CACHE_HOME/rocblas, else
+ * ~/.cache/rocblas. A line holds the fields of an override and the name of
+ * the solution, which must still be the one at that position for the entry to
+ * be used; solution -1, named -, records that the default pick was fastest:
+ *
+ *   # precision transA transB m n k batch_count solution name
+ *   SB N N 1000 1000 1000 1 59 Cijk_Ailk_Bljk_SB_MT128x128x08_...
+ ******************************************************************************/
+namespace
+{
+    struct tensile_tuned_entry
+    {
+        std::string problem_type;
+        tensile_logic_size size;
+        int solution;
+        std::string name;
+    };
+
+    std::string tensile_tuning_cache_file(int device)
+    {
+        std::string dir;
+        if(const char* path = getenv("ROCBLAS_TUNING_CACHE_PATH"))
+            dir = path;
+        else if(const char* xdg = getenv("XDG_CACHE_HOME"))
+            dir = std::string(xdg) + "/rocblas";
+        else if(const char* home = getenv("HOME"))
+            dir = std::string(home) + "/.cache/rocblas";
+
+        hipDeviceProp_t props;
+        if(dir.empty() || hipGetDeviceProperties(&props, device) != hipSuccess)
+            return "";
+
+        return dir + "/gemm_tuning_" + tensile_device_arch(props) + "_" + tensile_table_hash() +
+               ".txt";
+    }
+
+    // the entries of a cache file; lines that do not parse are dropped
+    std::vector<tensile_tuned_entry> tensile_read_tuning_cache(const std::string& file_name)
+    {
+        std::vector<tensile_tuned_entry> entries;
+        std::ifstream file(file_name);
+        std::string line;
+        while(std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            tensile_tuned_entry e;
+            if(line.compare(0, 1, "#") != 0 && tensile_read_problem(fields, e.problem_type, e.size) &&
+               fields >> e.solution >> e.name)
+                entries.push_back(e);
+        }
+        return entries;
+    }
+
+    // the compiled solution of an entry; nullptr if the entry is of the default
+    // pick, or the table of the device no longer has the solution there
+    const tensile_table_solution* tensile_tuned_solution(const tensile_tuned_entry& e, int device)
+    {
+        const tensile_table_solution* solution = nullptr;
+        if(e.solution < 0 ||
+           tensile_solution_at(e.problem_type.c_str(), device, e.solution, e.size, solution) !=
+               rocblas_status_success ||
+           e.name != solution->name)
+            return nullptr;
+        return solution;
+    }
+
+    // creates the directories of path up to its last '/'
+    void tensile_make_dirs(const std::string& path)
+    {
+        for(size_t slash = path.find('/', 1); slash != std::string::npos;
+            slash        = path.find('/', slash + 1))
+            mkdir(path.substr(0, slash).c_str(), 0755);
+    }
+} // namespace
+
+void tensile_load_tuning_cache(int device)
+{
+    tensile_overrides& overrides = tensile_override_table();
+    {
+        std::lock_guard<std::mutex> lock(overrides.mutex);
+        if(!overrides.devices_loaded_tuning.insert(device).second)
+            return;
+    }
+
+    std::string file_name = tensile_tuning_cache_file(device);
+    if(file_name.empty())
+        return;
+
+    std::vector<tensile_tuned_entry> entries = tensile_read_tuning_cache(file_name);
+
+    std::lock_guard<std::mutex> lock(overrides.mutex);
+    tensile_change_overrides(overrides, [&](tensile_override_maps& maps) {
+        for(const tensile_tuned_entry& e : entries)
+        {
+            if(const tensile_table_solution* solution = tensile_tuned_solution(e, device))
+                maps.tuned[tensile_make_override_key(
+                    device, *tensile_table_schedule_for(e.problem_type.c_str(), device), e.size)] =
+                    solution;
+        }
+    });
+}
+
+std::vector<int> tensile_tuning_candidates(const char* problem_type,
+                                           int device,
+                                           const tensile_logic_size& size)
+{
+    std::vector<int> candidates;
+
+    const tensile_table_schedule* schedule = tensile_table_schedule_for(problem_type, device);
+    if(schedule == nullptr)
+        return candidates;
+
+    for(size_t i = 0; i < schedule->solution_count; i++)
+        if(tensile_table_can_run(schedule->solutions[i], size))
+            candidates.push_back(int(i));
+    return candidates;
+}
+
+const tensile_table_solution*
+    tensile_forget_tuned(const char* problem_type, int device, const tensile_logic_size& size)
+{
+    tensile_overrides& overrides = tensile_override_table();
+    std::lock_guard<std::mutex> lock(overrides.mutex);
+    if(!overrides.maps)
+        return nullptr;
+
+    tensile_override_key problem = {unsigned(device), problem_type, size};
+    auto it                      = overrides.maps->tuned.find(problem);
+    if(it == overrides.maps->tuned.end())
+        return nullptr;
+
+    const tensile_table_solution* previous = it->second;
+    tensile_change_overrides(overrides,
+                             [&](tensile_override_maps& maps) { maps.tuned.erase(problem); });
+    return previous;
+}
+
+void tensile_restore_tuned(const char* problem_type,
+                           int device,
+                           const tensile_logic_size& size,
+                           const tensile_table_solution* solution)
+{
+    const tensile_table_schedule* schedule = tensile_table_schedule_for(problem_type, device);
+    if(solution == nullptr || schedule == nullptr)
+        return;
+
+    tensile_overrides& overrides = tensile_override_table();
+    std::lock_guard<std::mutex> lock(overrides.mutex);
+    tensile_change_overrides(overrides, [&](tensile_override_maps& maps) {
+        maps.tuned[tensile_make_override_key(device, *schedule, size)] = solution;
+    });
+}
+
+namespace
+{
+    // merges an entry into the cache file, under an advisory lock on a file
+    // beside it so that processes tuning at once do not drop each other's
+    // entries, and replaces the file at once; false if it cannot
+    bool tensile_write_tuning_cache(const std::string& file_name, const tensile_tuned_entry& tuned)
+    {
+        tensile_make_dirs(file_name);
+
+        std::string lock_name = file_name + ".lock";
+        int lock              = open(lock_name.c_str(), O_RDWR | O_CREAT, 0644);
+        if(lock < 0)
+            return false;
+        if(flock(lock, LOCK_EX) != 0)
+        {
+            close(lock);
+            return false;
+        }
+
+        std::map<std::string, std::string> lines;
+        for(const tensile_tuned_entry& e : tensile_read_tuning_cache(file_name))
+            lines[tensile_write_problem(e.problem_type, e.size)] =
+                std::to_string(e.solution) + " " + e.name;
+        lines[tensile_write_problem(tuned.problem_type, tuned.size)] =
+            std::to_string(tuned.solution) + " " + tuned.name;
+
+        std::string temp_name = file_name + "." + std::to_string(getpid());
+        bool written;
+        {
+            std::ofstream file(temp_name);
+            file << "# precision transA transB m n k batch_count solution name\n";
+            for(const auto& entry : lines)
+                file << entry.first << " " << entry.second << "\n";
+            file.close();
+            written = !file.fail();
+        }
+        if(!written || rename(temp_name.c_str(), file_name.c_str()) != 0)
+        {
+            remove(temp_name.c_str());
+            written = false;
+        }
+
+        // closing the lock file releases the lock
+        close(lock);
+        return written;
+    }
+} // namespace
+
+rocblas_status tensile_record_tuned(const char* problem_type,
+                                    int device,
+                                    const tensile_logic_size& size,
+                                    int solution)
+{
+    tensile_tuned_entry tuned = {problem_type, size, solution, "-"};
+    const tensile_table_solution* compiled = nullptr;
+    if(solution >= 0)
+    {
+        RETURN_IF_ROCBLAS_ERROR(tensile_solution_at(problem_type, device, solution, size, compiled));
+        tuned.name = compiled->name;
+    }
+
+    tensile_overrides& overrides = tensile_override_table();
+    {
+        std::lock_guard<std::mutex> lock(overrides.mutex);
+        tensile_change_overrides(overrides, [&](tensile_override_maps& maps) {
+            if(compiled)
+                maps.tuned[tensile_make_override_key(
+                    device, *tensile_table_schedule_for(problem_type, device), size)] = compiled;
+            else
+                maps.tuned.erase({unsigned(device), problem_type, size});
+        });
+    }
+
+    // the tuning holds for this process even where it cannot be kept
+    std::string file_name = tensile_tuning_cache_file(device);
+    if(file_name.empty() || !tensile_write_tuning_cache(file_name, tuned))
+        std::cerr << "rocblas warning: the tuning of " << tensile_write_problem(problem_type, size)
+                  << " is not kept in the tuning cache"
+                  << (file_name.empty() ? std::string() : " " + file_name) << std::endl;
+
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ *! \brief   load a file of gemm solution overrides for the device of the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_load_solution_overrides(rocblas_handle handle, const char* path)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    return tensile_load_overrides(handle->device, path);
+}
+
+/*******************************************************************************
+ *! \brief   get the hit and miss counts of the Tensile solution lookup cache
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_solution_cache_counters(uint64_t* hits, uint64_t* misses)
+{
+    if(hits == nullptr || misses == nullptr)
+        return rocblas_status_invalid_pointer;
+    *hits   = tensile_solution_cache_counts().hits;
+    *misses = tensile_solution_cache_counts().misses;
+    return rocblas_status_success;
+}
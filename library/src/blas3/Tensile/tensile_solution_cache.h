@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TENSILE_SOLUTION_CACHE_H
+#define TENSILE_SOLUTION_CACHE_H
+#include <hip/hip_runtime_api.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "rocblas.h"
+#include "Tensile.h"
+#include "tensile_perf_model.h"
+#include "tensile_solution_table.h"
+
+/*******************************************************************************
+ * Tensile solution lookup cache
+ *
+ * tensile_Cijk_* walks Tensile's generated size-mapping logic on every call
+ * to pick a solution. The choice only depends on the problem type, sizes,
+ * strides and device, so the solution pointer returned by
+ * tensileGetSolutionPointer_* is kept per process and called directly when
+ * the same problem is seen again. Setting ROCBLAS_SOLUTION_CACHE=0 turns the
+ * cache off, for comparison.
+ *
+ * A file of solution overrides, named by ROCBLAS_SOLUTION_OVERRIDE_PATH when
+ * a handle is created or loaded with rocblas_load_solution_overrides, maps
+ * problems to solutions of the table of tensile_solution_table.h, whose
+ * functions are then called instead of Tensile's pick. The solutions
+ * rocblas_gemm_ex_tune finds fastest come next, from its on-disk cache.
+ *
+ * When ROCBLAS_TENSILE_LOGIC_PATH names a directory of Logic YAML files, a
+ * problem off the exact table of its device's file runs the solution the
+ * performance model of tensile_perf_model.h predicts fastest instead of the
+ * one of the range rules; a file whose solutions are not those compiled for
+ * the device is not used. The cached picks are dropped when the overrides or
+ * tuned solutions change.
+ *
+ * A solution picked by the caller with rocblas_gemm_algo_solution_index
+ * comes before all of them.
+ ******************************************************************************/
+
+// device, then sizes I, J, K, L and strides C1, C2, A1, A2, B1, B2
+typedef std::array<unsigned int, 11> tensile_problem_key;
+
+struct tensile_problem_key_hash
+{
+    size_t operator()(const tensile_problem_key& key) const
+    {
+        // FNV-1a
+        size_t hash = 14695981039346656037ull;
+        for(unsigned int value : key)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+};
+
+// process-wide hit and miss counts of all the problem types
+struct tensile_solution_cache_counters
+{
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+};
+
+tensile_solution_cache_counters& tensile_solution_cache_counts();
+
+// false when ROCBLAS_SOLUTION_CACHE is set to 0; read once per process
+bool tensile_solution_cache_enabled();
+
+// changes whenever the overrides or tuned solutions do, so cached picks are redone
+std::atomic<uint64_t>& tensile_solution_generation();
+
+// the compiled solution the performance model picks for the problem of key;
+// nullptr when the model is off, has no Logic file matching the compiled
+// solutions of the problem type on the device, or the size is on the exact table
+const tensile_table_solution* tensile_model_solution(const char* problem_type,
+                                                     const tensile_problem_key& key);
+
+// replaces the overrides of the device with those of the file at path, or
+// removes them when path is nullptr; nothing changes if any entry is invalid
+rocblas_status tensile_load_overrides(int device, const char* path);
+
+// loads ROCBLAS_SOLUTION_OVERRIDE_PATH for the device, once per process
+void tensile_load_overrides_from_env(int device);
+
+// the compiled solution of the override of the problem of key, or else of its
+// tuned solution; nullptr if it has neither. Takes no lock, and problem_type
+// is compared by content
+const tensile_table_solution* tensile_override_solution(const char* problem_type,
+                                                        const tensile_problem_key& key);
+
+// loads the tuning cache of the device's architecture and solution table,
+// once per process
+void tensile_load_tuning_cache(int device);
+
+// the positions of the compiled solutions of the device's Logic file that can
+// run a problem; empty if none of the problem type are built for the device
+std::vector<int> tensile_tuning_candidates(const char* problem_type,
+                                           int device,
+                                           const tensile_logic_size& size);
+
+// drops the tuned solution of a problem for this process, and returns it;
+// nullptr if it had none
+const tensile_table_solution*
+    tensile_forget_tuned(const char* problem_type, int device, const tensile_logic_size& size);
+
+// puts back a tuned solution tensile_forget_tuned returned; nothing if nullptr
+void tensile_restore_tuned(const char* problem_type,
+                           int device,
+                           const tensile_logic_size& size,
+                           const tensile_table_solution* solution);
+
+// uses solution, or the default pick if it is -1, for a problem from now on,
+// and records it, by position and name, in the tuning cache of the device;
+// a cache that cannot be written is warned of, and the solution is still used
+rocblas_status tensile_record_tuned(const char* problem_type,
+                                    int device,
+                                    const tensile_logic_size& size,
+                                    int solution);
+
+// the compiled solution at index in the device's Logic file of the problem
+// type, for rocblas_gemm_algo_solution_index; rocblas_status_not_implemented if
+// no solutions of the problem type are built for the device,
+// rocblas_status_invalid_size if the solution does not exist or cannot run size
+rocblas_status tensile_solution_at(const char* problem_type,
+                                   int device,
+                                   int index,
+                                   const tensile_logic_size& size,
+                                   const tensile_table_solution*& solution);
+
+// the solutions tensile_solution_at accepts for a problem, fastest predicted
+// first when the performance model is on, else in the order of the Logic file;
+// rocblas_status_not_implemented if none of the problem type are built for the device
+rocblas_status tensile_list_solutions(const char* problem_type,
+                                      int device,
+                                      const tensile_logic_size& size,
+                                      std::vector<rocblas_gemm_solution>& solutions);
+
+template <typename P>
+class tensile_solution_cache
+{
+    // problems past this many are looked up every time instead of growing the map
+    static constexpr size_t max_entries = 4096;
+
+    std::mutex mutex;
+    std::unordered_map<tensile_problem_key, P, tensile_problem_key_hash> solutions;
+    uint64_t generation = 0; // of the picks in solutions
+
+    public:
+    template <typename F>
+    P lookup(const tensile_problem_key& key, F get_solution)
+    {
+        uint64_t current = tensile_solution_generation();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(generation != current)
+            {
+                solutions.clear();
+                generation = current;
+            }
+
+            auto it = solutions.find(key);
+            if(it != solutions.end())
+            {
+                tensile_solution_cache_counts().hits++;
+                return it->second;
+            }
+        }
+
+        P solution = get_solution();
+        tensile_solution_cache_counts().misses++;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(solution && generation == current && solutions.size() < max_entries)
+            solutions.emplace(key, solution);
+        return solution;
+    }
+};
+
+// a Tensile solution getter: tensileGetSolutionPointer_* or tensileGetSolutionName_*
+#define TENSILE_GETTER(R, NAME)                                                           \
+    R (*NAME)(unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              unsigned int,                                                               \
+              hipStream_t)
+
+// the key of a problem on device
+inline tensile_problem_key tensile_make_problem_key(int device,
+                                                    unsigned int strideC1J,
+                                                    unsigned int strideC2K,
+                                                    unsigned int strideA1L,
+                                                    unsigned int strideA2K,
+                                                    unsigned int strideB1J,
+                                                    unsigned int strideB2K,
+                                                    unsigned int sizeI,
+                                                    unsigned int sizeJ,
+                                                    unsigned int sizeK,
+                                                    unsigned int sizeL)
+{
+    return {{static_cast<unsigned int>(device),
+             sizeI,
+             sizeJ,
+             sizeK,
+             sizeL,
+             strideC1J,
+             strideC2K,
+             strideA1L,
+             strideA2K,
+             strideB1J,
+             strideB2K}};
+}
+
+// the compiled solution an override, the tuning cache or the performance model
+// picks for the problem of key, in that order; nullptr to take Tensile's pick
+inline const tensile_table_solution* tensile_picked_solution(const char* problem_type,
+                                                             const tensile_problem_key& key)
+{
+    const tensile_table_solution* solution = tensile_override_solution(problem_type, key);
+    return solution ? solution : tensile_model_solution(problem_type, key);
+}
+
+// what Get returns for the problem of key
+template <typename R, TENSILE_GETTER(R, Get)>
+R tensile_get_for_problem(const tensile_problem_key& key, hipStream_t stream)
+{
+    return Get(
+        key[5], key[6], key[7], key[8], key[9], key[10], key[1], key[2], key[3], key[4], stream);
+}
+
+// the solution picked for a problem of the type GetSolution belongs to, named
+// by ProblemType, from the cache of that problem type
+template <typename P, TENSILE_GETTER(P, GetSolution), const char* (*ProblemType)()>
+P tensile_cached_solution(unsigned int strideC1J,
+                          unsigned int strideC2K,
+                          unsigned int strideA1L,
+                          unsigned int strideA2K,
+                          unsigned int strideB1J,
+                          unsigned int strideB2K,
+                          unsigned int sizeI,
+                          unsigned int sizeJ,
+                          unsigned int sizeK,
+                          unsigned int sizeL,
+                          int device,
+                          hipStream_t stream)
+{
+    tensile_problem_key key = tensile_make_problem_key(device,
+                                                       strideC1J,
+                                                       strideC2K,
+                                                       strideA1L,
+                                                       strideA2K,
+                                                       strideB1J,
+                                                       strideB2K,
+                                                       sizeI,
+                                                       sizeJ,
+                                                       sizeK,
+                                                       sizeL);
+
+    auto get_solution = [&]() {
+        const tensile_table_solution* solution = tensile_picked_solution(ProblemType(), key);
+        return solution ? tensile_table_pointer<P>(*solution)
+                        : tensile_get_for_problem<P, GetSolution>(key, stream);
+    };
+
+    if(!tensile_solution_cache_enabled())
+        return get_solution();
+
+    static tensile_solution_cache<P> cache;
+
+    return cache.lookup(key, get_solution);
+}
+
+// the name of forced, if it is not nullptr, else of the solution
+// tensile_cached_solution runs for the problem
+template <TENSILE_GETTER(const char*, GetName), const char* (*ProblemType)()>
+const char* tensile_solution_name(unsigned int strideC1J,
+                                  unsigned int strideC2K,
+                                  unsigned int strideA1L,
+                                  unsigned int strideA2K,
+                                  unsigned int strideB1J,
+                                  unsigned int strideB2K,
+                                  unsigned int sizeI,
+                                  unsigned int sizeJ,
+                                  unsigned int sizeK,
+                                  unsigned int sizeL,
+                                  int device,
+                                  hipStream_t stream,
+                                  const tensile_table_solution* forced)
+{
+    if(forced)
+        return forced->name;
+
+    tensile_problem_key key = tensile_make_problem_key(device,
+                                                       strideC1J,
+                                                       strideC2K,
+                                                       strideA1L,
+                                                       strideA2K,
+                                                       strideB1J,
+                                                       strideB2K,
+                                                       sizeI,
+                                                       sizeJ,
+                                                       sizeK,
+                                                       sizeL);
+
+    const tensile_table_solution* solution = tensile_picked_solution(ProblemType(), key);
+    return solution ? solution->name : tensile_get_for_problem<const char*, GetName>(key, stream);
+}
+
+#undef TENSILE_GETTER
+
+#endif
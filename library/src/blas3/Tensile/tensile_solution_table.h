@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TENSILE_SOLUTION_TABLE_H
+#define TENSILE_SOLUTION_TABLE_H
+#include <cstddef>
+#include "tensile_perf_model.h"
+
+/*******************************************************************************
+ * Tensile solution table
+ *
+ * The solutions compiled into the library, written at build time by
+ * tensile_solution_table.py from the Logic files TensileCreateLibrary
+ * compiles. A schedule holds the solutions of one Logic file in the order of
+ * the file, so solution i of a schedule is solution i of its exact table.
+ * Each solution function has the TensileSolutionPointer_* type of its problem
+ * type, and is kept here without it.
+ ******************************************************************************/
+
+typedef void (*tensile_table_function)();
+
+struct tensile_table_solution
+{
+    const char* name; // the function's name, as TensileCreateLibrary gives it
+    tensile_table_function function; // nullptr if the Logic file marks it not valid
+    int macro_tile0;
+    int macro_tile1;
+    int depth_u;
+    int global_split_u;
+    int local_split_u;
+    int num_threads;
+    int assert_free0_multiple;
+    int assert_free1_multiple;
+    int assert_summation_multiple;
+};
+
+struct tensile_table_schedule
+{
+    const char* problem_type; // e.g. Cijk_Ailk_Bljk_SB
+    const char* schedule; // e.g. vega10
+    const char* arch; // e.g. gfx900
+    const char* const* device_names; // ends with nullptr
+    bool fallback; // for the devices no other schedule of the problem type names
+    const tensile_table_solution* solutions;
+    size_t solution_count;
+};
+
+// the schedules of the build, those of a problem type together with the one
+// Tensile falls back to last
+const tensile_table_schedule* tensile_table_schedules(size_t& count);
+
+// a hash of the table, which changes with the solutions built into the library
+const char* tensile_table_hash();
+
+// the schedule of the problem type Tensile runs on the device: the first that
+// names the device, else the last of the problem type; nullptr if none
+const tensile_table_schedule* tensile_table_schedule_for(const char* problem_type, int device);
+
+// false if the solution is not valid or its size asserts fail for size
+inline bool tensile_table_can_run(const tensile_table_solution& s, const tensile_logic_size& size)
+{
+    return s.function && size[0] % (s.assert_free0_multiple > 1 ? s.assert_free0_multiple : 1) == 0 &&
+           size[1] % (s.assert_free1_multiple > 1 ? s.assert_free1_multiple : 1) == 0 &&
+           size[3] % (s.assert_summation_multiple > 1 ? s.assert_summation_multiple : 1) == 0;
+}
+
+// the solution function, in the type of its problem type
+template <typename P>
+P tensile_table_pointer(const tensile_table_solution& s)
+{
+    return reinterpret_cast<P>(s.function);
+}
+
+#endif
@@ -0,0 +1,180 @@
+#!/usr/bin/python
+"""Write the table of the Tensile solutions compiled into rocBLAS
+
+TensileCreateLibrary turns the Logic files of a directory into the solution
+functions of the library and the logic that picks among them. This script
+reads the same files, in the same order and with Tensile's own modules, and
+writes a C++ source listing per Logic file the solutions in the order of the
+file, each with its function, the name TensileCreateLibrary gives it and the
+parameters rocBLAS checks and reports. A solution index thus means the same
+to rocBLAS as to the exact table of the file. See tensile_solution_table.h.
+
+With --solutions-header, the names are checked against the Solutions.h that
+TensileCreateLibrary wrote, and the script fails if one is not declared
+there, rather than the build failing to link or the table pointing at the
+wrong solutions when the naming of the Tensile fetched has changed.
+
+usage: tensile_solution_table.py TENSILE_ROOT LOGIC_PATH OUTPUT [--short-file-names]
+                                 [--solutions-header SOLUTIONS_H]
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import sys
+
+import yaml
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('tensile_root', help='the Tensile_ROOT of the build')
+    parser.add_argument('logic_path', help='the directory TensileCreateLibrary compiles')
+    parser.add_argument('output', help='the C++ source to write')
+    parser.add_argument('--short-file-names', dest='short_names', action='store_true',
+                        help='as passed to TensileCreateLibrary')
+    parser.add_argument('--solutions-header', dest='solutions_header',
+                        help='the Solutions.h of TensileCreateLibrary to check the names against')
+    return parser.parse_args()
+
+
+def check_names(names, solutions_header):
+    """Fail unless every name is a function declared in solutions_header"""
+    with open(solutions_header) as stream:
+        declared = set(re.findall(r'(\w+)\s*\(', stream.read()))
+
+    missing = sorted(set(names) - declared)
+    if missing:
+        sys.stderr.write('tensile_solution_table.py: %d of the %d solution names are not declared '
+                         'in %s, so the Tensile of tensile_tag names its solutions otherwise; '
+                         'first: %s\n' % (len(missing), len(set(names)), solutions_header,
+                                           missing[0]))
+        sys.exit(1)
+
+
+def read_logic(logic_path, YAMLIO):
+    """The schedules of the Logic files, as TensileCreateLibrary lists them"""
+    names = [os.path.join(logic_path, f) for f in os.listdir(logic_path)
+             if os.path.isfile(os.path.join(logic_path, f))
+             and os.path.splitext(f)[1] == '.yaml']
+
+    schedules = []
+    for name in names:
+        logic = YAMLIO.readLibraryLogicForSchedule(name)
+        with open(name) as stream:
+            arch = yaml.safe_load(stream)[2]
+        schedules.append({'problem_type': str(logic[2]),
+                          'schedule': logic[0],
+                          'arch': arch,
+                          'devices': logic[1],
+                          'solutions': logic[3]})
+    return schedules
+
+
+def solution_value(s, key, default):
+    try:
+        return s[key]
+    except KeyError:
+        return default
+
+
+def solution_row(s, name):
+    """The initializer of a tensile_table_solution"""
+    valid = solution_value(s, 'Valid', True)
+    fields = ['"%s"' % name,
+              'reinterpret_cast<tensile_table_function>(&%s)' % name if valid else 'nullptr']
+    fields += [str(solution_value(s, key, default)) for key, default in
+               [('MacroTile0', 0), ('MacroTile1', 0), ('DepthU', 0),
+                ('GlobalSplitU', 1), ('LocalSplitU', 1), ('NumThreads', 0),
+                ('AssertFree0ElementMultiple', 1), ('AssertFree1ElementMultiple', 1),
+                ('AssertSummationElementMultiple', 1)]]
+    return '    {' + ', '.join(fields) + '},'
+
+
+def c_string(value):
+    return '"%s"' % str(value).replace('\\', '\\\\').replace('"', '\\"')
+
+
+def main():
+    args = parse_args()
+
+    # Tensile's modules import each other by their plain names
+    sys.path.insert(0, os.path.join(args.tensile_root, 'Tensile'))
+    from Common import assignGlobalParameters
+    from SolutionStructs import Solution
+    from SolutionWriter import SolutionWriter
+    import YAMLIO
+
+    assignGlobalParameters({'RuntimeLanguage': 'HIP',
+                            'MergeFiles': True,
+                            'ShortNames': args.short_names,
+                            'LibraryPrintDebug': False})
+
+    schedules = read_logic(args.logic_path, YAMLIO)
+
+    # the naming of TensileCreateLibrary depends on all the solutions at once
+    solutions = []
+    for schedule in schedules:
+        for s in schedule['solutions']:
+            if s not in solutions:
+                solutions.append(s)
+    kernels = []
+    for s in solutions:
+        for kernel in s.getKernels():
+            if kernel not in kernels:
+                kernels.append(kernel)
+    writer = SolutionWriter(Solution.getMinNaming(solutions),
+                            Solution.getSerialNaming(solutions) if args.short_names else None,
+                            Solution.getMinNaming(kernels),
+                            Solution.getSerialNaming(kernels) if args.short_names else None)
+
+    # schedules of a problem type are together, the one for other devices last
+    order = []
+    for schedule in schedules:
+        if schedule['problem_type'] not in order:
+            order.append(schedule['problem_type'])
+    schedules.sort(key=lambda s: (order.index(s['problem_type']), 'fallback' in s['devices']))
+
+    if args.solutions_header:
+        # the table refers to the functions of the valid solutions only
+        check_names([writer.getSolutionName(s) for schedule in schedules
+                     for s in schedule['solutions'] if solution_value(s, 'Valid', True)],
+                    args.solutions_header)
+
+    table = []
+    for i, schedule in enumerate(schedules):
+        table.append('const char* const devices_%d[] = {%s};'
+                     % (i, ', '.join([c_string(d) for d in schedule['devices']] + ['nullptr'])))
+        table.append('const tensile_table_solution solutions_%d[] = {' % i)
+        table += [solution_row(s, writer.getSolutionName(s)) for s in schedule['solutions']]
+        table.append('};')
+        table.append('')
+
+    table.append('const tensile_table_schedule schedules[] = {')
+    for i, schedule in enumerate(schedules):
+        table.append('    {%s, %s, %s, devices_%d, %s, solutions_%d, %d},'
+                     % (c_string(schedule['problem_type']), c_string(schedule['schedule']),
+                        c_string(schedule['arch']), i,
+                        'true' if 'fallback' in schedule['devices'] else 'false',
+                        i, len(schedule['solutions'])))
+    table.append('};')
+
+    digest = hashlib.sha1('\n'.join(table).encode('utf-8')).hexdigest()[:16]
+
+    with open(args.output, 'w') as out:
+        out.write('// written by tensile_solution_table.py from %s; do not edit\n\n'
+                  % os.path.basename(os.path.normpath(args.logic_path)))
+        out.write('#include "Tensile.h"\n#include "Solutions.h"\n'
+                  '#include "tensile_solution_table.h"\n\n')
+        out.write('namespace\n{\n')
+        out.write('\n'.join(table))
+        out.write('\n} // namespace\n\n')
+        out.write('const tensile_table_schedule* tensile_table_schedules(size_t& count)\n{\n'
+                  '    count = sizeof(schedules) / sizeof(schedules[0]);\n'
+                  '    return schedules;\n}\n\n')
+        out.write('const char* tensile_table_hash() { return "%s"; }\n' % digest)
+
+
+if __name__ == '__main__':
+    main()
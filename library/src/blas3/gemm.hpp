@@ -44,8 +44,6 @@ rocblas_status rocblas_gemm_strided_batched_template(rocblas_handle handle,
                                                      rocblas_int bsc,
                                                      rocblas_int batch_count);
 
-#define COMPLEX 0
-
 /* ============================================================================================ */
 
 /*
@@ -166,27 +164,6 @@ rocblas_status rocblas_gemm_template<double>(rocblas_handle handle,
     return rocblas_dgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-#if COMPLEX
-
-template <>
-rocblas_status rocblas_gemm_template<rocblas_half_complex>(rocblas_handle handle,
-                                                           rocblas_operation transA,
-                                                           rocblas_operation transB,
-                                                           rocblas_int M,
-                                                           rocblas_int N,
-                                                           rocblas_int K,
-                                                           const rocblas_half_complex* alpha,
-                                                           const rocblas_half_complex* A,
-                                                           rocblas_int lda,
-                                                           const rocblas_half_complex* B,
-                                                           rocblas_int ldb,
-                                                           const rocblas_half_complex* beta,
-                                                           rocblas_half_complex* C,
-                                                           rocblas_int ldc)
-{
-    return rocblas_qgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
-}
-
 template <>
 rocblas_status rocblas_gemm_template<rocblas_float_complex>(rocblas_handle handle,
                                                             rocblas_operation transA,
@@ -225,7 +202,6 @@ rocblas_status rocblas_gemm_template<rocblas_double_complex>(rocblas_handle hand
     return rocblas_zgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-#endif
 /* ============================================================================================ */
 
 /*! \brief BLAS Level 3 API
@@ -418,49 +394,6 @@ rocblas_status rocblas_gemm_strided_batched_template<double>(rocblas_handle hand
                                          batch_count);
 }
 
-#if COMPLEX
-
-template <>
-rocblas_status
-rocblas_gemm_strided_batched_template<rocblas_half_complex>(rocblas_handle handle,
-                                                            rocblas_operation transA,
-                                                            rocblas_operation transB,
-                                                            rocblas_int M,
-                                                            rocblas_int N,
-                                                            rocblas_int K,
-                                                            const rocblas_half_complex* alpha,
-                                                            const rocblas_half_complex* A,
-                                                            rocblas_int lda,
-                                                            rocblas_int bsa,
-                                                            const rocblas_half_complex* B,
-                                                            rocblas_int ldb,
-                                                            rocblas_int bsb,
-                                                            const rocblas_half_complex* beta,
-                                                            rocblas_half_complex* C,
-                                                            rocblas_int ldc,
-                                                            rocblas_int bsc,
-                                                            rocblas_int batch_count)
-{
-    return rocblas_qgemm_strided_batched(handle,
-                                         transA,
-                                         transB,
-                                         M,
-                                         N,
-                                         K,
-                                         alpha,
-                                         A,
-                                         lda,
-                                         bsa,
-                                         B,
-                                         ldb,
-                                         bsb,
-                                         beta,
-                                         C,
-                                         ldc,
-                                         bsc,
-                                         batch_count);
-}
-
 template <>
 rocblas_status
 rocblas_gemm_strided_batched_template<rocblas_float_complex>(rocblas_handle handle,
@@ -543,6 +476,4 @@ rocblas_gemm_strided_batched_template<rocblas_double_complex>(rocblas_handle han
                                          batch_count);
 }
 
-#endif
-
 #endif // _GEMM_HPP_
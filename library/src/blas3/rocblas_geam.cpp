@@ -247,8 +247,8 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
                   (const void*&)C,
                   ldc);
 
-        std::string transA_letter = rocblas_transpose_letter(transA);
-        std::string transB_letter = rocblas_transpose_letter(transB);
+        const char* transA_letter = rocblas_transpose_letter(transA);
+        const char* transB_letter = rocblas_transpose_letter(transB);
 
         log_bench(handle,
                   "./rocblas-bench -f geam -r",
@@ -290,6 +290,20 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
                   ldc);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "geam", alpha, beta);
+
+        record.trans_a = *rocblas_transpose_letter(transA);
+        record.trans_b = *rocblas_transpose_letter(transB);
+        record.m       = m;
+        record.n       = n;
+        record.lda     = lda;
+        record.ldb     = ldb;
+        record.ldc     = ldc;
+        log_capture(handle, record);
+    }
+
     int dim1_A, dim2_A, dim1_B, dim2_B;
     // quick return
     if(0 == m || 0 == n)
@@ -335,6 +349,18 @@ rocblas_status rocblas_geam_template(rocblas_handle handle,
         return rocblas_status_invalid_size;
     }
 
+    auto timing = log_timing(handle,
+                             rocblas_geam_flop_count<T>(m, n),
+                             replaceX<T>("rocblas_Xgeam"),
+                             "transA",
+                             rocblas_transpose_letter(transA),
+                             "transB",
+                             rocblas_transpose_letter(transB),
+                             "M",
+                             m,
+                             "N",
+                             n);
+
     hipStream_t rocblas_stream = handle->rocblas_stream;
 
     if((rocblas_pointer_mode_host == handle->pointer_mode) && (0 == *alpha) && (0 == *beta))
@@ -9,7 +9,6 @@
 #include "definitions.h"
 #include "gemm.hpp"
 #include "trtri_trsm.hpp"
-#include "rocblas_unique_ptr.hpp"
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
@@ -700,9 +699,14 @@ rocblas_status special_trsm_template(rocblas_handle handle,
     hipStream_t rocblas_stream;
     RETURN_IF_ROCBLAS_ERROR(rocblas_get_stream(handle, &rocblas_stream));
 
-    void* Y      = handle->get_trsm_Y();
-    void* invA   = handle->get_trsm_invA();
-    void* invA_C = handle->get_trsm_invA_C();
+    // held until return, so no other handle reuses the buffers before this work is queued
+    auto workspace = handle->acquire_trsm_workspace();
+    if(!workspace)
+        return rocblas_status_memory_error;
+
+    void* Y      = workspace.get_Y();
+    void* invA   = workspace.get_invA();
+    void* invA_C = workspace.get_invA_C();
 
     PRINT_IF_HIP_ERROR(
         hipMemsetAsync(invA, 0, BLOCK * BLOCK * WORKBUF_TRSM_A_BLKS * sizeof(T), rocblas_stream));
@@ -999,10 +1003,10 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
                   (const void*&)B,
                   ldb);
 
-        std::string side_letter   = rocblas_side_letter(side);
-        std::string uplo_letter   = rocblas_fill_letter(uplo);
-        std::string transA_letter = rocblas_transpose_letter(transA);
-        std::string diag_letter   = rocblas_diag_letter(diag);
+        const char* side_letter   = rocblas_side_letter(side);
+        const char* uplo_letter   = rocblas_fill_letter(uplo);
+        const char* transA_letter = rocblas_transpose_letter(transA);
+        const char* diag_letter   = rocblas_diag_letter(diag);
 
         log_bench(handle,
                   "./rocblas-bench -f trsm -r",
@@ -1043,6 +1047,21 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
                   ldb);
     }
 
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record = rocblas_capture_start<T>(handle, "trsm", alpha);
+
+        record.side    = *rocblas_side_letter(side);
+        record.uplo    = *rocblas_fill_letter(uplo);
+        record.trans_a = *rocblas_transpose_letter(transA);
+        record.diag    = *rocblas_diag_letter(diag);
+        record.m       = m;
+        record.n       = n;
+        record.lda     = lda;
+        record.ldb     = ldb;
+        log_capture(handle, record);
+    }
+
     if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
         return rocblas_status_not_implemented;
     else if(m < 0)
@@ -1064,7 +1083,37 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
     if(m == 0 || n == 0)
         return rocblas_status_success;
 
-    if((k % BLOCK == 0) && (k <= BLOCK * WORKBUF_TRSM_A_BLKS))
+    bool special_trsm = (k % BLOCK == 0) && (k <= BLOCK * WORKBUF_TRSM_A_BLKS);
+
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+    {
+        if(special_trsm)
+            return rocblas_status_success;
+        return handle->set_optimal_device_memory_size(
+            BLOCK * k * sizeof(T),
+            sizeof(T) * (BLOCK / 2) * (BLOCK / 2) * (k / BLOCK),
+            m * n * sizeof(T),
+            m * n * sizeof(T));
+    }
+
+    auto timing = log_timing(handle,
+                             rocblas_trsm_flop_count<T>(m, n, k),
+                             replaceX<T>("rocblas_Xtrsm"),
+                             "side",
+                             rocblas_side_letter(side),
+                             "uplo",
+                             rocblas_fill_letter(uplo),
+                             "transA",
+                             rocblas_transpose_letter(transA),
+                             "diag",
+                             rocblas_diag_letter(diag),
+                             "M",
+                             m,
+                             "N",
+                             n);
+
+    if(special_trsm)
     {
         rocblas_operation trA = transA;
         if(trA == rocblas_operation_conjugate_transpose)
@@ -1075,32 +1124,28 @@ rocblas_status rocblas_trsm_template(rocblas_handle handle,
     }
 
     // invA is of size BLOCK*k, BLOCK is the blocking size
-    // used unique_ptr to avoid memory leak
-    auto invA =
-        rocblas_unique_ptr{rocblas::device_malloc(BLOCK * k * sizeof(T)), rocblas::device_free};
+    // scratch memory comes from the handle and is released when it goes out of scope
+    auto invA = handle->device_malloc(BLOCK * k * sizeof(T));
     if(!invA)
     {
         return rocblas_status_memory_error;
     }
 
-    auto C_tmp = rocblas_unique_ptr{
-        rocblas::device_malloc(sizeof(T) * (BLOCK / 2) * (BLOCK / 2) * (k / BLOCK)),
-        rocblas::device_free};
+    auto C_tmp = handle->device_malloc(sizeof(T) * (BLOCK / 2) * (BLOCK / 2) * (k / BLOCK));
     if((!C_tmp) && (k >= BLOCK))
     {
         return rocblas_status_memory_error;
     }
 
     // copy B to packed storage
-    auto packedB =
-        rocblas_unique_ptr{rocblas::device_malloc(m * n * sizeof(T)), rocblas::device_free};
+    auto packedB = handle->device_malloc(m * n * sizeof(T));
     if(!packedB)
     {
         return rocblas_status_memory_error;
     }
 
     // X is also packed size of B
-    auto X = rocblas_unique_ptr{rocblas::device_malloc(m * n * sizeof(T)), rocblas::device_free};
+    auto X = handle->device_malloc(m * n * sizeof(T));
     if(!X)
     {
         return rocblas_status_memory_error;
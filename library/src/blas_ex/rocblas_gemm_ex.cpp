@@ -11,8 +11,367 @@
 #include "handle.h"
 #include "logging.h"
 #include "utility.h"
+#include <limits>
 #include <type_traits>
+#include <vector>
+#include "gemm_batched.h"
+#include "gemm_bf16.h"
+#include "gemm_device.h"
+#include "gemm_epilogue.h"
+#include "gemm_grouped.h"
+#include "gemm_split_k.h"
+#include "tensile_dispatch.h"
 #include "rocblas_gemm_ex.hpp"
+#include "rocblas_gemm_ex_dispatch.hpp"
+
+// true if every size, leading dimension and stride fits in a rocblas_int
+template <typename... Ts>
+static bool gemm_ex_fits_int(Ts... values)
+{
+    for(int64_t value : {int64_t(values)...})
+        if(value > std::numeric_limits<int32_t>::max())
+            return false;
+    return true;
+}
+
+/*******************************************************************************
+ * Functors of gemm_ex_dispatch (see rocblas_gemm_ex_dispatch.hpp). Each holds
+ * the arguments of its routine, packs k for int8 and runs the routine for the
+ * datatypes picked; the types a routine has no path for are not implemented.
+ ******************************************************************************/
+
+// the 64-bit path of rocblas_gemm_strided_batched_ex_64 and rocblas_gemm_ex_64
+struct gemm_ex_64_functor
+{
+    rocblas_handle handle;
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    int64_t m;
+    int64_t n;
+    int64_t k;
+    const void* alpha;
+    const void* a;
+    int64_t lda;
+    int64_t stride_a;
+    const void* b;
+    int64_t ldb;
+    int64_t stride_b;
+    const void* beta;
+    const void* c;
+    int64_t ldc;
+    int64_t stride_c;
+    void* d;
+    int64_t ldd;
+    int64_t stride_d;
+    int64_t batch_count;
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+    {
+        if(!gemm_ex_pack_k<Ti>(trans_a, trans_b, k, lda, ldb, stride_a, stride_b))
+            return rocblas_status_invalid_size;
+
+        return gemm_ex_64_typecasting<Ti, To, Tc>(
+            handle, trans_a, trans_b, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta,
+            c, ldc, stride_c, d, ldd, stride_d, batch_count);
+    }
+
+    // bfloat16 needs workspaces of the size of the problem, and has no 64-bit path
+    template <typename To>
+    rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+    {
+        return rocblas_status_not_implemented;
+    }
+};
+
+// rocblas_gemm_ex and rocblas_gemm_strided_batched_ex
+struct gemm_ex_strided_functor
+{
+    rocblas_handle handle;
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int k;
+    const void* alpha;
+    const void* a;
+    rocblas_int lda;
+    rocblas_int stride_a;
+    const void* b;
+    rocblas_int ldb;
+    rocblas_int stride_b;
+    const void* beta;
+    const void* c;
+    rocblas_int ldc;
+    rocblas_int stride_c;
+    void* d;
+    rocblas_int ldd;
+    rocblas_int stride_d;
+    rocblas_int batch_count;
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+    {
+        if(!gemm_ex_pack_k<Ti>(trans_a, trans_b, k, lda, ldb, stride_a, stride_b))
+            return rocblas_status_invalid_size;
+
+        return gemm_ex_typecasting<Ti, To, Tc>(handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a,
+                                               lda,
+                                               stride_a,
+                                               b,
+                                               ldb,
+                                               stride_b,
+                                               beta,
+                                               c,
+                                               ldc,
+                                               stride_c,
+                                               d,
+                                               ldd,
+                                               stride_d,
+                                               batch_count);
+    }
+
+    // A and B are widened to float (see gemm_bf16.h)
+    template <typename To>
+    rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+    {
+        return gemm_ex_bf16_typecasting<To>(handle,
+                                            trans_a,
+                                            trans_b,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            a,
+                                            lda,
+                                            stride_a,
+                                            b,
+                                            ldb,
+                                            stride_b,
+                                            beta,
+                                            c,
+                                            ldc,
+                                            stride_c,
+                                            d,
+                                            ldd,
+                                            stride_d,
+                                            batch_count);
+    }
+};
+
+// rocblas_gemm_batched_ex
+struct gemm_ex_batched_functor
+{
+    rocblas_handle handle;
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int k;
+    const void* alpha;
+    const void* a;
+    rocblas_int lda;
+    const void* b;
+    rocblas_int ldb;
+    const void* beta;
+    const void* c;
+    rocblas_int ldc;
+    void* d;
+    rocblas_int ldd;
+    rocblas_int batch_count;
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+    {
+        if(!gemm_ex_pack_k<Ti>(trans_a, trans_b, k, lda, ldb))
+            return rocblas_status_invalid_size;
+
+        return gemm_batched_ex_typecasting<Ti, To, Tc>(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       a,
+                                                       lda,
+                                                       b,
+                                                       ldb,
+                                                       beta,
+                                                       c,
+                                                       ldc,
+                                                       d,
+                                                       ldd,
+                                                       batch_count);
+    }
+
+    template <typename To>
+    rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+    {
+        return rocblas_status_not_implemented;
+    }
+};
+
+// rocblas_gemm_grouped_ex
+struct gemm_ex_grouped_functor
+{
+    rocblas_handle handle;
+    const rocblas_operation* trans_a;
+    const rocblas_operation* trans_b;
+    const rocblas_int* m;
+    const rocblas_int* n;
+    const rocblas_int* k;
+    const void* alpha;
+    const void* a;
+    const rocblas_int* lda;
+    const void* b;
+    const rocblas_int* ldb;
+    const void* beta;
+    const void* c;
+    const rocblas_int* ldc;
+    void* d;
+    const rocblas_int* ldd;
+    rocblas_int group_count;
+    const rocblas_int* group_size;
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+    {
+        return gemm_grouped_ex_typecasting<Ti, To, Tc>(
+            handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, d, ldd,
+            group_count, group_size);
+    }
+
+    // k and the leading dimensions are packed group by group
+    rocblas_status operator()(gemm_ex_types<TensileInt8x4, TensileInt32, TensileInt32>)
+    {
+        std::vector<rocblas_int> k4(k, k + group_count);
+        std::vector<rocblas_int> lda4(lda, lda + group_count);
+        std::vector<rocblas_int> ldb4(ldb, ldb + group_count);
+
+        for(rocblas_int g = 0; g < group_count; g++)
+            if(!gemm_ex_pack_k<TensileInt8x4>(trans_a[g], trans_b[g], k4[g], lda4[g], ldb4[g]))
+                return rocblas_status_invalid_size;
+
+        return gemm_grouped_ex_typecasting<TensileInt8x4, TensileInt32, TensileInt32>(
+            handle, trans_a, trans_b, m, n, k4.data(), alpha, a, lda4.data(), b, ldb4.data(),
+            beta, c, ldc, d, ldd, group_count, group_size);
+    }
+
+    template <typename To>
+    rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+    {
+        return rocblas_status_not_implemented;
+    }
+};
+
+// rocblas_gemm_ex_epilogue; D is To unless run is called with another Td
+struct gemm_ex_epilogue_functor
+{
+    rocblas_handle handle;
+    rocblas_operation trans_a;
+    rocblas_operation trans_b;
+    rocblas_int m;
+    rocblas_int n;
+    rocblas_int k;
+    const void* alpha;
+    const void* a;
+    rocblas_int lda;
+    const void* b;
+    rocblas_int ldb;
+    const void* beta;
+    const void* c;
+    rocblas_int ldc;
+    void* d;
+    rocblas_int ldd;
+    const rocblas_gemm_epilogue& epilogue;
+
+    template <typename Ti, typename To, typename Tc, typename Td>
+    rocblas_status run()
+    {
+        if(!gemm_ex_pack_k<Ti>(trans_a, trans_b, k, lda, ldb))
+            return rocblas_status_invalid_size;
+
+        return gemm_ex_epilogue_typecasting<Ti, To, Tc, Td>(
+            handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, d, ldd,
+            epilogue);
+    }
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+    {
+        return run<Ti, To, Tc, To>();
+    }
+
+    template <typename To>
+    rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+    {
+        return rocblas_status_not_implemented;
+    }
+};
+
+// type dispatch of the 64-bit path; the arguments have been checked
+static rocblas_status gemm_ex_64_dispatch(rocblas_handle handle,
+                                          rocblas_operation trans_a,
+                                          rocblas_operation trans_b,
+                                          int64_t m,
+                                          int64_t n,
+                                          int64_t k,
+                                          const void* alpha,
+                                          const void* a,
+                                          rocblas_datatype a_type,
+                                          int64_t lda,
+                                          int64_t stride_a,
+                                          const void* b,
+                                          rocblas_datatype b_type,
+                                          int64_t ldb,
+                                          int64_t stride_b,
+                                          const void* beta,
+                                          const void* c,
+                                          rocblas_datatype c_type,
+                                          int64_t ldc,
+                                          int64_t stride_c,
+                                          void* d,
+                                          rocblas_datatype d_type,
+                                          int64_t ldd,
+                                          int64_t stride_d,
+                                          int64_t batch_count,
+                                          rocblas_datatype compute_type)
+{
+    return gemm_ex_dispatch(a_type,
+                            b_type,
+                            c_type,
+                            d_type,
+                            compute_type,
+                            gemm_ex_64_functor{handle,
+                                               trans_a,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a,
+                                               lda,
+                                               stride_a,
+                                               b,
+                                               ldb,
+                                               stride_b,
+                                               beta,
+                                               c,
+                                               ldc,
+                                               stride_c,
+                                               d,
+                                               ldd,
+                                               stride_d,
+                                               batch_count});
+}
 
 /*! \brief BLAS EX API
 
@@ -96,11 +455,14 @@
               specifies the datatype of computation
     @param[in]
     algo      rocblas_gemm_algo
-              enumerant specifying the algorithm type.
+              enumerant specifying the algorithm type. With
+              rocblas_gemm_algo_solution_index the solution of solution_index runs.
     @param[in]
     solution_index
               int32_t
-              reserved for future use
+              with rocblas_gemm_algo_solution_index, the solution_index of a
+              solution listed by rocblas_gemm_ex_get_solutions for the problem;
+              -1 runs the solution picked without it
     @param[in]
     flags     uint32_t
               reserved for future use
@@ -151,147 +513,204 @@ extern "C" rocblas_status rocblas_gemm_ex(rocblas_handle handle,
         return rocblas_status_invalid_pointer;
     }
 
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    if(rocblas_logging_enabled(handle))
     {
-
-        double alpha_double;
-        double beta_double;
-        if(compute_type == rocblas_datatype_f16_r)
-        {
-            _Float16 alpha_half = *(static_cast<const _Float16*>(alpha));
-            _Float16 beta_half  = *(static_cast<const _Float16*>(beta));
-            alpha_double        = static_cast<const double>(alpha_half);
-            beta_double         = static_cast<const double>(beta_half);
-        }
-        else if(compute_type == rocblas_datatype_f32_r)
-        {
-            float alpha_float = *(static_cast<const float*>(alpha));
-            float beta_float  = *(static_cast<const float*>(beta));
-            alpha_double      = static_cast<const double>(alpha_float);
-            beta_double       = static_cast<const double>(beta_float);
-        }
-        else if(compute_type == rocblas_datatype_f64_r)
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            alpha_double = *(static_cast<const double*>(alpha));
-            beta_double  = *(static_cast<const double*>(beta));
+
+            double alpha_double;
+            double beta_double;
+            if(compute_type == rocblas_datatype_f16_r)
+            {
+                _Float16 alpha_half = *(static_cast<const _Float16*>(alpha));
+                _Float16 beta_half  = *(static_cast<const _Float16*>(beta));
+                alpha_double        = static_cast<const double>(alpha_half);
+                beta_double         = static_cast<const double>(beta_half);
+            }
+            else if(compute_type == rocblas_datatype_f32_r)
+            {
+                float alpha_float = *(static_cast<const float*>(alpha));
+                float beta_float  = *(static_cast<const float*>(beta));
+                alpha_double      = static_cast<const double>(alpha_float);
+                beta_double       = static_cast<const double>(beta_float);
+            }
+            else if(compute_type == rocblas_datatype_f64_r)
+            {
+                alpha_double = *(static_cast<const double*>(alpha));
+                beta_double  = *(static_cast<const double*>(beta));
+            }
+            else if(compute_type == rocblas_datatype_i32_r)
+            {
+                int alpha_int = *(static_cast<const int32_t*>(alpha));
+                int beta_int  = *(static_cast<const int32_t*>(beta));
+                alpha_double  = static_cast<const double>(alpha_int);
+                beta_double   = static_cast<const double>(beta_int);
+            }
+
+            log_trace(handle,
+                      "rocblas_gemm_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      alpha_double,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      beta_double,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      workspace_size,
+                      (const void*&)workspace);
+
+            const char* trans_a_letter = rocblas_transpose_letter(trans_a);
+            const char* trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            const char* a_type_letter       = rocblas_datatype_letter(a_type);
+            const char* b_type_letter       = rocblas_datatype_letter(b_type);
+            const char* c_type_letter       = rocblas_datatype_letter(c_type);
+            const char* d_type_letter       = rocblas_datatype_letter(d_type);
+            const char* compute_type_letter = rocblas_datatype_letter(compute_type);
+
+            log_bench(handle,
+                      "./rocblas-bench -f gemm_ex",
+                      "--transposeA",
+                      trans_a_letter,
+                      "--transposeB",
+                      trans_b_letter,
+                      "-m",
+                      m,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      "--alpha",
+                      alpha_double,
+                      "--a_type",
+                      a_type_letter,
+                      "--lda",
+                      lda,
+                      "--b_type",
+                      b_type_letter,
+                      "--ldb",
+                      ldb,
+                      "--beta",
+                      beta_double,
+                      "--c_type",
+                      c_type_letter,
+                      "--ldc",
+                      ldc,
+                      "--d_type",
+                      d_type_letter,
+                      "--ldd",
+                      ldd,
+                      "--compute_type",
+                      compute_type_letter,
+                      "--algo",
+                      algo,
+                      "--solution_index",
+                      solution_index,
+                      "--flags",
+                      flags,
+                      "--workspace_size",
+                      workspace_size);
         }
-        else if(compute_type == rocblas_datatype_i32_r)
+        else
         {
-            int alpha_int = *(static_cast<const int32_t*>(alpha));
-            int beta_int  = *(static_cast<const int32_t*>(beta));
-            alpha_double  = static_cast<const double>(alpha_int);
-            beta_double   = static_cast<const double>(beta_int);
+            log_trace(handle,
+                      "rocblas_gemm_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      (const void*&)alpha,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      (const void*&)beta,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      "--workspace_size",
+                      workspace_size);
         }
 
-        log_trace(handle,
-                  "rocblas_gemm_ex",
-                  trans_a,
-                  trans_b,
-                  m,
-                  n,
-                  k,
-                  alpha_double,
-                  (const void*&)a,
-                  a_type,
-                  lda,
-                  (const void*&)b,
-                  b_type,
-                  ldb,
-                  beta_double,
-                  (const void*&)c,
-                  c_type,
-                  ldc,
-                  (const void*&)d,
-                  d_type,
-                  ldd,
-                  compute_type,
-                  algo,
-                  solution_index,
-                  flags,
-                  workspace_size,
-                  (const void*&)workspace);
-
-        std::string trans_a_letter = rocblas_transpose_letter(trans_a);
-        std::string trans_b_letter = rocblas_transpose_letter(trans_b);
-
-        std::string a_type_letter       = rocblas_datatype_letter(a_type);
-        std::string b_type_letter       = rocblas_datatype_letter(b_type);
-        std::string c_type_letter       = rocblas_datatype_letter(c_type);
-        std::string d_type_letter       = rocblas_datatype_letter(d_type);
-        std::string compute_type_letter = rocblas_datatype_letter(compute_type);
-
-        log_bench(handle,
-                  "./rocblas-bench -f gemm_ex",
-                  "--transposeA",
-                  trans_a_letter,
-                  "--transposeB",
-                  trans_b_letter,
-                  "-m",
-                  m,
-                  "-n",
-                  n,
-                  "-k",
-                  k,
-                  "--alpha",
-                  alpha_double,
-                  "--a_type",
-                  a_type_letter,
-                  "--lda",
-                  lda,
-                  "--b_type",
-                  b_type_letter,
-                  "--ldb",
-                  ldb,
-                  "--beta",
-                  beta_double,
-                  "--c_type",
-                  c_type_letter,
-                  "--ldc",
-                  ldc,
-                  "--d_type",
-                  d_type_letter,
-                  "--ldd",
-                  ldd,
-                  "--compute_type",
-                  compute_type_letter,
-                  "--algo",
-                  algo,
-                  "--solution_index",
-                  solution_index,
-                  "--flags",
-                  flags,
-                  "--workspace_size",
-                  workspace_size);
+        log_profile(handle,
+                    "rocblas_gemm_ex",
+                    "transA",
+                    rocblas_transpose_letter(trans_a),
+                    "transB",
+                    rocblas_transpose_letter(trans_b),
+                    "M",
+                    m,
+                    "N",
+                    n,
+                    "K",
+                    k,
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "b_type",
+                    rocblas_datatype_letter(b_type),
+                    "c_type",
+                    rocblas_datatype_letter(c_type),
+                    "d_type",
+                    rocblas_datatype_letter(d_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type));
     }
-    else
+
+    if(rocblas_capture_enabled(handle))
     {
-        log_trace(handle,
-                  "rocblas_gemm_ex",
-                  trans_a,
-                  trans_b,
-                  m,
-                  n,
-                  k,
-                  (const void*&)alpha,
-                  (const void*&)a,
-                  a_type,
-                  lda,
-                  (const void*&)b,
-                  b_type,
-                  ldb,
-                  (const void*&)beta,
-                  (const void*&)c,
-                  c_type,
-                  ldc,
-                  (const void*&)d,
-                  d_type,
-                  ldd,
-                  compute_type,
-                  algo,
-                  solution_index,
-                  flags,
-                  "--workspace_size",
-                  workspace_size);
+        rocblas_capture_record record =
+            rocblas_capture_start(handle,
+                                  "gemm_ex",
+                                  *rocblas_datatype_letter(a_type),
+                                  alpha,
+                                  beta,
+                                  rocblas_datatype_size(compute_type));
+
+        record.trans_a        = *rocblas_transpose_letter(trans_a);
+        record.trans_b        = *rocblas_transpose_letter(trans_b);
+        record.m              = m;
+        record.n              = n;
+        record.k              = k;
+        record.lda            = lda;
+        record.ldb            = ldb;
+        record.ldc            = ldc;
+        record.ldd            = ldd;
+        record.a_type         = a_type;
+        record.b_type         = b_type;
+        record.c_type         = c_type;
+        record.d_type         = d_type;
+        record.compute_type   = compute_type;
+        record.algo           = algo;
+        record.solution_index = solution_index;
+        record.flags          = flags;
+        record.workspace_size = workspace_size ? *workspace_size : 0;
+        log_capture(handle, record);
     }
 
     // quick return m,n,k equal to 0 is valid in BLAS
@@ -323,165 +742,59 @@ extern "C" rocblas_status rocblas_gemm_ex(rocblas_handle handle,
         return rocblas_status_invalid_size;
     }
 
-    rocblas_status rb_status = rocblas_status_internal_error;
-    rocblas_int batch_count  = 1;
-    rocblas_int stride_a     = trans_a == rocblas_operation_none ? lda * k : lda * m;
-    rocblas_int stride_b     = trans_b == rocblas_operation_none ? ldb * n : ldb * k;
-    rocblas_int stride_c     = ldc * n;
-    rocblas_int stride_d     = ldd * n;
-
-    if(a_type == rocblas_datatype_f64_r && b_type == rocblas_datatype_f64_r &&
-       c_type == rocblas_datatype_f64_r && d_type == rocblas_datatype_f64_r &&
-       compute_type == rocblas_datatype_f64_r)
-    {
-        rb_status = gemm_ex_typecasting<double, double, double>(handle,
-                                                                trans_a,
-                                                                trans_b,
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                alpha,
-                                                                a,
-                                                                lda,
-                                                                stride_a,
-                                                                b,
-                                                                ldb,
-                                                                stride_b,
-                                                                beta,
-                                                                c,
-                                                                ldc,
-                                                                stride_c,
-                                                                d,
-                                                                ldd,
-                                                                stride_d,
-                                                                batch_count);
-    }
-    else if(a_type == rocblas_datatype_f32_r && b_type == rocblas_datatype_f32_r &&
-            c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r &&
-            compute_type == rocblas_datatype_f32_r)
-    {
-        rb_status = gemm_ex_typecasting<float, float, float>(handle,
-                                                             trans_a,
-                                                             trans_b,
-                                                             m,
-                                                             n,
-                                                             k,
-                                                             alpha,
-                                                             a,
-                                                             lda,
-                                                             stride_a,
-                                                             b,
-                                                             ldb,
-                                                             stride_b,
-                                                             beta,
-                                                             c,
-                                                             ldc,
-                                                             stride_c,
-                                                             d,
-                                                             ldd,
-                                                             stride_d,
-                                                             batch_count);
-    }
-    else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
-            c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
-            compute_type == rocblas_datatype_f16_r)
-    {
-        rb_status = gemm_ex_typecasting<_Float16, _Float16, _Float16>(handle,
-                                                                      trans_a,
-                                                                      trans_b,
-                                                                      m,
-                                                                      n,
-                                                                      k,
-                                                                      alpha,
-                                                                      a,
-                                                                      lda,
-                                                                      stride_a,
-                                                                      b,
-                                                                      ldb,
-                                                                      stride_b,
-                                                                      beta,
-                                                                      c,
-                                                                      ldc,
-                                                                      stride_c,
-                                                                      d,
-                                                                      ldd,
-                                                                      stride_d,
-                                                                      batch_count);
-    }
-    else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
-            c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
-            compute_type == rocblas_datatype_f32_r)
-    {
-        rb_status = gemm_ex_typecasting<_Float16, _Float16, float>(handle,
-                                                                   trans_a,
-                                                                   trans_b,
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   alpha,
-                                                                   a,
-                                                                   lda,
-                                                                   stride_a,
-                                                                   b,
-                                                                   ldb,
-                                                                   stride_b,
-                                                                   beta,
-                                                                   c,
-                                                                   ldc,
-                                                                   stride_c,
-                                                                   d,
-                                                                   ldd,
-                                                                   stride_d,
-                                                                   batch_count);
-    }
-    else if(a_type == rocblas_datatype_i8_r && b_type == rocblas_datatype_i8_r &&
-            c_type == rocblas_datatype_i32_r && d_type == rocblas_datatype_i32_r &&
-            compute_type == rocblas_datatype_i32_r)
-    {
-        // For now, K must be a multiple of 4, and/or LDA/LDB based on transpose mode
-        if(k % 4 != 0 || (trans_a != rocblas_operation_none && lda % 4 != 0) ||
-           (trans_b == rocblas_operation_none && ldb % 4 != 0))
-        {
-            rb_status = rocblas_status_invalid_size;
-        }
-        else
-        {
-            // adjust by 4 for Tensile
-            lda      = (trans_a == rocblas_operation_none) ? lda : lda / 4;
-            ldb      = (trans_b == rocblas_operation_none) ? ldb / 4 : ldb;
-            stride_a = stride_a / 4;
-            stride_b = stride_b / 4;
-            k        = k / 4;
-
-            rb_status = gemm_ex_typecasting<TensileInt8x4, TensileInt32, TensileInt32>(handle,
-                                                                                       trans_a,
-                                                                                       trans_b,
-                                                                                       m,
-                                                                                       n,
-                                                                                       k,
-                                                                                       alpha,
-                                                                                       a,
-                                                                                       lda,
-                                                                                       stride_a,
-                                                                                       b,
-                                                                                       ldb,
-                                                                                       stride_b,
-                                                                                       beta,
-                                                                                       c,
-                                                                                       ldc,
-                                                                                       stride_c,
-                                                                                       d,
-                                                                                       ldd,
-                                                                                       stride_d,
-                                                                                       batch_count);
-        }
-    }
-    else
-    {
-        rb_status = rocblas_status_not_implemented;
-    }
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             rocblas_gemm_flop_count<float>(m, n, k),
+                             "rocblas_gemm_ex",
+                             "transA",
+                             rocblas_transpose_letter(trans_a),
+                             "transB",
+                             rocblas_transpose_letter(trans_b),
+                             "M",
+                             m,
+                             "N",
+                             n,
+                             "K",
+                             k,
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type));
 
-    return rb_status;
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    rocblas_int batch_count = 1;
+    rocblas_int stride_a    = trans_a == rocblas_operation_none ? lda * k : lda * m;
+    rocblas_int stride_b    = trans_b == rocblas_operation_none ? ldb * n : ldb * k;
+    rocblas_int stride_c    = ldc * n;
+    rocblas_int stride_d    = ldd * n;
+
+    return gemm_ex_dispatch(a_type,
+                            b_type,
+                            c_type,
+                            d_type,
+                            compute_type,
+                            gemm_ex_strided_functor{handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    lda,
+                                                    stride_a,
+                                                    b,
+                                                    ldb,
+                                                    stride_b,
+                                                    beta,
+                                                    c,
+                                                    ldc,
+                                                    stride_c,
+                                                    d,
+                                                    ldd,
+                                                    stride_d,
+                                                    batch_count});
 }
 
 /*! \brief BLAS EX API
@@ -588,11 +901,14 @@ extern "C" rocblas_status rocblas_gemm_ex(rocblas_handle handle,
               specifies the datatype of computation
     @param[in]
     algo      rocblas_gemm_algo
-              enumerant specifying the algorithm type.
+              enumerant specifying the algorithm type. With
+              rocblas_gemm_algo_solution_index the solution of solution_index runs.
     @param[in]
     solution_index
               int32_t
-              reserved for future use
+              with rocblas_gemm_algo_solution_index, the solution_index of a
+              solution listed by rocblas_gemm_ex_get_solutions for the problem;
+              -1 runs the solution picked without it
     @param[in]
     flags     uint32_t
               reserved for future use
@@ -648,166 +964,230 @@ extern "C" rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle handle,
         return rocblas_status_invalid_pointer;
     }
 
-    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    if(rocblas_logging_enabled(handle))
     {
-        double alpha_double;
-        double beta_double;
-        if(compute_type == rocblas_datatype_f16_r)
-        {
-            _Float16 alpha_half = *(static_cast<const _Float16*>(alpha));
-            _Float16 beta_half  = *(static_cast<const _Float16*>(beta));
-            alpha_double        = static_cast<const double>(alpha_half);
-            beta_double         = static_cast<const double>(beta_half);
-        }
-        else if(compute_type == rocblas_datatype_f32_r)
-        {
-            float alpha_float = *(static_cast<const float*>(alpha));
-            float beta_float  = *(static_cast<const float*>(beta));
-            alpha_double      = static_cast<const double>(alpha_float);
-            beta_double       = static_cast<const double>(beta_float);
-        }
-        else if(compute_type == rocblas_datatype_f64_r)
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
-            alpha_double = *(static_cast<const double*>(alpha));
-            beta_double  = *(static_cast<const double*>(beta));
+            double alpha_double;
+            double beta_double;
+            if(compute_type == rocblas_datatype_f16_r)
+            {
+                _Float16 alpha_half = *(static_cast<const _Float16*>(alpha));
+                _Float16 beta_half  = *(static_cast<const _Float16*>(beta));
+                alpha_double        = static_cast<const double>(alpha_half);
+                beta_double         = static_cast<const double>(beta_half);
+            }
+            else if(compute_type == rocblas_datatype_f32_r)
+            {
+                float alpha_float = *(static_cast<const float*>(alpha));
+                float beta_float  = *(static_cast<const float*>(beta));
+                alpha_double      = static_cast<const double>(alpha_float);
+                beta_double       = static_cast<const double>(beta_float);
+            }
+            else if(compute_type == rocblas_datatype_f64_r)
+            {
+                alpha_double = *(static_cast<const double*>(alpha));
+                beta_double  = *(static_cast<const double*>(beta));
+            }
+            if(compute_type == rocblas_datatype_i32_r)
+            {
+                int alpha_int = *(static_cast<const int*>(alpha));
+                int beta_int  = *(static_cast<const int*>(beta));
+                alpha_double  = static_cast<const double>(alpha_int);
+                beta_double   = static_cast<const double>(beta_int);
+            }
+
+            log_trace(handle,
+                      "rocblas_gemm_strided_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      alpha_double,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      stride_a,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      stride_b,
+                      beta_double,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      stride_c,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      stride_d,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      workspace_size,
+                      (const void*&)workspace);
+
+            const char* trans_a_letter = rocblas_transpose_letter(trans_a);
+            const char* trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            const char* a_type_letter       = rocblas_datatype_letter(a_type);
+            const char* b_type_letter       = rocblas_datatype_letter(b_type);
+            const char* c_type_letter       = rocblas_datatype_letter(c_type);
+            const char* d_type_letter       = rocblas_datatype_letter(d_type);
+            const char* compute_type_letter = rocblas_datatype_letter(compute_type);
+
+            log_bench(handle,
+                      "./rocblas-bench -f gemm_strided_batched_ex",
+                      "--transposeA",
+                      trans_a_letter,
+                      "--transposeB",
+                      trans_b_letter,
+                      "-m",
+                      m,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      "--alpha",
+                      alpha_double,
+                      "--a_type",
+                      a_type_letter,
+                      "--lda",
+                      lda,
+                      "--stride_a",
+                      stride_a,
+                      "--b_type",
+                      b_type_letter,
+                      "--ldb",
+                      ldb,
+                      "--stride_b",
+                      stride_b,
+                      "--beta",
+                      beta_double,
+                      "--c_type",
+                      c_type_letter,
+                      "--ldc",
+                      ldc,
+                      "--stride_c",
+                      stride_c,
+                      "--d_type",
+                      d_type_letter,
+                      "--ldd",
+                      ldd,
+                      "--stride_d",
+                      stride_d,
+                      "--batch",
+                      batch_count,
+                      "--compute_type",
+                      compute_type_letter,
+                      "--algo",
+                      algo,
+                      "--solution_index",
+                      solution_index,
+                      "--flags",
+                      flags,
+                      "--workspace_size",
+                      workspace_size);
         }
-        if(compute_type == rocblas_datatype_i32_r)
+        else
         {
-            int alpha_int = *(static_cast<const int*>(alpha));
-            int beta_int  = *(static_cast<const int*>(beta));
-            alpha_double  = static_cast<const double>(alpha_int);
-            beta_double   = static_cast<const double>(beta_int);
+            log_trace(handle,
+                      "rocblas_gemm_strided_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      (const void*&)alpha,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      stride_a,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      stride_b,
+                      (const void*&)beta,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      stride_c,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      stride_d,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      "--workspace_size",
+                      workspace_size);
         }
 
-        log_trace(handle,
-                  "rocblas_gemm_strided_batched_ex",
-                  trans_a,
-                  trans_b,
-                  m,
-                  n,
-                  k,
-                  alpha_double,
-                  (const void*&)a,
-                  a_type,
-                  lda,
-                  stride_a,
-                  (const void*&)b,
-                  b_type,
-                  ldb,
-                  stride_b,
-                  beta_double,
-                  (const void*&)c,
-                  c_type,
-                  ldc,
-                  stride_c,
-                  (const void*&)d,
-                  d_type,
-                  ldd,
-                  stride_d,
-                  batch_count,
-                  compute_type,
-                  algo,
-                  solution_index,
-                  flags,
-                  workspace_size,
-                  (const void*&)workspace);
-
-        std::string trans_a_letter = rocblas_transpose_letter(trans_a);
-        std::string trans_b_letter = rocblas_transpose_letter(trans_b);
-
-        std::string a_type_letter       = rocblas_datatype_letter(a_type);
-        std::string b_type_letter       = rocblas_datatype_letter(b_type);
-        std::string c_type_letter       = rocblas_datatype_letter(c_type);
-        std::string d_type_letter       = rocblas_datatype_letter(d_type);
-        std::string compute_type_letter = rocblas_datatype_letter(compute_type);
-
-        log_bench(handle,
-                  "./rocblas-bench -f gemm_strided_batched_ex",
-                  "--transposeA",
-                  trans_a_letter,
-                  "--transposeB",
-                  trans_b_letter,
-                  "-m",
-                  m,
-                  "-n",
-                  n,
-                  "-k",
-                  k,
-                  "--alpha",
-                  alpha_double,
-                  "--a_type",
-                  a_type_letter,
-                  "--lda",
-                  lda,
-                  "--stride_a",
-                  stride_a,
-                  "--b_type",
-                  b_type_letter,
-                  "--ldb",
-                  ldb,
-                  "--stride_b",
-                  stride_b,
-                  "--beta",
-                  beta_double,
-                  "--c_type",
-                  c_type_letter,
-                  "--ldc",
-                  ldc,
-                  "--stride_c",
-                  stride_c,
-                  "--d_type",
-                  d_type_letter,
-                  "--ldd",
-                  ldd,
-                  "--stride_d",
-                  stride_d,
-                  "--batch",
-                  batch_count,
-                  "--compute_type",
-                  compute_type_letter,
-                  "--algo",
-                  algo,
-                  "--solution_index",
-                  solution_index,
-                  "--flags",
-                  flags,
-                  "--workspace_size",
-                  workspace_size);
+        log_profile(handle,
+                    "rocblas_gemm_strided_batched_ex",
+                    "transA",
+                    rocblas_transpose_letter(trans_a),
+                    "transB",
+                    rocblas_transpose_letter(trans_b),
+                    "M",
+                    m,
+                    "N",
+                    n,
+                    "K",
+                    k,
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "b_type",
+                    rocblas_datatype_letter(b_type),
+                    "c_type",
+                    rocblas_datatype_letter(c_type),
+                    "d_type",
+                    rocblas_datatype_letter(d_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type),
+                    "batch",
+                    batch_count);
     }
-    else
+
+    if(rocblas_capture_enabled(handle))
     {
-        log_trace(handle,
-                  "rocblas_gemm_strided_batched_ex",
-                  trans_a,
-                  trans_b,
-                  m,
-                  n,
-                  k,
-                  (const void*&)alpha,
-                  (const void*&)a,
-                  a_type,
-                  lda,
-                  stride_a,
-                  (const void*&)b,
-                  b_type,
-                  ldb,
-                  stride_b,
-                  (const void*&)beta,
-                  (const void*&)c,
-                  c_type,
-                  ldc,
-                  stride_c,
-                  (const void*&)d,
-                  d_type,
-                  ldd,
-                  stride_d,
-                  batch_count,
-                  compute_type,
-                  algo,
-                  solution_index,
-                  flags,
-                  "--workspace_size",
-                  workspace_size);
+        rocblas_capture_record record =
+            rocblas_capture_start(handle,
+                                  "gemm_strided_batched_ex",
+                                  *rocblas_datatype_letter(a_type),
+                                  alpha,
+                                  beta,
+                                  rocblas_datatype_size(compute_type));
+
+        record.trans_a        = *rocblas_transpose_letter(trans_a);
+        record.trans_b        = *rocblas_transpose_letter(trans_b);
+        record.m              = m;
+        record.n              = n;
+        record.k              = k;
+        record.lda            = lda;
+        record.ldb            = ldb;
+        record.ldc            = ldc;
+        record.ldd            = ldd;
+        record.stride_a       = stride_a;
+        record.stride_b       = stride_b;
+        record.stride_c       = stride_c;
+        record.stride_d       = stride_d;
+        record.batch_count    = batch_count;
+        record.a_type         = a_type;
+        record.b_type         = b_type;
+        record.c_type         = c_type;
+        record.d_type         = d_type;
+        record.compute_type   = compute_type;
+        record.algo           = algo;
+        record.solution_index = solution_index;
+        record.flags          = flags;
+        record.workspace_size = workspace_size ? *workspace_size : 0;
+        log_capture(handle, record);
     }
 
     // quick return m,n,k equal to 0 is valid in BLAS
@@ -840,159 +1220,1189 @@ extern "C" rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle handle,
         return rocblas_status_invalid_size;
     }
 
-    rocblas_status rb_status = rocblas_status_internal_error;
-
-    if(a_type == rocblas_datatype_f64_r && b_type == rocblas_datatype_f64_r &&
-       c_type == rocblas_datatype_f64_r && d_type == rocblas_datatype_f64_r &&
-       compute_type == rocblas_datatype_f64_r)
-    {
-        rb_status = gemm_ex_typecasting<double, double, double>(handle,
-                                                                trans_a,
-                                                                trans_b,
-                                                                m,
-                                                                n,
-                                                                k,
-                                                                alpha,
-                                                                a,
-                                                                lda,
-                                                                stride_a,
-                                                                b,
-                                                                ldb,
-                                                                stride_b,
-                                                                beta,
-                                                                c,
-                                                                ldc,
-                                                                stride_c,
-                                                                d,
-                                                                ldd,
-                                                                stride_d,
-                                                                batch_count);
-    }
-    else if(a_type == rocblas_datatype_f32_r && b_type == rocblas_datatype_f32_r &&
-            c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f32_r &&
-            compute_type == rocblas_datatype_f32_r)
-    {
-        rb_status = gemm_ex_typecasting<float, float, float>(handle,
-                                                             trans_a,
-                                                             trans_b,
-                                                             m,
-                                                             n,
-                                                             k,
-                                                             alpha,
-                                                             a,
-                                                             lda,
-                                                             stride_a,
-                                                             b,
-                                                             ldb,
-                                                             stride_b,
-                                                             beta,
-                                                             c,
-                                                             ldc,
-                                                             stride_c,
-                                                             d,
-                                                             ldd,
-                                                             stride_d,
-                                                             batch_count);
-    }
-    else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
-            c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
-            compute_type == rocblas_datatype_f16_r)
-    {
-        rb_status = gemm_ex_typecasting<_Float16, _Float16, _Float16>(handle,
-                                                                      trans_a,
-                                                                      trans_b,
-                                                                      m,
-                                                                      n,
-                                                                      k,
-                                                                      alpha,
-                                                                      a,
-                                                                      lda,
-                                                                      stride_a,
-                                                                      b,
-                                                                      ldb,
-                                                                      stride_b,
-                                                                      beta,
-                                                                      c,
-                                                                      ldc,
-                                                                      stride_c,
-                                                                      d,
-                                                                      ldd,
-                                                                      stride_d,
-                                                                      batch_count);
-    }
-    else if(a_type == rocblas_datatype_f16_r && b_type == rocblas_datatype_f16_r &&
-            c_type == rocblas_datatype_f16_r && d_type == rocblas_datatype_f16_r &&
-            compute_type == rocblas_datatype_f32_r)
-    {
-        rb_status = gemm_ex_typecasting<_Float16, _Float16, float>(handle,
-                                                                   trans_a,
-                                                                   trans_b,
-                                                                   m,
-                                                                   n,
-                                                                   k,
-                                                                   alpha,
-                                                                   a,
-                                                                   lda,
-                                                                   stride_a,
-                                                                   b,
-                                                                   ldb,
-                                                                   stride_b,
-                                                                   beta,
-                                                                   c,
-                                                                   ldc,
-                                                                   stride_c,
-                                                                   d,
-                                                                   ldd,
-                                                                   stride_d,
-                                                                   batch_count);
-    }
-    else if(a_type == rocblas_datatype_i8_r && b_type == rocblas_datatype_i8_r &&
-            c_type == rocblas_datatype_i32_r && d_type == rocblas_datatype_i32_r &&
-            compute_type == rocblas_datatype_i32_r)
-    {
-        // For now, K must be a multiple of 4
-        if(k % 4 != 0 || ((trans_a != rocblas_operation_none) && (lda % 4 != 0)) ||
-           ((trans_b == rocblas_operation_none) && (ldb % 4 != 0)) || stride_a % 4 != 0 ||
-           stride_b % 4 != 0)
-        {
-            rb_status = rocblas_status_invalid_size;
-        }
-        else
-        {
-            // adjust by 4 for Tensile
-            lda      = (trans_a == rocblas_operation_none) ? lda : lda / 4;
-            ldb      = (trans_b == rocblas_operation_none) ? ldb / 4 : ldb;
-            stride_a = stride_a / 4;
-            stride_b = stride_b / 4;
-            k        = k / 4;
-
-            rb_status = gemm_ex_typecasting<TensileInt8x4, TensileInt32, TensileInt32>(handle,
-                                                                                       trans_a,
-                                                                                       trans_b,
-                                                                                       m,
-                                                                                       n,
-                                                                                       k,
-                                                                                       alpha,
-                                                                                       a,
-                                                                                       lda,
-                                                                                       stride_a,
-                                                                                       b,
-                                                                                       ldb,
-                                                                                       stride_b,
-                                                                                       beta,
-                                                                                       c,
-                                                                                       ldc,
-                                                                                       stride_c,
-                                                                                       d,
-                                                                                       ldd,
-                                                                                       stride_d,
-                                                                                       batch_count);
-        }
-    }
-    else
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             rocblas_gemm_flop_count<float>(m, n, k) * batch_count,
+                             "rocblas_gemm_strided_batched_ex",
+                             "transA",
+                             rocblas_transpose_letter(trans_a),
+                             "transB",
+                             rocblas_transpose_letter(trans_b),
+                             "M",
+                             m,
+                             "N",
+                             n,
+                             "K",
+                             k,
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type),
+                             "batch",
+                             batch_count);
+
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    // strides beyond 32 bits are chunked along the batch
+    if(!gemm_ex_fits_int(stride_a, stride_b, stride_c, stride_d))
     {
-        rb_status = rocblas_status_not_implemented;
+        return gemm_ex_64_dispatch(handle, trans_a, trans_b, m, n, k, alpha,
+                                   a, a_type, lda, stride_a, b, b_type, ldb, stride_b, beta,
+                                   c, c_type, ldc, stride_c, d, d_type, ldd, stride_d,
+                                   batch_count, compute_type);
     }
 
-    return rb_status;
+    return gemm_ex_dispatch(a_type,
+                            b_type,
+                            c_type,
+                            d_type,
+                            compute_type,
+                            gemm_ex_strided_functor{handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    lda,
+                                                    stride_a,
+                                                    b,
+                                                    ldb,
+                                                    stride_b,
+                                                    beta,
+                                                    c,
+                                                    ldc,
+                                                    stride_c,
+                                                    d,
+                                                    ldd,
+                                                    stride_d,
+                                                    batch_count});
+}
+
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_BATCHED_EX performs one of the batched matrix-matrix operations
+
+        D[i] = alpha*op( A[i] )*op( B[i] ) + beta*C[i], for i = 0 .. batch_count - 1
+
+    with the same op( X ), alpha and beta as GEMM_EX. a, b, c and d are device
+    arrays of batch_count device pointers, so the matrices of a batch need not
+    be evenly spaced in memory; the parameters are otherwise those of GEMM_EX.
+    C and D may be the same matrices.
+
+    @param[in]
+    a         void *
+              device array of batch_count pointers to the matrices A on the GPU.
+    @param[in]
+    b         void *
+              device array of batch_count pointers to the matrices B on the GPU.
+    @param[in]
+    c         void *
+              device array of batch_count pointers to the matrices C on the GPU.
+    @param[out]
+    d         void *
+              device array of batch_count pointers to the matrices D on the GPU.
+    @param[in]
+    batch_count
+              rocblas_int
+              number of gemm operations in the batch
+
+    ********************************************************************/
+
+extern "C" rocblas_status rocblas_gemm_batched_ex(rocblas_handle handle,
+                                                  rocblas_operation trans_a,
+                                                  rocblas_operation trans_b,
+                                                  rocblas_int m,
+                                                  rocblas_int n,
+                                                  rocblas_int k,
+                                                  const void* alpha,
+                                                  const void* a,
+                                                  rocblas_datatype a_type,
+                                                  rocblas_int lda,
+                                                  const void* b,
+                                                  rocblas_datatype b_type,
+                                                  rocblas_int ldb,
+                                                  const void* beta,
+                                                  const void* c,
+                                                  rocblas_datatype c_type,
+                                                  rocblas_int ldc,
+                                                  void* d,
+                                                  rocblas_datatype d_type,
+                                                  rocblas_int ldd,
+                                                  rocblas_int batch_count,
+                                                  rocblas_datatype compute_type,
+                                                  rocblas_gemm_algo algo,
+                                                  int32_t solution_index,
+                                                  uint32_t flags,
+                                                  size_t* workspace_size,
+                                                  void* workspace)
+{
+    // handle, alpha, beta must not be null pointers for logging
+    if(nullptr == handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    if(nullptr == alpha || nullptr == beta)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    if(rocblas_logging_enabled(handle))
+    {
+        if(handle->pointer_mode == rocblas_pointer_mode_host)
+        {
+            double alpha_double;
+            double beta_double;
+            if(compute_type == rocblas_datatype_f16_r)
+            {
+                _Float16 alpha_half = *(static_cast<const _Float16*>(alpha));
+                _Float16 beta_half  = *(static_cast<const _Float16*>(beta));
+                alpha_double        = static_cast<const double>(alpha_half);
+                beta_double         = static_cast<const double>(beta_half);
+            }
+            else if(compute_type == rocblas_datatype_f32_r)
+            {
+                float alpha_float = *(static_cast<const float*>(alpha));
+                float beta_float  = *(static_cast<const float*>(beta));
+                alpha_double      = static_cast<const double>(alpha_float);
+                beta_double       = static_cast<const double>(beta_float);
+            }
+            else if(compute_type == rocblas_datatype_f64_r)
+            {
+                alpha_double = *(static_cast<const double*>(alpha));
+                beta_double  = *(static_cast<const double*>(beta));
+            }
+            if(compute_type == rocblas_datatype_i32_r)
+            {
+                int alpha_int = *(static_cast<const int*>(alpha));
+                int beta_int  = *(static_cast<const int*>(beta));
+                alpha_double  = static_cast<const double>(alpha_int);
+                beta_double   = static_cast<const double>(beta_int);
+            }
+
+            log_trace(handle,
+                      "rocblas_gemm_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      alpha_double,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      beta_double,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      workspace_size,
+                      (const void*&)workspace);
+        }
+        else
+        {
+            log_trace(handle,
+                      "rocblas_gemm_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      (const void*&)alpha,
+                      (const void*&)a,
+                      a_type,
+                      lda,
+                      (const void*&)b,
+                      b_type,
+                      ldb,
+                      (const void*&)beta,
+                      (const void*&)c,
+                      c_type,
+                      ldc,
+                      (const void*&)d,
+                      d_type,
+                      ldd,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index,
+                      flags,
+                      "--workspace_size",
+                      workspace_size);
+        }
+
+        log_profile(handle,
+                    "rocblas_gemm_batched_ex",
+                    "transA",
+                    rocblas_transpose_letter(trans_a),
+                    "transB",
+                    rocblas_transpose_letter(trans_b),
+                    "M",
+                    m,
+                    "N",
+                    n,
+                    "K",
+                    k,
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "b_type",
+                    rocblas_datatype_letter(b_type),
+                    "c_type",
+                    rocblas_datatype_letter(c_type),
+                    "d_type",
+                    rocblas_datatype_letter(d_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type),
+                    "batch",
+                    batch_count);
+    }
+
+    if(rocblas_capture_enabled(handle))
+    {
+        rocblas_capture_record record =
+            rocblas_capture_start(handle,
+                                  "gemm_batched_ex",
+                                  *rocblas_datatype_letter(a_type),
+                                  alpha,
+                                  beta,
+                                  rocblas_datatype_size(compute_type));
+
+        record.trans_a        = *rocblas_transpose_letter(trans_a);
+        record.trans_b        = *rocblas_transpose_letter(trans_b);
+        record.m              = m;
+        record.n              = n;
+        record.k              = k;
+        record.lda            = lda;
+        record.ldb            = ldb;
+        record.ldc            = ldc;
+        record.ldd            = ldd;
+        record.batch_count    = batch_count;
+        record.a_type         = a_type;
+        record.b_type         = b_type;
+        record.c_type         = c_type;
+        record.d_type         = d_type;
+        record.compute_type   = compute_type;
+        record.algo           = algo;
+        record.solution_index = solution_index;
+        record.flags          = flags;
+        record.workspace_size = workspace_size ? *workspace_size : 0;
+        log_capture(handle, record);
+    }
+
+    // quick return m,n,k equal to 0 is valid in BLAS
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    // sizes must not be negative
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // pointers must be valid
+    if(nullptr == a || nullptr == b || nullptr == c || nullptr == d || nullptr == alpha ||
+       nullptr == beta)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    rocblas_int num_rows_a = (trans_a == rocblas_operation_none) ? m : k;
+    rocblas_int num_rows_b = (trans_b == rocblas_operation_none) ? k : n;
+    rocblas_int num_rows_c = m;
+    rocblas_int num_rows_d = m;
+
+    // leading dimensions must be valid
+    if(num_rows_a > lda || num_rows_b > ldb || num_rows_c > ldc || num_rows_d > ldd)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             rocblas_gemm_flop_count<float>(m, n, k) * batch_count,
+                             "rocblas_gemm_batched_ex",
+                             "transA",
+                             rocblas_transpose_letter(trans_a),
+                             "transB",
+                             rocblas_transpose_letter(trans_b),
+                             "M",
+                             m,
+                             "N",
+                             n,
+                             "K",
+                             k,
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type),
+                             "batch",
+                             batch_count);
+
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    return gemm_ex_dispatch(a_type,
+                            b_type,
+                            c_type,
+                            d_type,
+                            compute_type,
+                            gemm_ex_batched_functor{handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    lda,
+                                                    b,
+                                                    ldb,
+                                                    beta,
+                                                    c,
+                                                    ldc,
+                                                    d,
+                                                    ldd,
+                                                    batch_count});
+}
+
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_GROUPED_EX performs group_count groups of matrix-matrix operations
+
+        D[i] = alpha[g]*op( A[i] )*op( B[i] ) + beta[g]*C[i],
+
+    where the group_size[g] problems i of group g share trans_a[g], trans_b[g],
+    m[g], n[g], k[g], lda[g], ldb[g], ldc[g] and ldd[g]. Groups with the same
+    transposes and k, and sizes close enough to pad to a common size, run as a
+    single launch.
+
+    @param[in]
+    trans_a, trans_b, m, n, k, lda, ldb, ldc, ldd
+              host arrays of group_count values, one per group.
+    @param[in]
+    alpha, beta
+              arrays of group_count scalars of compute_type, on the host or the
+              device as the pointer mode says.
+    @param[in]
+    a, b, c   void *
+              device arrays of the device pointers to the matrices A, B and C of
+              all the problems, group after group.
+    @param[out]
+    d         void *
+              device array of the device pointers to the matrices D, in the same
+              order. C and D may be the same matrices.
+    @param[in]
+    group_count
+              rocblas_int
+              number of groups
+    @param[in]
+    group_size
+              host array of group_count problem counts, one per group.
+
+    The other parameters are those of GEMM_EX.
+
+    ********************************************************************/
+
+extern "C" rocblas_status rocblas_gemm_grouped_ex(rocblas_handle handle,
+                                                  const rocblas_operation* trans_a,
+                                                  const rocblas_operation* trans_b,
+                                                  const rocblas_int* m,
+                                                  const rocblas_int* n,
+                                                  const rocblas_int* k,
+                                                  const void* alpha,
+                                                  const void* a,
+                                                  rocblas_datatype a_type,
+                                                  const rocblas_int* lda,
+                                                  const void* b,
+                                                  rocblas_datatype b_type,
+                                                  const rocblas_int* ldb,
+                                                  const void* beta,
+                                                  const void* c,
+                                                  rocblas_datatype c_type,
+                                                  const rocblas_int* ldc,
+                                                  void* d,
+                                                  rocblas_datatype d_type,
+                                                  const rocblas_int* ldd,
+                                                  rocblas_int group_count,
+                                                  const rocblas_int* group_size,
+                                                  rocblas_datatype compute_type,
+                                                  rocblas_gemm_algo algo,
+                                                  int32_t solution_index,
+                                                  uint32_t flags,
+                                                  size_t* workspace_size,
+                                                  void* workspace)
+{
+    if(nullptr == handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    if(rocblas_logging_enabled(handle))
+    {
+        log_trace(handle,
+                  "rocblas_gemm_grouped_ex",
+                  (const void*&)trans_a,
+                  (const void*&)trans_b,
+                  (const void*&)m,
+                  (const void*&)n,
+                  (const void*&)k,
+                  (const void*&)alpha,
+                  (const void*&)a,
+                  a_type,
+                  (const void*&)lda,
+                  (const void*&)b,
+                  b_type,
+                  (const void*&)ldb,
+                  (const void*&)beta,
+                  (const void*&)c,
+                  c_type,
+                  (const void*&)ldc,
+                  (const void*&)d,
+                  d_type,
+                  (const void*&)ldd,
+                  group_count,
+                  (const void*&)group_size,
+                  compute_type,
+                  algo,
+                  solution_index,
+                  flags,
+                  workspace_size,
+                  (const void*&)workspace);
+
+        log_profile(handle,
+                    "rocblas_gemm_grouped_ex",
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "b_type",
+                    rocblas_datatype_letter(b_type),
+                    "c_type",
+                    rocblas_datatype_letter(c_type),
+                    "d_type",
+                    rocblas_datatype_letter(d_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type),
+                    "group_count",
+                    group_count);
+    }
+
+    // quick return 0 groups is valid
+    if(group_count == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    if(group_count < 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // the per group arrays must be valid
+    if(nullptr == trans_a || nullptr == trans_b || nullptr == m || nullptr == n ||
+       nullptr == k || nullptr == lda || nullptr == ldb || nullptr == ldc || nullptr == ldd ||
+       nullptr == group_size || nullptr == alpha || nullptr == beta)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    double flops         = 0;
+    rocblas_int problems = 0;
+    for(rocblas_int g = 0; g < group_count; g++)
+    {
+        // sizes must not be negative
+        if(m[g] < 0 || n[g] < 0 || k[g] < 0 || group_size[g] < 0)
+        {
+            return rocblas_status_invalid_size;
+        }
+
+        if(m[g] == 0 || n[g] == 0 || group_size[g] == 0)
+            continue;
+
+        rocblas_int num_rows_a = (trans_a[g] == rocblas_operation_none) ? m[g] : k[g];
+        rocblas_int num_rows_b = (trans_b[g] == rocblas_operation_none) ? k[g] : n[g];
+
+        // leading dimensions must be valid
+        if(num_rows_a > lda[g] || num_rows_b > ldb[g] || m[g] > ldc[g] || m[g] > ldd[g])
+        {
+            return rocblas_status_invalid_size;
+        }
+
+        flops += rocblas_gemm_flop_count<float>(m[g], n[g], k[g]) * group_size[g];
+        problems += group_size[g];
+    }
+
+    // quick return when every group is empty
+    if(problems == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    // pointers must be valid
+    if(nullptr == a || nullptr == b || nullptr == c || nullptr == d)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             flops,
+                             "rocblas_gemm_grouped_ex",
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type),
+                             "group_count",
+                             group_count);
+
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    return gemm_ex_dispatch(a_type,
+                            b_type,
+                            c_type,
+                            d_type,
+                            compute_type,
+                            gemm_ex_grouped_functor{handle,
+                                                    trans_a,
+                                                    trans_b,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    a,
+                                                    lda,
+                                                    b,
+                                                    ldb,
+                                                    beta,
+                                                    c,
+                                                    ldc,
+                                                    d,
+                                                    ldd,
+                                                    group_count,
+                                                    group_size});
+}
+
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_EX_EPILOGUE performs GEMM_EX and finishes D in the same pass over it:
+
+        aux = alpha*op( A )*op( B ) + beta*C + bias,
+        D   = activation( aux ),
+
+    where bias is a vector along the rows or the columns of D, and aux, which
+    keeps the value before the activation, is optional. D may be of a narrower
+    type than C: f32 A, B, C and compute_type may store an f16 D.
+
+    @param[in]
+    epilogue  const rocblas_gemm_epilogue*
+              host pointer to the bias, activation and aux output to apply.
+              bias and aux are device pointers of c_type.
+
+    The other parameters are those of GEMM_EX.
+
+    ********************************************************************/
+
+extern "C" rocblas_status rocblas_gemm_ex_epilogue(rocblas_handle handle,
+                                                   rocblas_operation trans_a,
+                                                   rocblas_operation trans_b,
+                                                   rocblas_int m,
+                                                   rocblas_int n,
+                                                   rocblas_int k,
+                                                   const void* alpha,
+                                                   const void* a,
+                                                   rocblas_datatype a_type,
+                                                   rocblas_int lda,
+                                                   const void* b,
+                                                   rocblas_datatype b_type,
+                                                   rocblas_int ldb,
+                                                   const void* beta,
+                                                   const void* c,
+                                                   rocblas_datatype c_type,
+                                                   rocblas_int ldc,
+                                                   void* d,
+                                                   rocblas_datatype d_type,
+                                                   rocblas_int ldd,
+                                                   const rocblas_gemm_epilogue* epilogue,
+                                                   rocblas_datatype compute_type,
+                                                   rocblas_gemm_algo algo,
+                                                   int32_t solution_index,
+                                                   uint32_t flags,
+                                                   size_t* workspace_size,
+                                                   void* workspace)
+{
+    if(nullptr == handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    if(rocblas_logging_enabled(handle))
+    {
+        log_trace(handle,
+                  "rocblas_gemm_ex_epilogue",
+                  trans_a,
+                  trans_b,
+                  m,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)a,
+                  a_type,
+                  lda,
+                  (const void*&)b,
+                  b_type,
+                  ldb,
+                  (const void*&)beta,
+                  (const void*&)c,
+                  c_type,
+                  ldc,
+                  (const void*&)d,
+                  d_type,
+                  ldd,
+                  (const void*&)epilogue,
+                  compute_type,
+                  algo,
+                  solution_index,
+                  flags,
+                  workspace_size,
+                  (const void*&)workspace);
+
+        log_profile(handle,
+                    "rocblas_gemm_ex_epilogue",
+                    "transA",
+                    rocblas_transpose_letter(trans_a),
+                    "transB",
+                    rocblas_transpose_letter(trans_b),
+                    "M",
+                    m,
+                    "N",
+                    n,
+                    "K",
+                    k,
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "c_type",
+                    rocblas_datatype_letter(c_type),
+                    "d_type",
+                    rocblas_datatype_letter(d_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type),
+                    "bias_mode",
+                    epilogue ? int(epilogue->bias_mode) : 0,
+                    "activation",
+                    epilogue ? int(epilogue->activation) : 0);
+    }
+
+    if(nullptr == epilogue)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    // sizes must not be negative
+    if(m < 0 || n < 0 || k < 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // quick return m,n equal to 0 is valid in BLAS; with k equal to 0 D is
+    // still formed from C and the bias
+    if(m == 0 || n == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    if(epilogue->bias_mode != rocblas_bias_none && epilogue->bias_mode != rocblas_bias_row &&
+       epilogue->bias_mode != rocblas_bias_column)
+    {
+        return rocblas_status_not_implemented;
+    }
+
+    if(epilogue->activation != rocblas_activation_none &&
+       epilogue->activation != rocblas_activation_relu &&
+       epilogue->activation != rocblas_activation_gelu)
+    {
+        return rocblas_status_not_implemented;
+    }
+
+    // pointers must be valid
+    if(nullptr == a || nullptr == b || nullptr == c || nullptr == d || nullptr == alpha ||
+       nullptr == beta || (epilogue->bias_mode != rocblas_bias_none && nullptr == epilogue->bias))
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    rocblas_int num_rows_a = (trans_a == rocblas_operation_none) ? m : k;
+    rocblas_int num_rows_b = (trans_b == rocblas_operation_none) ? k : n;
+
+    // leading dimensions must be valid
+    if(num_rows_a > lda || num_rows_b > ldb || m > ldc || m > ldd ||
+       (epilogue->aux && m > epilogue->ld_aux))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             rocblas_gemm_flop_count<float>(m, n, k),
+                             "rocblas_gemm_ex_epilogue",
+                             "transA",
+                             rocblas_transpose_letter(trans_a),
+                             "transB",
+                             rocblas_transpose_letter(trans_b),
+                             "M",
+                             m,
+                             "N",
+                             n,
+                             "K",
+                             k,
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type));
+
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    gemm_ex_epilogue_functor run_epilogue{
+        handle, trans_a, trans_b, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, d, ldd, *epilogue};
+
+    // the downcast of D is the last step of the epilogue
+    if(a_type == rocblas_datatype_f32_r && b_type == rocblas_datatype_f32_r &&
+       c_type == rocblas_datatype_f32_r && d_type == rocblas_datatype_f16_r &&
+       compute_type == rocblas_datatype_f32_r)
+    {
+        return run_epilogue.run<float, float, float, _Float16>();
+    }
+
+    return gemm_ex_dispatch(a_type, b_type, c_type, d_type, compute_type, run_epilogue);
+}
+
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_STRIDED_BATCHED_EX_64 is GEMM_STRIDED_BATCHED_EX with 64-bit sizes,
+    leading dimensions, strides and batch count.
+
+    A problem within the range of rocblas_int runs as
+    rocblas_gemm_strided_batched_ex. A larger one is split into chunks of m,
+    n, k and batch that each fit the 32-bit indexing of the gemm kernels; the
+    chunks that write different parts of D run concurrently on streams forked
+    from the handle's stream, and the call is ordered on the handle's stream
+    as a whole. In device pointer mode such a problem reads alpha and beta
+    back to the host, which waits for the work queued on the stream. bf16_r
+    data is supported within the range of rocblas_int only.
+
+    The parameters are those of GEMM_STRIDED_BATCHED_EX.
+
+    ********************************************************************/
+
+extern "C" rocblas_status rocblas_gemm_strided_batched_ex_64(rocblas_handle handle,
+                                                             rocblas_operation trans_a,
+                                                             rocblas_operation trans_b,
+                                                             rocblas_long m,
+                                                             rocblas_long n,
+                                                             rocblas_long k,
+                                                             const void* alpha,
+                                                             const void* a,
+                                                             rocblas_datatype a_type,
+                                                             rocblas_long lda,
+                                                             rocblas_long stride_a,
+                                                             const void* b,
+                                                             rocblas_datatype b_type,
+                                                             rocblas_long ldb,
+                                                             rocblas_long stride_b,
+                                                             const void* beta,
+                                                             const void* c,
+                                                             rocblas_datatype c_type,
+                                                             rocblas_long ldc,
+                                                             rocblas_long stride_c,
+                                                             void* d,
+                                                             rocblas_datatype d_type,
+                                                             rocblas_long ldd,
+                                                             rocblas_long stride_d,
+                                                             rocblas_long batch_count,
+                                                             rocblas_datatype compute_type,
+                                                             rocblas_gemm_algo algo,
+                                                             int32_t solution_index,
+                                                             uint32_t flags,
+                                                             size_t* workspace_size,
+                                                             void* workspace)
+{
+    // handle, alpha, beta must not be null pointers for logging
+    if(nullptr == handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    if(nullptr == alpha || nullptr == beta)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    if(gemm_ex_fits_int(m, n, k, lda, ldb, ldc, ldd, batch_count))
+    {
+        return rocblas_gemm_strided_batched_ex(handle, trans_a, trans_b, m, n, k, alpha,
+                                               a, a_type, lda, stride_a, b, b_type, ldb, stride_b,
+                                               beta, c, c_type, ldc, stride_c,
+                                               d, d_type, ldd, stride_d, batch_count,
+                                               compute_type, algo, solution_index, flags,
+                                               workspace_size, workspace);
+    }
+
+    if(rocblas_logging_enabled(handle))
+    {
+        log_trace(handle,
+                  "rocblas_gemm_strided_batched_ex_64",
+                  trans_a,
+                  trans_b,
+                  m,
+                  n,
+                  k,
+                  (const void*&)alpha,
+                  (const void*&)a,
+                  a_type,
+                  lda,
+                  stride_a,
+                  (const void*&)b,
+                  b_type,
+                  ldb,
+                  stride_b,
+                  (const void*&)beta,
+                  (const void*&)c,
+                  c_type,
+                  ldc,
+                  stride_c,
+                  (const void*&)d,
+                  d_type,
+                  ldd,
+                  stride_d,
+                  batch_count,
+                  compute_type,
+                  algo,
+                  solution_index,
+                  flags);
+
+        log_profile(handle,
+                    "rocblas_gemm_strided_batched_ex_64",
+                    "transA",
+                    rocblas_transpose_letter(trans_a),
+                    "transB",
+                    rocblas_transpose_letter(trans_b),
+                    "M",
+                    m,
+                    "N",
+                    n,
+                    "K",
+                    k,
+                    "a_type",
+                    rocblas_datatype_letter(a_type),
+                    "compute_type",
+                    rocblas_datatype_letter(compute_type),
+                    "batch",
+                    batch_count);
+    }
+
+    // quick return m,n,k equal to 0 is valid in BLAS
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+    {
+        return rocblas_status_success;
+    }
+
+    // sizes and strides must not be negative
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || stride_a < 0 || stride_b < 0 ||
+       stride_c < 0 || stride_d < 0)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // pointers must be valid
+    if(nullptr == a || nullptr == b || nullptr == c || nullptr == d)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+
+    rocblas_long num_rows_a = (trans_a == rocblas_operation_none) ? m : k;
+    rocblas_long num_rows_b = (trans_b == rocblas_operation_none) ? k : n;
+
+    // leading dimensions must be valid
+    if(num_rows_a > lda || num_rows_b > ldb || m > ldc || m > ldd)
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // the _ex routines take real types only
+    auto timing = log_timing(handle,
+                             rocblas_gemm_flop_count<float>(m, n, k) * batch_count,
+                             "rocblas_gemm_strided_batched_ex_64",
+                             "transA",
+                             rocblas_transpose_letter(trans_a),
+                             "transB",
+                             rocblas_transpose_letter(trans_b),
+                             "M",
+                             m,
+                             "N",
+                             n,
+                             "K",
+                             k,
+                             "a_type",
+                             rocblas_datatype_letter(a_type),
+                             "compute_type",
+                             rocblas_datatype_letter(compute_type),
+                             "batch",
+                             batch_count);
+
+    gemm_ex_solution_scope solution_scope(handle, algo, solution_index);
+
+    return gemm_ex_64_dispatch(handle, trans_a, trans_b, m, n, k, alpha,
+                               a, a_type, lda, stride_a, b, b_type, ldb, stride_b, beta,
+                               c, c_type, ldc, stride_c, d, d_type, ldd, stride_d,
+                               batch_count, compute_type);
+}
+
+/*! \brief BLAS EX API
+
+    \details
+    GEMM_EX_64 is GEMM_EX with 64-bit sizes and leading dimensions, run as
+    GEMM_STRIDED_BATCHED_EX_64 with a batch of one.
+
+    ********************************************************************/
+
+extern "C" rocblas_status rocblas_gemm_ex_64(rocblas_handle handle,
+                                             rocblas_operation trans_a,
+                                             rocblas_operation trans_b,
+                                             rocblas_long m,
+                                             rocblas_long n,
+                                             rocblas_long k,
+                                             const void* alpha,
+                                             const void* a,
+                                             rocblas_datatype a_type,
+                                             rocblas_long lda,
+                                             const void* b,
+                                             rocblas_datatype b_type,
+                                             rocblas_long ldb,
+                                             const void* beta,
+                                             const void* c,
+                                             rocblas_datatype c_type,
+                                             rocblas_long ldc,
+                                             void* d,
+                                             rocblas_datatype d_type,
+                                             rocblas_long ldd,
+                                             rocblas_datatype compute_type,
+                                             rocblas_gemm_algo algo,
+                                             int32_t solution_index,
+                                             uint32_t flags,
+                                             size_t* workspace_size,
+                                             void* workspace)
+{
+    if(nullptr == handle)
+    {
+        return rocblas_status_invalid_handle;
+    }
+
+    if(gemm_ex_fits_int(m, n, k, lda, ldb, ldc, ldd))
+    {
+        return rocblas_gemm_ex(handle, trans_a, trans_b, m, n, k, alpha, a, a_type, lda,
+                               b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd,
+                               compute_type, algo, solution_index, flags,
+                               workspace_size, workspace);
+    }
+
+    rocblas_long stride_a = trans_a == rocblas_operation_none ? lda * k : lda * m;
+    rocblas_long stride_b = trans_b == rocblas_operation_none ? ldb * n : ldb * k;
+
+    return rocblas_gemm_strided_batched_ex_64(handle, trans_a, trans_b, m, n, k, alpha,
+                                              a, a_type, lda, stride_a, b, b_type, ldb, stride_b,
+                                              beta, c, c_type, ldc, ldc * n,
+                                              d, d_type, ldd, ldd * n, 1,
+                                              compute_type, algo, solution_index, flags,
+                                              workspace_size, workspace);
+}
+
+/*******************************************************************************
+ * hgemm, sgemm and dgemm with 64-bit sizes, leading dimensions and strides:
+ * C is updated in place as GEMM_STRIDED_BATCHED_EX_64 with D = C.
+ ******************************************************************************/
+template <typename T>
+static rocblas_datatype gemm_64_datatype();
+
+template <>
+rocblas_datatype gemm_64_datatype<rocblas_half>()
+{
+    return rocblas_datatype_f16_r;
+}
+
+template <>
+rocblas_datatype gemm_64_datatype<float>()
+{
+    return rocblas_datatype_f32_r;
+}
+
+template <>
+rocblas_datatype gemm_64_datatype<double>()
+{
+    return rocblas_datatype_f64_r;
+}
+
+template <typename T>
+static rocblas_status rocblas_gemm_64_template(rocblas_handle handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_long m,
+                                               rocblas_long n,
+                                               rocblas_long k,
+                                               const T* alpha,
+                                               const T* A,
+                                               rocblas_long lda,
+                                               rocblas_long stride_a,
+                                               const T* B,
+                                               rocblas_long ldb,
+                                               rocblas_long stride_b,
+                                               const T* beta,
+                                               T* C,
+                                               rocblas_long ldc,
+                                               rocblas_long stride_c,
+                                               rocblas_long batch_count)
+{
+    rocblas_datatype type = gemm_64_datatype<T>();
+    return rocblas_gemm_strided_batched_ex_64(handle, trans_a, trans_b, m, n, k, alpha,
+                                              A, type, lda, stride_a, B, type, ldb, stride_b,
+                                              beta, C, type, ldc, stride_c,
+                                              C, type, ldc, stride_c, batch_count, type,
+                                              rocblas_gemm_algo_standard, 0, 0, nullptr, nullptr);
+}
+
+rocblas_status rocblas_hgemm_64(rocblas_handle handle,
+                                rocblas_operation transa,
+                                rocblas_operation transb,
+                                rocblas_long m,
+                                rocblas_long n,
+                                rocblas_long k,
+                                const rocblas_half* alpha,
+                                const rocblas_half* A,
+                                rocblas_long lda,
+                                const rocblas_half* B,
+                                rocblas_long ldb,
+                                const rocblas_half* beta,
+                                rocblas_half* C,
+                                rocblas_long ldc)
+{
+    return rocblas_gemm_64_template(
+        handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+rocblas_status rocblas_sgemm_64(rocblas_handle handle,
+                                rocblas_operation transa,
+                                rocblas_operation transb,
+                                rocblas_long m,
+                                rocblas_long n,
+                                rocblas_long k,
+                                const float* alpha,
+                                const float* A,
+                                rocblas_long lda,
+                                const float* B,
+                                rocblas_long ldb,
+                                const float* beta,
+                                float* C,
+                                rocblas_long ldc)
+{
+    return rocblas_gemm_64_template(
+        handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+rocblas_status rocblas_dgemm_64(rocblas_handle handle,
+                                rocblas_operation transa,
+                                rocblas_operation transb,
+                                rocblas_long m,
+                                rocblas_long n,
+                                rocblas_long k,
+                                const double* alpha,
+                                const double* A,
+                                rocblas_long lda,
+                                const double* B,
+                                rocblas_long ldb,
+                                const double* beta,
+                                double* C,
+                                rocblas_long ldc)
+{
+    return rocblas_gemm_64_template(
+        handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+rocblas_status rocblas_hgemm_strided_batched_64(rocblas_handle handle,
+                                                rocblas_operation transa,
+                                                rocblas_operation transb,
+                                                rocblas_long m,
+                                                rocblas_long n,
+                                                rocblas_long k,
+                                                const rocblas_half* alpha,
+                                                const rocblas_half* A,
+                                                rocblas_long lda,
+                                                rocblas_long bsa,
+                                                const rocblas_half* B,
+                                                rocblas_long ldb,
+                                                rocblas_long bsb,
+                                                const rocblas_half* beta,
+                                                rocblas_half* C,
+                                                rocblas_long ldc,
+                                                rocblas_long bsc,
+                                                rocblas_long batch_count)
+{
+    return rocblas_gemm_64_template(handle, transa, transb, m, n, k, alpha, A, lda, bsa,
+                                    B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+rocblas_status rocblas_sgemm_strided_batched_64(rocblas_handle handle,
+                                                rocblas_operation transa,
+                                                rocblas_operation transb,
+                                                rocblas_long m,
+                                                rocblas_long n,
+                                                rocblas_long k,
+                                                const float* alpha,
+                                                const float* A,
+                                                rocblas_long lda,
+                                                rocblas_long bsa,
+                                                const float* B,
+                                                rocblas_long ldb,
+                                                rocblas_long bsb,
+                                                const float* beta,
+                                                float* C,
+                                                rocblas_long ldc,
+                                                rocblas_long bsc,
+                                                rocblas_long batch_count)
+{
+    return rocblas_gemm_64_template(handle, transa, transb, m, n, k, alpha, A, lda, bsa,
+                                    B, ldb, bsb, beta, C, ldc, bsc, batch_count);
+}
+
+rocblas_status rocblas_dgemm_strided_batched_64(rocblas_handle handle,
+                                                rocblas_operation transa,
+                                                rocblas_operation transb,
+                                                rocblas_long m,
+                                                rocblas_long n,
+                                                rocblas_long k,
+                                                const double* alpha,
+                                                const double* A,
+                                                rocblas_long lda,
+                                                rocblas_long bsa,
+                                                const double* B,
+                                                rocblas_long ldb,
+                                                rocblas_long bsb,
+                                                const double* beta,
+                                                double* C,
+                                                rocblas_long ldc,
+                                                rocblas_long bsc,
+                                                rocblas_long batch_count)
+{
+    return rocblas_gemm_64_template(handle, transa, transb, m, n, k, alpha, A, lda, bsa,
+                                    B, ldb, bsb, beta, C, ldc, bsc, batch_count);
 }
@@ -3,376 +3,80 @@
  * ************************************************************************ */
 
 // clang-format off
-void device_matrix_copy(const void* src,
-                        rocblas_int ld_src,
-                        void* dst,
-                        rocblas_int ld_dst,
-                        rocblas_int n1,
-                        rocblas_int n2,
-                        size_t elem_size)
+#define GEMM_EX_COPY_DIM_X 64
+#define GEMM_EX_COPY_DIM_Y 4
+
+// D = C, or D = 0 when zero is set, for an m x n x batch_count matrix
+template <typename To>
+__global__ void gemm_ex_copy_c_kernel(rocblas_int m, rocblas_int n,
+                                      const To* __restrict__ c, rocblas_int ldc, rocblas_int stride_c,
+                                      To* __restrict__ d, rocblas_int ldd, rocblas_int stride_d,
+                                      bool zero)
 {
-    if((src != dst) || (ld_src != ld_dst)) // no copy if src matrix == dst matrix
-    {
-        if((n1 == ld_src) && (n1 == ld_dst))
-        {
-            // src and dst matrices are contiguous, use single copy
-            size_t matrix_size = n1 * n2 * elem_size;
-            PRINT_IF_HIP_ERROR(hipMemcpy(dst, src, matrix_size, hipMemcpyDeviceToDevice))
-        }
-        else
-        {
-            // matrices not contiguous, one copy for each contiguous column
-            size_t column_size = n1 * elem_size;
-            const void* src_void;
-            void* dst_void;
+    rocblas_int tx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int ty = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    size_t batch   = hipBlockIdx_z;
 
-            for(int i2 = 0; i2 < n2; i2++)
-            {
-                src_void = static_cast<const void*>(static_cast<const uint8_t*>(src)
-                                                    + (i2 * ld_src * elem_size));
-                dst_void = static_cast<      void*>(static_cast<uint8_t*>(dst)
-                                                    + (i2 * ld_dst * elem_size));
-                PRINT_IF_HIP_ERROR(hipMemcpy(dst_void, src_void, column_size, hipMemcpyDeviceToDevice))
-            }
-        }
-    }
+    if(tx < m && ty < n)
+        d[tx + size_t(ldd) * ty + stride_d * batch] = zero ? To(0) : c[tx + size_t(ldc) * ty + stride_c * batch];
 }
 
-void device_strided_batched_matrix_copy(const void* src,
-                        rocblas_int ld_src,
-                        rocblas_int stride_src,
-                        void* dst,
-                        rocblas_int ld_dst,
-                        rocblas_int stride_dst,
-                        rocblas_int n1,
-                        rocblas_int n2,
-                        rocblas_int batch_count,
-                        size_t elem_size)
+// Tensile updates D in place, so C is copied into D first when they differ. The
+// copy is queued on the handle's stream like the gemm, as one hipMemcpyAsync or
+// hipMemsetAsync when both are contiguous and one kernel otherwise, so nothing
+// blocks the host. With beta = 0 C is not read: D is zeroed instead, as not
+// every Tensile kernel skips reading C when beta is 0.
+template <typename To>
+hipError_t gemm_ex_copy_c(rocblas_handle handle, bool zero,
+                          const To* c, rocblas_int ldc, rocblas_int stride_c,
+                          To* d, rocblas_int ldd, rocblas_int stride_d,
+                          rocblas_int m, rocblas_int n, rocblas_int batch_count)
 {
-    if((src != dst) || (ld_src != ld_dst) || (stride_src != stride_dst)) // no copy if src matrix == dst matrix
+    bool strided = batch_count > 1 && stride_c != stride_d;
+    if(c == d && ldc == ldd && !strided) // no copy if C and D are the same matrix
+        return hipSuccess;
+
+    if(m == ldc && m == ldd && (batch_count == 1 || (stride_c == m * n && stride_d == m * n)))
     {
-        const void* src_void;
-        void* dst_void;
+        // C and D are contiguous
+        size_t size = size_t(m) * n * batch_count * sizeof(To);
+        if(zero)
+            return hipMemsetAsync(d, 0, size, handle->rocblas_stream);
+        return hipMemcpyAsync(d, c, size, hipMemcpyDeviceToDevice, handle->rocblas_stream);
+    }
 
-        if((n1 == ld_src) && (n1 == ld_dst) && (stride_src == n2 * ld_src) && (stride_dst == n2 * ld_dst))
-        {
-            // src and dst batch matrices are contiguous, use single copy
-            size_t matrix_size = n1 * n2 * batch_count * elem_size;
-            PRINT_IF_HIP_ERROR(hipMemcpy(dst, src, matrix_size, hipMemcpyDeviceToDevice))
-        }
-        else if((n1 == ld_src) && (n1 == ld_dst))
-        {
-            // individual matrices in batch matrix are contiguous, one copy for each matrix
-            size_t matrix_size = n1 * n2 * elem_size;
-            for (int i3 = 0; i3 < batch_count; i3++)
-            {
-                src_void = static_cast<const void*>(static_cast<const uint8_t*>(src)
-                                                    + (i3 * stride_src * elem_size));
+    dim3 grid((m - 1) / GEMM_EX_COPY_DIM_X + 1, (n - 1) / GEMM_EX_COPY_DIM_Y + 1, batch_count);
+    dim3 threads(GEMM_EX_COPY_DIM_X, GEMM_EX_COPY_DIM_Y, 1);
 
-                dst_void = static_cast<      void*>(static_cast<      uint8_t*>(dst)
-                                                    + (i3 * stride_dst * elem_size));
+    hipLaunchKernelGGL((gemm_ex_copy_c_kernel<To>), grid, threads, 0, handle->rocblas_stream,
+                       m, n, c, ldc, stride_c, d, ldd, stride_d, zero);
 
-                PRINT_IF_HIP_ERROR(hipMemcpy(dst_void, src_void, matrix_size, hipMemcpyDeviceToDevice))
-            }
+    return hipGetLastError();
+}
 
-        }
-        else
-        {
-            // individual matrices not contiguous, one copy for each contiguous column
-            size_t column_size = n1 * elem_size;
-            const void* src_void;
-            void* dst_void;
-            for(int i3 = 0; i3 < batch_count; i3++)
-            {
-                for(int i2 = 0; i2 < n2; i2++)
-                {
-                    src_void = static_cast<const void*>(static_cast<const uint8_t*>(src)
-                                                        + (i2 * ld_src * elem_size)
-                                                        + (i3 * stride_src * elem_size));
-
-                    dst_void = static_cast<      void*>(static_cast<uint8_t*>(dst)
-                                                        + (i2 * ld_dst * elem_size)
-                                                        + (i3 * stride_dst * elem_size));
-
-                    PRINT_IF_HIP_ERROR(hipMemcpy(dst_void, src_void, column_size, hipMemcpyDeviceToDevice))
-                }
-            }
-        }
+// With rocblas_gemm_algo_solution_index, the Tensile launches of a gemm_ex call
+// run the compiled solution of solution_index in the device's Logic file while
+// the scope lasts; solution_index -1 runs the solution picked without it.
+class gemm_ex_solution_scope
+{
+    rocblas_handle handle;
+    rocblas_int previous;
+
+    public:
+    gemm_ex_solution_scope(rocblas_handle handle, rocblas_gemm_algo algo, int32_t solution_index)
+        : handle(handle), previous(handle->gemm_solution_index)
+    {
+        if(algo == rocblas_gemm_algo_solution_index)
+            handle->gemm_solution_index = solution_index;
     }
-}
+    ~gemm_ex_solution_scope() { handle->gemm_solution_index = previous; }
+
+    gemm_ex_solution_scope(const gemm_ex_solution_scope&) = delete;
+    gemm_ex_solution_scope& operator=(const gemm_ex_solution_scope&) = delete;
+};
+
 //------------------------------------------------------------------------------
 // Ti is typename for input data, To is typename for output data, Tc is typename for compute
-template <typename Ti, typename To, typename Tc>
-TensileStatus tensile_Cijk_Ailk_Bljk_B(To* dataC, const Ti* dataA, const Ti* dataB, Tc alpha, Tc beta,
-              unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream);
-template <typename Ti, typename To, typename Tc>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B(To* dataC, const Ti* dataA, const Ti* dataB, Tc alpha, Tc beta,
-              unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream);
-template <typename Ti, typename To, typename Tc>
-TensileStatus tensile_Cijk_Alik_Bljk_B(To* dataC, const Ti* dataA, const Ti* dataB, Tc alpha, Tc beta,
-              unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream);
-template <typename Ti, typename To, typename Tc>
-TensileStatus tensile_Cijk_Alik_Bjlk_B(To* dataC, const Ti* dataA, const Ti* dataB, Tc alpha, Tc beta,
-              unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream);
-//---typename_data=TensileHalf-----typename_compute=float---------------------------
-template <>
-TensileStatus tensile_Cijk_Ailk_Bljk_B<TensileHalf,TensileHalf,float>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    //TODO: alpha and beta need to have precision equal to compute type, not data type
-    TensileHalf alpha_half = static_cast<TensileHalf>(alpha);
-    TensileHalf beta_half = static_cast<TensileHalf>(beta);
-    return tensile_Cijk_Ailk_Bljk_HBH(dataC, dataA, dataB, alpha_half, beta_half, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B<TensileHalf,TensileHalf,float>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    //TODO: alpha and beta need to have precision equal to compute type, not data type
-    TensileHalf alpha_half = static_cast<TensileHalf>(alpha);
-    TensileHalf beta_half = static_cast<TensileHalf>(beta);
-    return tensile_Cijk_Ailk_Bjlk_HBH(dataC, dataA, dataB, alpha_half, beta_half, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bljk_B<TensileHalf,TensileHalf,float>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    //TODO: alpha and beta need to have precision equal to compute type, not data type
-    TensileHalf alpha_half = static_cast<TensileHalf>(alpha);
-    TensileHalf beta_half = static_cast<TensileHalf>(beta);
-    return tensile_Cijk_Alik_Bljk_HBH(dataC, dataA, dataB, alpha_half, beta_half, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bjlk_B<TensileHalf,TensileHalf,float>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    //TODO: alpha and beta need to have precision equal to compute type, not data type
-    TensileHalf alpha_half = static_cast<TensileHalf>(alpha);
-    TensileHalf beta_half = static_cast<TensileHalf>(beta);
-    return tensile_Cijk_Alik_Bjlk_HBH(dataC, dataA, dataB, alpha_half, beta_half, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-//---typename_data=TensileHalf-----typename_compute=TensileHalf---------------------
-template <>
-TensileStatus tensile_Cijk_Ailk_Bljk_B<TensileHalf,TensileHalf,TensileHalf>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              TensileHalf alpha, TensileHalf beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bljk_HB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B<TensileHalf,TensileHalf,TensileHalf>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              TensileHalf alpha, TensileHalf beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bjlk_HB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bljk_B<TensileHalf,TensileHalf,TensileHalf>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              TensileHalf alpha, TensileHalf beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bljk_HB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bjlk_B<TensileHalf,TensileHalf,TensileHalf>(
-              TensileHalf* dataC, const TensileHalf* dataA, const TensileHalf* dataB,
-              TensileHalf alpha, TensileHalf beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bjlk_HB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-//---typename_data=float-----------typename_compute=float---------------------------
-template <>
-TensileStatus tensile_Cijk_Ailk_Bljk_B<float,float,float>(float* dataC, const float* dataA, const float* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bljk_SB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B<float,float,float>(float* dataC, const float* dataA, const float* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bjlk_SB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bljk_B<float,float,float>(float* dataC, const float* dataA, const float* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bljk_SB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bjlk_B<float,float,float>(float* dataC, const float* dataA, const float* dataB,
-              float alpha, float beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bjlk_SB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-//---typename_data=double----------typename_compute=double--------------------------
-template <>
-TensileStatus tensile_Cijk_Ailk_Bljk_B<double,double,double>(double* dataC, const double* dataA, const double* dataB,
-              double alpha, double beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bljk_DB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B<double,double,double>(double* dataC, const double* dataA, const double* dataB,
-              double alpha, double beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bjlk_DB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bljk_B<double,double,double>(double* dataC, const double* dataA, const double* dataB,
-              double alpha, double beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bljk_DB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bjlk_B<double,double,double>(double* dataC, const double* dataA, const double* dataB,
-              double alpha, double beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bjlk_DB(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-//---typename_input=int8----typename_output=int------typename_compute=int--------------------------
-template <>
-TensileStatus tensile_Cijk_Ailk_Bljk_B<TensileInt8x4,TensileInt32,TensileInt32>(TensileInt32* dataC, const TensileInt8x4* dataA, const TensileInt8x4* dataB,
-              TensileInt32 alpha, TensileInt32 beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bljk_4xi8BH(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Ailk_Bjlk_B<TensileInt8x4,TensileInt32,TensileInt32>(TensileInt32* dataC, const TensileInt8x4* dataA, const TensileInt8x4* dataB,
-              TensileInt32 alpha, TensileInt32 beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Ailk_Bjlk_4xi8BH(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bljk_B<TensileInt8x4,TensileInt32,TensileInt32>(TensileInt32* dataC, const TensileInt8x4* dataA, const TensileInt8x4* dataB,
-              TensileInt32 alpha, TensileInt32 beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bljk_4xi8BH(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-template <>
-TensileStatus tensile_Cijk_Alik_Bjlk_B<TensileInt8x4,TensileInt32,TensileInt32>(TensileInt32* dataC, const TensileInt8x4* dataA, const TensileInt8x4* dataB,
-              TensileInt32 alpha, TensileInt32 beta, unsigned int offsetC, unsigned int offsetA, unsigned int offsetB,
-              unsigned int strideC1J, unsigned int strideC2K, unsigned int strideA1L, unsigned int strideA2K,
-              unsigned int strideB1J, unsigned int strideB2K,
-              unsigned int sizeI, unsigned int sizeJ, unsigned int sizeK, unsigned int sizeL, hipStream_t stream)
-{
-    return tensile_Cijk_Alik_Bjlk_4xi8BH(dataC, dataA, dataB, alpha, beta, offsetC, offsetA, offsetB,
-           strideC1J, strideC2K, strideA1L, strideA2K, strideB1J, strideB2K,
-           sizeI, sizeJ, sizeK, sizeL, stream, 0, nullptr, nullptr);
-}
-//------------------------------------------------------------------------------
-
 template <typename Ti, typename To, typename Tc>
 rocblas_status gemm_ex_handle_transpose(rocblas_handle handle,
                rocblas_operation trans_a,
@@ -388,76 +92,35 @@ rocblas_status gemm_ex_handle_transpose(rocblas_handle handle,
     TensileStatus t_status;
     rocblas_status rb_status;
 
-    device_strided_batched_matrix_copy(c, ldc, stride_c, d, ldd, stride_d, m, n, batch_count, sizeof(To));
+    const tensile_entry<Ti,To,Tc>& tensile = tensile_dispatch<Ti,To,Tc>::get(GetTransposeMode(trans_a, trans_b));
 
-    if((trans_a == rocblas_operation_none) && (trans_b == rocblas_operation_none))
-    {
-        t_status = tensile_Cijk_Ailk_Bljk_B<Ti,To,Tc>(static_cast<To*>(d), 
-                                                      static_cast<const Ti*>(a), 
-                                                      static_cast<const Ti*>(b),
-                                                      alpha, beta, 0, 0, 0, 
-                                                      static_cast<unsigned int>(ldd), stride_d, 
-                                                      static_cast<unsigned int>(lda), stride_a, 
-                                                      static_cast<unsigned int>(ldb), stride_b,
-                                                      static_cast<unsigned int>(m), 
-                                                      static_cast<unsigned int>(n), 
-                                                      static_cast<unsigned int>(batch_count), 
-                                                      static_cast<unsigned int>(k), 
-                                                      handle->rocblas_stream);
-    }
-    else if((trans_a == rocblas_operation_none) &&
-            (trans_b == rocblas_operation_transpose || trans_b == rocblas_operation_conjugate_transpose))
+    // a solution picked by index is called directly from the compiled table
+    const tensile_table_solution* forced = nullptr;
+    if(handle->gemm_solution_index != -1)
     {
-        t_status = tensile_Cijk_Ailk_Bjlk_B<Ti,To,Tc>(static_cast<To*>(d), 
-                                                      static_cast<const Ti*>(a), 
-                                                      static_cast<const Ti*>(b),
-                                                      alpha, beta, 0, 0, 0, 
-                                                      static_cast<unsigned int>(ldd), stride_d, 
-                                                      static_cast<unsigned int>(lda), stride_a, 
-                                                      static_cast<unsigned int>(ldb), stride_b,
-                                                      static_cast<unsigned int>(m), 
-                                                      static_cast<unsigned int>(n), 
-                                                      static_cast<unsigned int>(batch_count), 
-                                                      static_cast<unsigned int>(k), 
-                                                      handle->rocblas_stream);
+        rb_status = tensile_solution_at(tensile.problem_type(), handle->device,
+                                        handle->gemm_solution_index,
+                                        {{m, n, batch_count, k}}, forced);
+        if(rb_status != rocblas_status_success)
+            return rb_status;
     }
-    else if((trans_a == rocblas_operation_transpose || trans_a == rocblas_operation_conjugate_transpose) &&
-            (trans_b == rocblas_operation_none))
-    {
-        t_status = tensile_Cijk_Alik_Bljk_B<Ti,To,Tc>(static_cast<To*>(d),
-                                                      static_cast<const Ti*>(a),
-                                                      static_cast<const Ti*>(b),
-                                                      alpha, beta, 0, 0, 0, 
-                                                      static_cast<unsigned int>(ldd), stride_d, 
-                                                      static_cast<unsigned int>(lda), stride_a, 
-                                                      static_cast<unsigned int>(ldb), stride_b,
-                                                      static_cast<unsigned int>(m), 
-                                                      static_cast<unsigned int>(n),
-                                                      static_cast<unsigned int>(batch_count), 
-                                                      static_cast<unsigned int>(k),
-                                                      handle->rocblas_stream);
-    }
-    else if((trans_a == rocblas_operation_transpose || trans_a == rocblas_operation_conjugate_transpose) &&
-            (trans_b == rocblas_operation_transpose || trans_b == rocblas_operation_conjugate_transpose))
-    {
-        t_status = tensile_Cijk_Alik_Bjlk_B<Ti,To,Tc>(static_cast<To*>(d),
-                                                      static_cast<const Ti*>(a),
-                                                      static_cast<const Ti*>(b),
-                                                      alpha, beta, 0, 0, 0, 
-                                                      static_cast<unsigned int>(ldd), stride_d, 
-                                                      static_cast<unsigned int>(lda), stride_a, 
-                                                      static_cast<unsigned int>(ldb), stride_b,
-                                                      static_cast<unsigned int>(m), 
-                                                      static_cast<unsigned int>(n),
-                                                      static_cast<unsigned int>(batch_count), 
-                                                      static_cast<unsigned int>(k),
-                                                      handle->rocblas_stream);
-    }
-    else
+
+    RETURN_IF_HIP_ERROR(gemm_ex_copy_c(handle, beta == 0, c, ldc, stride_c, d, ldd, stride_d, m, n, batch_count));
+
+    if(rocblas_solution_log_enabled(handle))
     {
-        t_status = tensileStatusFailure;
+        log_solution(handle, trans_a, trans_b, tensile_dispatch<Ti,To,Tc>::precision(),
+                     m, n, batch_count, k, ldd, stride_d, lda, stride_a, ldb, stride_b,
+                     tensile.solution_name(ldd, stride_d, lda, stride_a, ldb, stride_b,
+                                           m, n, batch_count, k, handle->device,
+                                           handle->rocblas_stream, forced));
     }
 
+    t_status = tensile.call(d, a, b, alpha, beta,
+                            ldd, stride_d, lda, stride_a, ldb, stride_b,
+                            m, n, batch_count, k,
+                            handle->device, handle->rocblas_stream, forced);
+
     if(t_status == tensileStatusSuccess)
     {
         rb_status = rocblas_status_success;
@@ -470,99 +133,241 @@ rocblas_status gemm_ex_handle_transpose(rocblas_handle handle,
     return rb_status;
 }
 
-#if defined(USE_CHUNKING)
-template <typename Ti, typename To, typename Tc>
-rocblas_status gemm_ex_chunking(rocblas_handle handle,
-                            rocblas_operation trans_a,
-                            rocblas_operation trans_b,
-                            unsigned int m,
-                            unsigned int n,
-                            unsigned int k,
-                            Tc alpha,
-                            const Ti* a, unsigned int lda, unsigned int stride_a,
-                            const Ti* b, unsigned int ldb, unsigned int stride_b,
-                            Tc beta,
-                            const To* c, unsigned int ldc, unsigned int stride_c,
-                            To* d, unsigned int ldd, unsigned int stride_d,
-                            unsigned int batch_count)
+// Largest chunk of a dimension of length len that spans at most limit elements
+// when each step along it is ld elements apart; ld = 0 means the dimension does
+// not step through the operand's columns, and it is not split for it.
+inline int64_t gemm_ex_chunk_size(int64_t len, int64_t ld, int64_t limit)
 {
-    unsigned int int_limit      = std::numeric_limits<int>::max() / sizeof(To);
-    unsigned int m_chunk_size = m;
-    unsigned int n_chunk_size = n;
+    int64_t chunk = ld ? limit / ld : len;
+    chunk = chunk < len ? chunk : len;
+    return chunk < std::numeric_limits<int>::max() ? chunk : std::numeric_limits<int>::max();
+}
 
-    unsigned int m_chunk_size_a;
-    unsigned int n_chunk_size_b;
-    unsigned int n_chunk_size_c = int_limit / ldc;
-    unsigned int n_chunk_size_d = int_limit / ldd;
+// Largest number of matrices of span elements, stride elements apart, that fit in limit elements
+inline int64_t gemm_ex_batch_chunk_size(int64_t batch_count, int64_t stride, int64_t span, int64_t limit)
+{
+    int64_t chunk = stride && span <= limit ? (limit - span) / stride + 1 : batch_count;
+    chunk = chunk < batch_count ? chunk : batch_count;
+    return chunk < std::numeric_limits<int>::max() ? chunk : std::numeric_limits<int>::max();
+}
 
-    n_chunk_size = n_chunk_size < n_chunk_size_c ? n_chunk_size : n_chunk_size_c;
-    n_chunk_size = n_chunk_size < n_chunk_size_d ? n_chunk_size : n_chunk_size_d;
+// Tensile takes 32-bit sizes, leading dimensions and strides, and indexes each
+// operand with offsets that must stay below INT_MAX bytes. A problem beyond
+// that, which only the 64-bit API can pose, runs as chunks of m, n, k and batch
+// that each fit. The chunks of m, n and batch write disjoint parts of D, so
+// they are issued round-robin on side streams of the handle (see handle.h) and
+// run concurrently; the chunks of k of one part of D accumulate into it in
+// order on one stream, the first with beta and the rest with beta = 1.
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_ex_chunking(rocblas_handle handle,
+                                rocblas_operation trans_a,
+                                rocblas_operation trans_b,
+                                int64_t m,
+                                int64_t n,
+                                int64_t k,
+                                Tc alpha,
+                                const Ti* a, int64_t lda, int64_t stride_a,
+                                const Ti* b, int64_t ldb, int64_t stride_b,
+                                Tc beta,
+                                const To* c, int64_t ldc, int64_t stride_c,
+                                To* d, int64_t ldd, int64_t stride_d,
+                                int64_t batch_count)
+{
+    const int64_t limit_ab = std::numeric_limits<int>::max() / sizeof(Ti);
+    const int64_t limit_cd = std::numeric_limits<int>::max() / sizeof(To);
+    const bool    none_a   = trans_a == rocblas_operation_none;
+    const bool    none_b   = trans_b == rocblas_operation_none;
+
+    // columns of A and B step along m, n or k depending on the transpose
+    int64_t m_chunk = gemm_ex_chunk_size(m, none_a ? 0 : lda, limit_ab);
+    int64_t n_chunk = gemm_ex_chunk_size(n, ldc > ldd ? ldc : ldd, limit_cd);
+    n_chunk         = gemm_ex_chunk_size(n_chunk, none_b ? ldb : 0, limit_ab);
+    int64_t k_chunk = gemm_ex_chunk_size(k, none_a ? lda : 0, limit_ab);
+    k_chunk         = gemm_ex_chunk_size(k_chunk, none_b ? 0 : ldb, limit_ab);
+
+    // a single row or column does not fit in a 32-bit offset
+    if(m_chunk < 1 || n_chunk < 1 || (k > 0 && k_chunk < 1))
+        return rocblas_status_invalid_size;
 
-    if(trans_b == rocblas_operation_none)
-    {
-        n_chunk_size_b = int_limit / ldb;
-        n_chunk_size = n_chunk_size < n_chunk_size_b ? n_chunk_size : n_chunk_size_b;
-    }
+    // elements one chunk of each operand spans within a matrix of the batch
+    int64_t span_a  = none_a ? lda * (k_chunk ? k_chunk - 1 : 0) + m_chunk : lda * (m_chunk - 1) + k_chunk;
+    int64_t span_b  = none_b ? ldb * (n_chunk - 1) + k_chunk : ldb * (k_chunk ? k_chunk - 1 : 0) + n_chunk;
+    int64_t span_c  = ldc * (n_chunk - 1) + m_chunk;
+    int64_t span_d  = ldd * (n_chunk - 1) + m_chunk;
+
+    int64_t b_chunk = gemm_ex_batch_chunk_size(batch_count, stride_a, span_a, limit_ab);
+    b_chunk         = gemm_ex_batch_chunk_size(b_chunk, stride_b, span_b, limit_ab);
+    b_chunk         = gemm_ex_batch_chunk_size(b_chunk, stride_c, span_c, limit_cd);
+    b_chunk         = gemm_ex_batch_chunk_size(b_chunk, stride_d, span_d, limit_cd);
+    if(b_chunk < 1)
+        return rocblas_status_invalid_size;
 
-    if(trans_a == rocblas_operation_transpose || trans_a == rocblas_operation_conjugate_transpose)
+    // chunks of one matrix step by no stride, so one too large for Tensile is
+    // replaced by the size of the chunk, which it is only checked against
+    int64_t t_stride_a = stride_a, t_stride_b = stride_b, t_stride_c = stride_c, t_stride_d = stride_d;
+    if(b_chunk == 1)
     {
-        m_chunk_size_a = int_limit / lda;
-        m_chunk_size = m_chunk_size < m_chunk_size_a ? m_chunk_size : m_chunk_size_a;
+        if(stride_a > limit_ab) t_stride_a = none_a ? lda * k_chunk : lda * m_chunk;
+        if(stride_b > limit_ab) t_stride_b = none_b ? ldb * n_chunk : ldb * k_chunk;
+        if(stride_c > limit_cd) t_stride_c = ldc * n_chunk;
+        if(stride_d > limit_cd) t_stride_d = ldd * n_chunk;
     }
 
-    // if chunk_size < 1 return error because offset for a single row or column is larger than
-    // can fit into 32 bit register
-    if(m_chunk_size < 1) return rocblas_status_invalid_size;
-    if(n_chunk_size < 1) return rocblas_status_invalid_size;
+    if(m_chunk == m && n_chunk == n && k_chunk == k && b_chunk == batch_count)
+        return gemm_ex_handle_transpose<Ti,To,Tc>(handle, trans_a, trans_b, m, n, k, alpha,
+                                                  a, lda, t_stride_a, b, ldb, t_stride_b, beta,
+                                                  c, ldc, t_stride_c, d, ldd, t_stride_d, batch_count);
 
-    unsigned int n_chunk_count  = ((n - 1) / n_chunk_size) + 1;
-    unsigned int m_chunk_count  = ((m - 1) / m_chunk_size) + 1;
+    int64_t m_count = (m - 1) / m_chunk + 1;
+    int64_t n_count = (n - 1) / n_chunk + 1;
+    int64_t k_count = k ? (k - 1) / k_chunk + 1 : 1;
+    int64_t b_count = (batch_count - 1) / b_chunk + 1;
+    int64_t tiles   = m_count * n_count * b_count;
 
-    rocblas_status return_status = rocblas_status_success;
-    rocblas_status status = rocblas_status_success;
+    auto streams = handle->fork_streams(tiles < _rocblas_handle::max_side_streams ? rocblas_int(tiles) : _rocblas_handle::max_side_streams);
 
-    for(int n_chunk_iterator = 0; n_chunk_iterator < n_chunk_count; n_chunk_iterator++)
+    for(int64_t tile = 0; tile < tiles; tile++)
     {
-        unsigned int n_chunk_remaining = n - (n_chunk_size * n_chunk_iterator);
+        int64_t i_m = tile % m_count;
+        int64_t i_n = tile / m_count % n_count;
+        int64_t i_b = tile / (m_count * n_count);
 
-        unsigned int n_chunk_size_corrected = n_chunk_size < n_chunk_remaining ? n_chunk_size : n_chunk_remaining;
+        int64_t m_size = m - i_m * m_chunk < m_chunk ? m - i_m * m_chunk : m_chunk;
+        int64_t n_size = n - i_n * n_chunk < n_chunk ? n - i_n * n_chunk : n_chunk;
+        int64_t b_size = batch_count - i_b * b_chunk < b_chunk ? batch_count - i_b * b_chunk : b_chunk;
 
-        for(int m_chunk_iterator = 0; m_chunk_iterator < m_chunk_count; m_chunk_iterator++)
-        {
-            unsigned int m_chunk_remaining = m - (m_chunk_size * m_chunk_iterator);
+        size_t off_a = size_t(stride_a) * b_chunk * i_b + (none_a ? i_m * m_chunk : size_t(lda) * i_m * m_chunk);
+        size_t off_b = size_t(stride_b) * b_chunk * i_b + (none_b ? size_t(ldb) * i_n * n_chunk : i_n * n_chunk);
+        size_t off_c = size_t(stride_c) * b_chunk * i_b + size_t(ldc) * i_n * n_chunk + i_m * m_chunk;
+        size_t off_d = size_t(stride_d) * b_chunk * i_b + size_t(ldd) * i_n * n_chunk + i_m * m_chunk;
 
-            unsigned int m_chunk_size_corrected = m_chunk_size < m_chunk_remaining ? m_chunk_size : m_chunk_remaining;
+        if(streams.size())
+            streams.select(tile % streams.size());
 
-            size_t c_offset = n_chunk_iterator * n_chunk_size * ldc + m_chunk_iterator * m_chunk_size;
-            size_t d_offset = n_chunk_iterator * n_chunk_size * ldd + m_chunk_iterator * m_chunk_size;
-            size_t a_offset = m_chunk_iterator * m_chunk_size;
-            size_t b_offset = n_chunk_iterator * n_chunk_size;
+        for(int64_t i_k = 0; i_k < k_count; i_k++)
+        {
+            int64_t k_size = k - i_k * k_chunk < k_chunk ? k - i_k * k_chunk : k_chunk;
+            size_t  k_a    = none_a ? size_t(lda) * i_k * k_chunk : i_k * k_chunk;
+            size_t  k_b    = none_b ? i_k * k_chunk : size_t(ldb) * i_k * k_chunk;
+
+            // later chunks of k add to what the earlier ones left in D
+            bool first = i_k == 0;
+            rocblas_status status = gemm_ex_handle_transpose<Ti,To,Tc>(handle, trans_a, trans_b,
+                                        m_size, n_size, k_size, alpha,
+                                        a + off_a + k_a, lda, t_stride_a,
+                                        b + off_b + k_b, ldb, t_stride_b,
+                                        first ? beta : static_cast<Tc>(1),
+                                        first ? c + off_c : d + off_d, first ? ldc : ldd, first ? t_stride_c : t_stride_d,
+                                        d + off_d, ldd, t_stride_d, b_size);
+            if(status != rocblas_status_success)
+                return status;
+        }
+    }
+    return rocblas_status_success;
+}
 
-            if(trans_b == rocblas_operation_none) b_offset *= ldb;
-            if(trans_a != rocblas_operation_none) a_offset *= lda;
+// Device pointer mode: the product of each chunk of the plan of
+// gemm_device_pointer_choose goes into W with alpha = 1 and beta = 0 through
+// gemm_ex_chunking, where chunks of k Tensile cannot take whole accumulate, and
+// one kernel then applies alpha and beta from device memory to that part of D
+// (see gemm_device.h). Nothing waits for the stream.
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_ex_device_pointer(rocblas_handle handle,
+                                      rocblas_operation trans_a,
+                                      rocblas_operation trans_b,
+                                      int64_t m,
+                                      int64_t n,
+                                      int64_t k,
+                                      const Tc* alpha,
+                                      const Ti* a, int64_t lda, int64_t stride_a,
+                                      const Ti* b, int64_t ldb, int64_t stride_b,
+                                      const Tc* beta,
+                                      const To* c, int64_t ldc, int64_t stride_c,
+                                      To* d, int64_t ldd, int64_t stride_d,
+                                      int64_t batch_count,
+                                      To* W)
+{
+    gemm_device_pointer_plan plan = gemm_device_pointer_choose(m, n, batch_count, sizeof(To));
 
+    for(int64_t i_b = 0; i_b < batch_count; i_b += plan.batches)
+    {
+        int64_t b_size = batch_count - i_b < plan.batches ? batch_count - i_b : plan.batches;
 
-            status = gemm_ex_handle_transpose<Ti, To, Tc>(
-                            handle,
-                            trans_a,
-                            trans_b,
-                            m_chunk_size_corrected,
-                            n_chunk_size_corrected,
-                            k,
-                            alpha,
-                            a + a_offset, lda, stride_a,
-                            b + b_offset, ldb, stride_b, beta,
-                            c + c_offset, ldc, stride_c,
-                            d + d_offset, ldd, stride_d, batch_count);
+        for(int64_t i_n = 0; i_n < n; i_n += plan.columns)
+        {
+            int64_t n_size = n - i_n < plan.columns ? n - i_n : plan.columns;
 
-            if(status != rocblas_status_success) return_status = status;
+            for(int64_t i_m = 0; i_m < m; i_m += plan.rows)
+            {
+                int64_t m_size = m - i_m < plan.rows ? m - i_m : plan.rows;
+
+                size_t off_a = size_t(stride_a) * i_b + (trans_a == rocblas_operation_none ? i_m : size_t(lda) * i_m);
+                size_t off_b = size_t(stride_b) * i_b + (trans_b == rocblas_operation_none ? size_t(ldb) * i_n : i_n);
+                size_t off_c = size_t(stride_c) * i_b + size_t(ldc) * i_n + i_m;
+                size_t off_d = size_t(stride_d) * i_b + size_t(ldd) * i_n + i_m;
+
+                // not every Tensile kernel skips reading C when beta is 0
+                RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, W, sizeof(To) * m_size * n_size * b_size));
+
+                rocblas_status status = gemm_ex_chunking<Ti,To,Tc>(handle, trans_a, trans_b,
+                                                      m_size, n_size, k, static_cast<Tc>(1),
+                                                      a + off_a, lda, stride_a,
+                                                      b + off_b, ldb, stride_b,
+                                                      static_cast<Tc>(0),
+                                                      W, m_size, m_size * n_size,
+                                                      W, m_size, m_size * n_size,
+                                                      b_size);
+                if(status != rocblas_status_success)
+                    return status;
+
+                // one plan chunk of W is below INT_MAX elements; C and D are
+                // indexed by the scale kernel with size_t offsets
+                RETURN_IF_HIP_ERROR(gemm_device_pointer_scale(handle,
+                                                              rocblas_int(m_size), rocblas_int(n_size), rocblas_int(b_size),
+                                                              alpha, W, beta,
+                                                              c + off_c, ldc, stride_c,
+                                                              d + off_d, ldd, stride_d));
+            }
         }
     }
-    return return_status;
+    return rocblas_status_success;
+}
+
+// Run the product of each chunk of k of a split plan with alpha = 1 and beta = 0
+// into its slice of W; a plan of 1 split puts the whole product in W.
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_ex_split_k_product(rocblas_handle handle,
+                                       rocblas_operation trans_a, rocblas_operation trans_b,
+                                       rocblas_int m, rocblas_int n, const gemm_split_k_plan& split,
+                                       const Ti* a, rocblas_int lda,
+                                       const Ti* b, rocblas_int ldb, To* W)
+{
+    unsigned int mn  = static_cast<unsigned int>(m) * n;
+    unsigned int s_a = gemm_split_k_stride_a(trans_a, lda, split.chunk);
+    unsigned int s_b = gemm_split_k_stride_b(trans_b, ldb, split.chunk);
+
+    rocblas_status status = gemm_ex_chunking<Ti,To,Tc>(handle, trans_a, trans_b,
+                                      static_cast<unsigned int>(m), static_cast<unsigned int>(n), static_cast<unsigned int>(split.chunk),
+                                      static_cast<Tc>(1),
+                                      a, static_cast<unsigned int>(lda), s_a,
+                                      b, static_cast<unsigned int>(ldb), s_b,
+                                      static_cast<Tc>(0),
+                                      W, static_cast<unsigned int>(m), mn,
+                                      W, static_cast<unsigned int>(m), mn,
+                                      static_cast<unsigned int>(split.splits));
+    if(status != rocblas_status_success || !split.tail)
+        return status;
+
+    return gemm_ex_chunking<Ti,To,Tc>(handle, trans_a, trans_b,
+                                      static_cast<unsigned int>(m), static_cast<unsigned int>(n), static_cast<unsigned int>(split.tail),
+                                      static_cast<Tc>(1),
+                                      a + size_t(s_a) * split.splits, static_cast<unsigned int>(lda), s_a,
+                                      b + size_t(s_b) * split.splits, static_cast<unsigned int>(ldb), s_b,
+                                      static_cast<Tc>(0),
+                                      W + size_t(mn) * split.splits, static_cast<unsigned int>(m), mn,
+                                      W + size_t(mn) * split.splits, static_cast<unsigned int>(m), mn,
+                                      1);
 }
-#else
-#define gemm_ex_chunking        gemm_ex_handle_transpose
-#endif  // defined(USE_CHUNKING)
 
 template <typename Ti, typename To, typename Tc>
 rocblas_status gemm_ex_typecasting(rocblas_handle handle,
@@ -573,21 +378,90 @@ rocblas_status gemm_ex_typecasting(rocblas_handle handle,
                                    const void* c, rocblas_int ldc, rocblas_int stride_c,
                                    void* d, rocblas_int ldd, rocblas_int stride_d, rocblas_int batch_count)
 {
-    Tc h_alpha;
-    Tc h_beta;
+    // check alignment of pointers before casting
+    if(!isAligned(a, sizeof(Ti)) || !isAligned(b, sizeof(Ti)) ||
+       !isAligned(c, sizeof(To)) || !isAligned(d, sizeof(To)))
+    {
+        return rocblas_status_invalid_size;
+    }
 
-    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    // few output tiles and a long k: the chunks of k run as a batch into W, and
+    // are summed into d with alpha and beta (see gemm_split_k.h)
+    gemm_split_k_plan split = gemm_split_k_choose<To>(handle, m, n, k, batch_count);
+
+    // only report the workspace size while the handle is in a size query
+    size_t w_size = split.splits > 1 ? gemm_split_k_workspace_size(m, n, split, sizeof(To))
+                                     : gemm_device_pointer_workspace_size(handle, m, n, batch_count, sizeof(To));
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(w_size);
+
+    if(split.splits > 1)
     {
-        // copy alpha and beta from device to host and convert type
-        hipMemcpy(&h_alpha, alpha, sizeof(Tc), hipMemcpyDeviceToHost);
-        hipMemcpy(&h_beta, beta, sizeof(Tc), hipMemcpyDeviceToHost);
+        auto w = handle->device_malloc(w_size);
+        if(!w)
+            return rocblas_status_memory_error;
+        RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, w.get(), w_size));
+
+        To* W                 = static_cast<To*>(w.get());
+        rocblas_status status = gemm_ex_split_k_product<Ti,To,Tc>(handle, trans_a, trans_b, m, n, split,
+                                                                  static_cast<const Ti*>(a), lda,
+                                                                  static_cast<const Ti*>(b), ldb, W);
+        if(status != rocblas_status_success)
+            return status;
+
+        RETURN_IF_HIP_ERROR(gemm_split_k_reduce(handle, m, n, split.slices(),
+                                                static_cast<const Tc*>(alpha), static_cast<const To*>(W),
+                                                static_cast<const Tc*>(beta),
+                                                static_cast<const To*>(c), ldc,
+                                                static_cast<To*>(d), ldd));
+        return rocblas_status_success;
     }
-    else
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
     {
-        h_alpha = *(static_cast<const Tc*>(alpha));
-        h_beta = *(static_cast<const Tc*>(beta));
+        return gemm_ex_chunking<Ti,To,Tc>(handle,
+                                          trans_a,
+                                          trans_b,
+                                          static_cast<unsigned int>(m),
+                                          static_cast<unsigned int>(n),
+                                          static_cast<unsigned int>(k),
+                                          *(static_cast<const Tc*>(alpha)),
+                                          static_cast<const Ti*>(a), static_cast<unsigned int>(lda), static_cast<unsigned int>(stride_a),
+                                          static_cast<const Ti*>(b), static_cast<unsigned int>(ldb), static_cast<unsigned int>(stride_b),
+                                          *(static_cast<const Tc*>(beta)),
+                                          static_cast<const To*>(c), static_cast<unsigned int>(ldc), static_cast<unsigned int>(stride_c),
+                                          static_cast<      To*>(d), static_cast<unsigned int>(ldd), static_cast<unsigned int>(stride_d),
+                                          static_cast<unsigned int>(batch_count));
     }
 
+    // device pointer mode: the product goes into W a bounded chunk at a
+    // time, and alpha and beta are applied on the device
+    auto w = handle->device_malloc(w_size);
+    if(!w)
+        return rocblas_status_memory_error;
+
+    return gemm_ex_device_pointer<Ti,To,Tc>(handle, trans_a, trans_b, m, n, k,
+                                            static_cast<const Tc*>(alpha),
+                                            static_cast<const Ti*>(a), lda, stride_a,
+                                            static_cast<const Ti*>(b), ldb, stride_b,
+                                            static_cast<const Tc*>(beta),
+                                            static_cast<const To*>(c), ldc, stride_c,
+                                            static_cast<To*>(d), ldd, stride_d, batch_count,
+                                            static_cast<To*>(w.get()));
+}
+
+// 64-bit sizes, leading dimensions or strides: the problem goes to gemm_ex_chunking
+// whole. In device pointer mode it goes through W a bounded chunk at a time, as
+// in gemm_ex_typecasting, so alpha and beta stay on the device.
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_ex_64_typecasting(rocblas_handle handle,
+                                      rocblas_operation trans_a, rocblas_operation trans_b,
+                                      int64_t m, int64_t n, int64_t k, const void* alpha,
+                                      const void* a, int64_t lda, int64_t stride_a,
+                                      const void* b, int64_t ldb, int64_t stride_b, const void* beta,
+                                      const void* c, int64_t ldc, int64_t stride_c,
+                                      void* d, int64_t ldd, int64_t stride_d, int64_t batch_count)
+{
     // check alignment of pointers before casting
     if(!isAligned(a, sizeof(Ti)) || !isAligned(b, sizeof(Ti)) ||
        !isAligned(c, sizeof(To)) || !isAligned(d, sizeof(To)))
@@ -595,18 +469,397 @@ rocblas_status gemm_ex_typecasting(rocblas_handle handle,
         return rocblas_status_invalid_size;
     }
 
-    return gemm_ex_chunking<Ti,To,Tc>(handle,
-                                      trans_a,
-                                      trans_b,
-                                      static_cast<unsigned int>(m),
-                                      static_cast<unsigned int>(n),
-                                      static_cast<unsigned int>(k),
-                                      h_alpha,
-                                      static_cast<const Ti*>(a), static_cast<unsigned int>(lda), static_cast<unsigned int>(stride_a),
-                                      static_cast<const Ti*>(b), static_cast<unsigned int>(ldb), static_cast<unsigned int>(stride_b),
-                                      h_beta,
-                                      static_cast<const To*>(c), static_cast<unsigned int>(ldc), static_cast<unsigned int>(stride_c),
-                                      static_cast<      To*>(d), static_cast<unsigned int>(ldd), static_cast<unsigned int>(stride_d),
-                                      static_cast<unsigned int>(batch_count));
+    // only report the workspace size while the handle is in a size query
+    size_t w_size = gemm_device_pointer_workspace_size(handle, m, n, batch_count, sizeof(To));
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(w_size);
+
+    if(rocblas_pointer_mode_host == handle->pointer_mode)
+    {
+        return gemm_ex_chunking<Ti,To,Tc>(handle, trans_a, trans_b, m, n, k,
+                                          *static_cast<const Tc*>(alpha),
+                                          static_cast<const Ti*>(a), lda, stride_a,
+                                          static_cast<const Ti*>(b), ldb, stride_b,
+                                          *static_cast<const Tc*>(beta),
+                                          static_cast<const To*>(c), ldc, stride_c,
+                                          static_cast<To*>(d), ldd, stride_d, batch_count);
+    }
+
+    auto w = handle->device_malloc(w_size);
+    if(!w)
+        return rocblas_status_memory_error;
+
+    return gemm_ex_device_pointer<Ti,To,Tc>(handle, trans_a, trans_b, m, n, k,
+                                            static_cast<const Tc*>(alpha),
+                                            static_cast<const Ti*>(a), lda, stride_a,
+                                            static_cast<const Ti*>(b), ldb, stride_b,
+                                            static_cast<const Tc*>(beta),
+                                            static_cast<const To*>(c), ldc, stride_c,
+                                            static_cast<To*>(d), ldd, stride_d, batch_count,
+                                            static_cast<To*>(w.get()));
+}
+
+// bfloat16 A and B with float compute: A and B are widened to float, and a
+// single precision launch runs over the widened copies (see gemm_bf16.h), a
+// chunk of the batch at a time. C and D are To, bfloat16 or float.
+template <typename To>
+rocblas_status gemm_ex_bf16_typecasting(rocblas_handle handle,
+                                        rocblas_operation trans_a, rocblas_operation trans_b,
+                                        rocblas_int m, rocblas_int n, rocblas_int k, const void* alpha,
+                                        const void* a, rocblas_int lda, rocblas_int stride_a,
+                                        const void* b, rocblas_int ldb, rocblas_int stride_b, const void* beta,
+                                        const void* c, rocblas_int ldc, rocblas_int stride_c,
+                                        void* d, rocblas_int ldd, rocblas_int stride_d, rocblas_int batch_count)
+{
+    // check alignment of pointers before casting
+    if(!isAligned(a, sizeof(rocblas_bfloat16)) || !isAligned(b, sizeof(rocblas_bfloat16)) ||
+       !isAligned(c, sizeof(To)) || !isAligned(d, sizeof(To)))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    rocblas_int rows_a = trans_a == rocblas_operation_none ? m : k;
+    rocblas_int cols_a = trans_a == rocblas_operation_none ? k : m;
+    rocblas_int rows_b = trans_b == rocblas_operation_none ? k : n;
+    rocblas_int cols_b = trans_b == rocblas_operation_none ? n : k;
+
+    gemm_split_k_plan split = gemm_split_k_choose<float>(handle, m, n, k, batch_count);
+
+    // the batch is widened and run a chunk at a time (see gemm_batched.h)
+    size_t a_elems    = size_t(rows_a) * cols_a;
+    size_t b_elems    = size_t(rows_b) * cols_b;
+    size_t w_elems    = size_t(m) * n * split.slices();
+    rocblas_int chunk = gemm_batched_chunk((a_elems + b_elems + w_elems) * sizeof(float),
+                                           std::max({a_elems, b_elems, w_elems}), batch_count);
+    if(!chunk)
+        return rocblas_status_invalid_size;
+
+    // only report the workspace size while the handle is in a size query
+    size_t a_size = a_elems * chunk * sizeof(float);
+    size_t b_size = b_elems * chunk * sizeof(float);
+    size_t w_size = w_elems * chunk * sizeof(float);
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(a_size, b_size, w_size);
+
+    auto w_a = handle->device_malloc(a_size);
+    auto w_b = handle->device_malloc(b_size);
+    auto w   = handle->device_malloc(w_size);
+    if(!w_a || !w_b || !w)
+        return rocblas_status_memory_error;
+
+    float* W_A = static_cast<float*>(w_a.get());
+    float* W_B = static_cast<float*>(w_b.get());
+    float* W   = static_cast<float*>(w.get());
+
+    for(rocblas_int first = 0; first < batch_count; first += chunk)
+    {
+        rocblas_int count = std::min(chunk, batch_count - first);
+
+        RETURN_IF_HIP_ERROR(gemm_bf16_widen(handle, rows_a, cols_a, count,
+                                            static_cast<const rocblas_bfloat16*>(a) + size_t(stride_a) * first,
+                                            lda, stride_a, W_A));
+        RETURN_IF_HIP_ERROR(gemm_bf16_widen(handle, rows_b, cols_b, count,
+                                            static_cast<const rocblas_bfloat16*>(b) + size_t(stride_b) * first,
+                                            ldb, stride_b, W_B));
+        RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, W, w_elems * count * sizeof(float)));
+
+        rocblas_status status;
+        if(split.splits > 1)
+        {
+            status = gemm_ex_split_k_product<float,float,float>(handle, trans_a, trans_b, m, n, split,
+                                                                W_A, rows_a, W_B, rows_b, W);
+        }
+        else
+        {
+            status = gemm_ex_chunking<float,float,float>(handle, trans_a, trans_b,
+                                              static_cast<unsigned int>(m), static_cast<unsigned int>(n), static_cast<unsigned int>(k),
+                                              1.0f,
+                                              W_A, static_cast<unsigned int>(rows_a), static_cast<unsigned int>(a_elems),
+                                              W_B, static_cast<unsigned int>(rows_b), static_cast<unsigned int>(b_elems),
+                                              0.0f,
+                                              W, static_cast<unsigned int>(m), static_cast<unsigned int>(w_elems),
+                                              W, static_cast<unsigned int>(m), static_cast<unsigned int>(w_elems),
+                                              static_cast<unsigned int>(count));
+        }
+        if(status != rocblas_status_success)
+            return status;
+
+        RETURN_IF_HIP_ERROR(gemm_bf16_store(handle, m, n, count, split.slices(),
+                                            static_cast<const float*>(alpha), static_cast<const float*>(W),
+                                            static_cast<const float*>(beta),
+                                            static_cast<const To*>(c) + size_t(stride_c) * first, ldc, stride_c,
+                                            static_cast<To*>(d) + size_t(stride_d) * first, ldd, stride_d));
+    }
+    return rocblas_status_success;
+}
+
+// The product goes into W, split over k when gemm_split_k.h says so, and one
+// kernel finishes D from it with the epilogue (see gemm_epilogue.h). D is of
+// Td, which may be narrower than C.
+template <typename Ti, typename To, typename Tc, typename Td>
+rocblas_status gemm_ex_epilogue_typecasting(rocblas_handle handle,
+                                            rocblas_operation trans_a, rocblas_operation trans_b,
+                                            rocblas_int m, rocblas_int n, rocblas_int k, const void* alpha,
+                                            const void* a, rocblas_int lda,
+                                            const void* b, rocblas_int ldb, const void* beta,
+                                            const void* c, rocblas_int ldc,
+                                            void* d, rocblas_int ldd,
+                                            const rocblas_gemm_epilogue& epilogue)
+{
+    // check alignment of pointers before casting
+    if(!isAligned(a, sizeof(Ti)) || !isAligned(b, sizeof(Ti)) ||
+       !isAligned(c, sizeof(To)) || !isAligned(d, sizeof(Td)) ||
+       !isAligned(epilogue.bias, sizeof(To)) || !isAligned(epilogue.aux, sizeof(To)))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    gemm_split_k_plan split = gemm_split_k_choose<To>(handle, m, n, k, 1);
+
+    // only report the workspace size while the handle is in a size query
+    size_t w_size = gemm_split_k_workspace_size(m, n, split, sizeof(To));
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(w_size);
+
+    auto w = handle->device_malloc(w_size);
+    if(!w)
+        return rocblas_status_memory_error;
+    RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, w.get(), w_size));
+
+    // with k = 0 the product is the zeros of W
+    To* W = static_cast<To*>(w.get());
+    if(k > 0)
+    {
+        rocblas_status status = gemm_ex_split_k_product<Ti,To,Tc>(handle, trans_a, trans_b, m, n, split,
+                                                                  static_cast<const Ti*>(a), lda,
+                                                                  static_cast<const Ti*>(b), ldb, W);
+        if(status != rocblas_status_success)
+            return status;
+    }
+
+    gemm_epilogue_args<To> args = {epilogue.bias_mode, static_cast<const To*>(epilogue.bias),
+                                   epilogue.activation, static_cast<To*>(epilogue.aux), epilogue.ld_aux};
+
+    RETURN_IF_HIP_ERROR(gemm_epilogue_apply(handle, m, n, split.slices(),
+                                            static_cast<const Tc*>(alpha), static_cast<const To*>(W),
+                                            static_cast<const Tc*>(beta),
+                                            static_cast<const To*>(c), ldc,
+                                            static_cast<Td*>(d), ldd, args));
+    return rocblas_status_success;
+}
+
+// a, b, c and d are device arrays of matrix pointers: gather A and B into packed
+// slabs, run one strided batched Tensile launch, and scatter to D (see gemm_batched.h)
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_batched_ex_typecasting(rocblas_handle handle,
+                                           rocblas_operation trans_a, rocblas_operation trans_b,
+                                           rocblas_int m, rocblas_int n, rocblas_int k, const void* alpha,
+                                           const void* a, rocblas_int lda,
+                                           const void* b, rocblas_int ldb, const void* beta,
+                                           const void* c, rocblas_int ldc,
+                                           void* d, rocblas_int ldd, rocblas_int batch_count)
+{
+    // the matrices themselves are only known on the device
+    if(!isAligned(a, sizeof(Ti*)) || !isAligned(b, sizeof(Ti*)) ||
+       !isAligned(c, sizeof(To*)) || !isAligned(d, sizeof(To*)))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    // the batch runs a chunk at a time, reusing the workspace
+    rocblas_int chunk = gemm_batched_chunk<Ti,To>(m, n, k, batch_count);
+    if(!chunk)
+        return rocblas_status_invalid_size;
+
+    // only report the workspace size while the handle is in a size query
+    size_t w_size = gemm_batched_workspace_size<Ti,To>(m, n, k, chunk);
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(w_size);
+
+    auto w = handle->device_malloc(w_size);
+    if(!w)
+        return rocblas_status_memory_error;
+
+    rocblas_int rows_a = trans_a == rocblas_operation_none ? m : k;
+    rocblas_int cols_a = trans_a == rocblas_operation_none ? k : m;
+    rocblas_int rows_b = trans_b == rocblas_operation_none ? k : n;
+    rocblas_int cols_b = trans_b == rocblas_operation_none ? n : k;
+
+    To* W   = static_cast<To*>(w.get());
+    Ti* W_a = reinterpret_cast<Ti*>(W + size_t(m) * n * chunk);
+    Ti* W_b = W_a + size_t(m) * k * chunk;
+
+    for(rocblas_int first = 0; first < batch_count; first += chunk)
+    {
+        rocblas_int count = std::min(chunk, batch_count - first);
+
+        RETURN_IF_HIP_ERROR(gemm_batched_gather(handle, rows_a, cols_a, count,
+                                                static_cast<const Ti* const*>(a) + first, lda, W_a));
+        RETURN_IF_HIP_ERROR(gemm_batched_gather(handle, rows_b, cols_b, count,
+                                                static_cast<const Ti* const*>(b) + first, ldb, W_b));
+        RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, W, sizeof(To) * m * n * count));
+
+        rocblas_status status = gemm_ex_chunking<Ti,To,Tc>(handle,
+                                              trans_a,
+                                              trans_b,
+                                              static_cast<unsigned int>(m),
+                                              static_cast<unsigned int>(n),
+                                              static_cast<unsigned int>(k),
+                                              static_cast<Tc>(1),
+                                              W_a, static_cast<unsigned int>(rows_a), static_cast<unsigned int>(rows_a) * cols_a,
+                                              W_b, static_cast<unsigned int>(rows_b), static_cast<unsigned int>(rows_b) * cols_b,
+                                              static_cast<Tc>(0),
+                                              W, static_cast<unsigned int>(m), static_cast<unsigned int>(m) * n,
+                                              W, static_cast<unsigned int>(m), static_cast<unsigned int>(m) * n,
+                                              static_cast<unsigned int>(count));
+        if(status != rocblas_status_success)
+            return status;
+
+        RETURN_IF_HIP_ERROR(gemm_batched_scatter(handle, m, n, count,
+                                                 static_cast<const Tc*>(alpha), W,
+                                                 static_cast<const Tc*>(beta),
+                                                 static_cast<const To* const*>(c) + first, ldc,
+                                                 static_cast<To* const*>(d) + first, ldd));
+    }
+    return rocblas_status_success;
+}
+
+// a, b, c and d are device arrays of the matrix pointers of all the groups, in
+// group order; each bucket of groups runs as one Tensile launch (see gemm_grouped.h)
+template <typename Ti, typename To, typename Tc>
+rocblas_status gemm_grouped_ex_typecasting(rocblas_handle handle,
+                                           const rocblas_operation* trans_a, const rocblas_operation* trans_b,
+                                           const rocblas_int* m, const rocblas_int* n, const rocblas_int* k, const void* alpha,
+                                           const void* a, const rocblas_int* lda,
+                                           const void* b, const rocblas_int* ldb, const void* beta,
+                                           const void* c, const rocblas_int* ldc,
+                                           void* d, const rocblas_int* ldd,
+                                           rocblas_int group_count, const rocblas_int* group_size)
+{
+    // the matrices themselves are only known on the device
+    if(!isAligned(a, sizeof(Ti*)) || !isAligned(b, sizeof(Ti*)) ||
+       !isAligned(c, sizeof(To*)) || !isAligned(d, sizeof(To*)))
+    {
+        return rocblas_status_invalid_size;
+    }
+
+    std::vector<gemm_grouped_plan> plans =
+        gemm_grouped_buckets(group_count, trans_a, trans_b, m, n, k, group_size);
+
+    // the buckets run one after the other in the stream, each a chunk of its
+    // problems at a time, and share the workspace
+    std::vector<rocblas_int> chunks(plans.size());
+    size_t w_size = 0;
+    for(size_t i = 0; i < plans.size(); i++)
+    {
+        const gemm_grouped_plan& plan = plans[i];
+
+        chunks[i] = gemm_batched_chunk<Ti,To>(plan.m, plan.n, plan.k, plan.batch_count);
+        if(!chunks[i])
+            return rocblas_status_invalid_size;
+
+        w_size = std::max(w_size, gemm_batched_workspace_size<Ti,To>(plan.m, plan.n, plan.k, chunks[i]));
+    }
+
+    // only report the workspace size while the handle is in a size query
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(w_size);
+
+    auto w = handle->device_malloc(w_size);
+    if(!w)
+        return rocblas_status_memory_error;
+
+    // first problem of each group in the pointer arrays
+    std::vector<rocblas_int> index(group_count);
+    for(rocblas_int g = 0, i = 0; g < group_count; i += group_size[g++])
+        index[g] = i;
+
+    bool host_scalars = rocblas_pointer_mode_host == handle->pointer_mode;
+
+    for(size_t bucket_index = 0; bucket_index < plans.size(); bucket_index++)
+    {
+        const gemm_grouped_plan& plan = plans[bucket_index];
+        rocblas_int chunk             = chunks[bucket_index];
+
+        gemm_grouped_bucket<Tc> bucket;
+        bucket.count = plan.groups.size();
+
+        for(rocblas_int i = 0, first = 0; i < bucket.count; first += group_size[plan.groups[i++]])
+        {
+            rocblas_int g         = plan.groups[i];
+            gemm_grouped_group& p = bucket.group[i];
+
+            p.first   = first;
+            p.index   = index[g];
+            p.group   = g;
+            p.m       = m[g];
+            p.n       = n[g];
+            p.rows[0] = trans_a[g] == rocblas_operation_none ? m[g] : k[g];
+            p.cols[0] = trans_a[g] == rocblas_operation_none ? k[g] : m[g];
+            p.ld[0]   = lda[g];
+            p.rows[1] = trans_b[g] == rocblas_operation_none ? k[g] : n[g];
+            p.cols[1] = trans_b[g] == rocblas_operation_none ? n[g] : k[g];
+            p.ld[1]   = ldb[g];
+            p.ldc     = ldc[g];
+            p.ldd     = ldd[g];
+
+            if(host_scalars)
+            {
+                bucket.alpha[i] = static_cast<const Tc*>(alpha)[g];
+                bucket.beta[i]  = static_cast<const Tc*>(beta)[g];
+            }
+        }
+
+        rocblas_int rows_a = plan.trans_a == rocblas_operation_none ? plan.m : plan.k;
+        rocblas_int cols_a = plan.trans_a == rocblas_operation_none ? plan.k : plan.m;
+        rocblas_int rows_b = plan.trans_b == rocblas_operation_none ? plan.k : plan.n;
+        rocblas_int cols_b = plan.trans_b == rocblas_operation_none ? plan.n : plan.k;
+
+        To* W   = static_cast<To*>(w.get());
+        Ti* W_a = reinterpret_cast<Ti*>(W + size_t(plan.m) * plan.n * chunk);
+        Ti* W_b = W_a + size_t(plan.m) * plan.k * chunk;
+
+        for(rocblas_int first = 0; first < plan.batch_count; first += chunk)
+        {
+            rocblas_int count = std::min(chunk, plan.batch_count - first);
+            gemm_grouped_bucket<Tc> part = gemm_grouped_chunk(bucket, plan.batch_count, first, count);
+
+            RETURN_IF_HIP_ERROR(gemm_device_pointer_clear(handle, W,
+                                                          sizeof(To) * plan.m * plan.n * count));
+
+            // with k = 0 the product is 0 and only C is scaled
+            if(plan.k > 0)
+            {
+                RETURN_IF_HIP_ERROR(gemm_grouped_gather(handle, rows_a, cols_a, count, part, 0,
+                                                        static_cast<const Ti* const*>(a), W_a));
+                RETURN_IF_HIP_ERROR(gemm_grouped_gather(handle, rows_b, cols_b, count, part, 1,
+                                                        static_cast<const Ti* const*>(b), W_b));
+
+                rocblas_status status = gemm_ex_chunking<Ti,To,Tc>(handle,
+                                                      plan.trans_a,
+                                                      plan.trans_b,
+                                                      static_cast<unsigned int>(plan.m),
+                                                      static_cast<unsigned int>(plan.n),
+                                                      static_cast<unsigned int>(plan.k),
+                                                      static_cast<Tc>(1),
+                                                      W_a, static_cast<unsigned int>(rows_a), static_cast<unsigned int>(rows_a) * cols_a,
+                                                      W_b, static_cast<unsigned int>(rows_b), static_cast<unsigned int>(rows_b) * cols_b,
+                                                      static_cast<Tc>(0),
+                                                      W, static_cast<unsigned int>(plan.m), static_cast<unsigned int>(plan.m) * plan.n,
+                                                      W, static_cast<unsigned int>(plan.m), static_cast<unsigned int>(plan.m) * plan.n,
+                                                      static_cast<unsigned int>(count));
+                if(status != rocblas_status_success)
+                    return status;
+            }
+
+            RETURN_IF_HIP_ERROR(gemm_grouped_scatter(handle, plan.m, plan.n, count, part,
+                                                     static_cast<const Tc*>(alpha), W,
+                                                     static_cast<const Tc*>(beta),
+                                                     static_cast<const To* const*>(c),
+                                                     static_cast<To* const*>(d)));
+        }
+    }
+
+    return rocblas_status_success;
 }
 // clang-format on
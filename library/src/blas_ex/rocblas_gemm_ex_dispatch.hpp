@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCBLAS_GEMM_EX_DISPATCH_HPP
+#define ROCBLAS_GEMM_EX_DISPATCH_HPP
+#include <type_traits>
+#include "rocblas.h"
+#include "Tensile.h"
+
+/*******************************************************************************
+ * Datatype dispatch of the _ex routines
+ *
+ * gemm_ex_dispatch maps the datatypes of an _ex call to the input, output and
+ * compute types the routines are instantiated with, and calls
+ * f(gemm_ex_types<Ti, To, Tc>()). A routine passes a functor with a template
+ * operator() over gemm_ex_types, overloaded for the types it runs differently
+ * or not at all; a combination missing from the table is not implemented.
+ *
+ *   a, b     c, d     compute  Ti                To                Tc
+ *   f64_r    f64_r    f64_r    double            double            double
+ *   f32_r    f32_r    f32_r    float             float             float
+ *   f16_r    f16_r    f16_r    _Float16          _Float16          _Float16
+ *   f16_r    f16_r    f32_r    _Float16          _Float16          float
+ *   bf16_r   bf16_r   f32_r    rocblas_bfloat16  rocblas_bfloat16  float
+ *   bf16_r   f32_r    f32_r    rocblas_bfloat16  float             float
+ *   i8_r     i32_r    i32_r    TensileInt8x4     TensileInt32      TensileInt32
+ ******************************************************************************/
+template <typename Ti, typename To, typename Tc>
+struct gemm_ex_types
+{
+};
+
+template <typename F>
+rocblas_status gemm_ex_dispatch(rocblas_datatype a_type,
+                                rocblas_datatype b_type,
+                                rocblas_datatype c_type,
+                                rocblas_datatype d_type,
+                                rocblas_datatype compute_type,
+                                F&& f)
+{
+    if(a_type != b_type || c_type != d_type)
+        return rocblas_status_not_implemented;
+
+    if(a_type == rocblas_datatype_f64_r && c_type == rocblas_datatype_f64_r &&
+       compute_type == rocblas_datatype_f64_r)
+        return f(gemm_ex_types<double, double, double>());
+
+    if(a_type == rocblas_datatype_f32_r && c_type == rocblas_datatype_f32_r &&
+       compute_type == rocblas_datatype_f32_r)
+        return f(gemm_ex_types<float, float, float>());
+
+    if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r &&
+       compute_type == rocblas_datatype_f16_r)
+        return f(gemm_ex_types<_Float16, _Float16, _Float16>());
+
+    if(a_type == rocblas_datatype_f16_r && c_type == rocblas_datatype_f16_r &&
+       compute_type == rocblas_datatype_f32_r)
+        return f(gemm_ex_types<_Float16, _Float16, float>());
+
+    if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_bf16_r &&
+       compute_type == rocblas_datatype_f32_r)
+        return f(gemm_ex_types<rocblas_bfloat16, rocblas_bfloat16, float>());
+
+    if(a_type == rocblas_datatype_bf16_r && c_type == rocblas_datatype_f32_r &&
+       compute_type == rocblas_datatype_f32_r)
+        return f(gemm_ex_types<rocblas_bfloat16, float, float>());
+
+    if(a_type == rocblas_datatype_i8_r && c_type == rocblas_datatype_i32_r &&
+       compute_type == rocblas_datatype_i32_r)
+        return f(gemm_ex_types<TensileInt8x4, TensileInt32, TensileInt32>());
+
+    return rocblas_status_not_implemented;
+}
+
+/*******************************************************************************
+ * Tensile takes int8 A and B as TensileInt8x4, four consecutive elements along
+ * k, so k and the leading dimensions and strides that step along k must be
+ * multiples of 4, and are passed in units of 4. gemm_ex_pack_k converts them
+ * for Ti, leaving them as they are for the other types, and returns false when
+ * they are not multiples of 4.
+ ******************************************************************************/
+template <typename Ti, typename I>
+bool gemm_ex_pack_k(rocblas_operation trans_a,
+                    rocblas_operation trans_b,
+                    I& k,
+                    I& lda,
+                    I& ldb,
+                    I& stride_a,
+                    I& stride_b)
+{
+    const I pack = std::is_same<Ti, TensileInt8x4>{} ? 4 : 1;
+
+    if(k % pack != 0 || (trans_a != rocblas_operation_none && lda % pack != 0) ||
+       (trans_b == rocblas_operation_none && ldb % pack != 0) || stride_a % pack != 0 ||
+       stride_b % pack != 0)
+        return false;
+
+    lda = trans_a == rocblas_operation_none ? lda : lda / pack;
+    ldb = trans_b == rocblas_operation_none ? ldb / pack : ldb;
+    stride_a /= pack;
+    stride_b /= pack;
+    k /= pack;
+    return true;
+}
+
+// without strides, for the batched and epilogue routines
+template <typename Ti, typename I>
+bool gemm_ex_pack_k(rocblas_operation trans_a, rocblas_operation trans_b, I& k, I& lda, I& ldb)
+{
+    I stride_a = 0, stride_b = 0;
+    return gemm_ex_pack_k<Ti>(trans_a, trans_b, k, lda, ldb, stride_a, stride_b);
+}
+
+// k alone, for packed operands whose leading dimensions follow from k
+template <typename Ti, typename I>
+bool gemm_ex_pack_k(I& k)
+{
+    I ld = 0;
+    return gemm_ex_pack_k<Ti>(rocblas_operation_none, rocblas_operation_none, k, ld, ld);
+}
+
+#endif
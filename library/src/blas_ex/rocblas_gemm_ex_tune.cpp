@@ -0,0 +1,375 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <hip/hip_runtime.h>
+
+#include "rocblas.h"
+#include "Tensile.h"
+#include "TensileTypes.h"
+#include "definitions.h"
+#include "handle.h"
+#include "tensile_dispatch.h"
+#include "tensile_solution_cache.h"
+#include "rocblas_gemm_ex_dispatch.hpp"
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+/*******************************************************************************
+ * gemm solutions and autotuner
+ *
+ * rocblas_gemm_ex_get_solutions lists the compiled solutions of the device's
+ * Logic file that can run a problem, for the caller to pick one by index with
+ * rocblas_gemm_algo_solution_index, which calls it directly.
+ *
+ * rocblas_gemm_ex_tune runs the problem with each of them, and with the
+ * solution the library picks without tuning, on packed scratch operands of
+ * the handle; the fastest is used for the problem from then on and kept in
+ * the tuning cache of tensile_solution_cache.h, which later processes built
+ * with the same solutions load when they create a handle.
+ ******************************************************************************/
+namespace
+{
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status gemm_ex_get_solutions_template(rocblas_handle handle,
+                                                  rocblas_operation trans_a,
+                                                  rocblas_operation trans_b,
+                                                  unsigned int m,
+                                                  unsigned int n,
+                                                  unsigned int k,
+                                                  unsigned int batch_count,
+                                                  rocblas_gemm_solution* solutions,
+                                                  size_t* count)
+    {
+        const tensile_entry<Ti, To, Tc>& tensile =
+            tensile_dispatch<Ti, To, Tc>::get(GetTransposeMode(trans_a, trans_b));
+
+        std::vector<rocblas_gemm_solution> list;
+        RETURN_IF_ROCBLAS_ERROR(tensile_list_solutions(
+            tensile.problem_type(), handle->device, {{m, n, batch_count, k}}, list));
+
+        if(solutions)
+            std::copy_n(list.begin(), std::min(*count, list.size()), solutions);
+        *count = list.size();
+        return rocblas_status_success;
+    }
+
+    // launches per timing, after one launch to warm up
+    constexpr int gemm_tune_iterations = 10;
+
+    struct gemm_tune_events
+    {
+        hipEvent_t start = nullptr, stop = nullptr;
+        ~gemm_tune_events()
+        {
+            if(start)
+                hipEventDestroy(start);
+            if(stop)
+                hipEventDestroy(stop);
+        }
+    };
+
+    // mean milliseconds of launch() on the handle's stream
+    template <typename F>
+    rocblas_status gemm_tune_time(rocblas_handle handle, F launch, float& milliseconds)
+    {
+        gemm_tune_events events;
+        RETURN_IF_HIP_ERROR(hipEventCreate(&events.start));
+        RETURN_IF_HIP_ERROR(hipEventCreate(&events.stop));
+
+        if(launch() != tensileStatusSuccess)
+            return rocblas_status_internal_error;
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(events.start, handle->rocblas_stream));
+        for(int i = 0; i < gemm_tune_iterations; i++)
+            if(launch() != tensileStatusSuccess)
+                return rocblas_status_internal_error;
+        RETURN_IF_HIP_ERROR(hipEventRecord(events.stop, handle->rocblas_stream));
+        RETURN_IF_HIP_ERROR(hipEventSynchronize(events.stop));
+        RETURN_IF_HIP_ERROR(hipEventElapsedTime(&milliseconds, events.start, events.stop));
+
+        milliseconds /= gemm_tune_iterations;
+        return rocblas_status_success;
+    }
+
+    // the tuned solution of a problem is set aside while the problem is timed,
+    // and put back unless a new one is recorded
+    class gemm_tune_forget_scope
+    {
+        const char* problem_type;
+        int device;
+        tensile_logic_size size;
+        const tensile_table_solution* previous;
+        bool recorded = false;
+
+        public:
+        gemm_tune_forget_scope(const char* problem_type, int device, const tensile_logic_size& size)
+            : problem_type(problem_type),
+              device(device),
+              size(size),
+              previous(tensile_forget_tuned(problem_type, device, size))
+        {
+        }
+
+        ~gemm_tune_forget_scope()
+        {
+            if(!recorded)
+                tensile_restore_tuned(problem_type, device, size, previous);
+        }
+
+        gemm_tune_forget_scope(const gemm_tune_forget_scope&) = delete;
+        gemm_tune_forget_scope& operator=(const gemm_tune_forget_scope&) = delete;
+
+        rocblas_status record(int solution)
+        {
+            rocblas_status status = tensile_record_tuned(problem_type, device, size, solution);
+            recorded              = status == rocblas_status_success;
+            return status;
+        }
+    };
+
+    template <typename Ti, typename To, typename Tc>
+    rocblas_status gemm_ex_tune_template(rocblas_handle handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         unsigned int m,
+                                         unsigned int n,
+                                         unsigned int k,
+                                         unsigned int batch_count,
+                                         rocblas_int* solution_index)
+    {
+        const tensile_entry<Ti, To, Tc>& tensile =
+            tensile_dispatch<Ti, To, Tc>::get(GetTransposeMode(trans_a, trans_b));
+        const char* problem_type = tensile.problem_type();
+        tensile_logic_size size  = {{m, n, batch_count, k}};
+
+        std::vector<int> candidates = tensile_tuning_candidates(problem_type, handle->device, size);
+        if(candidates.empty())
+            return rocblas_status_not_implemented;
+
+        // packed operands: A is m x k or k x m, B is k x n or n x k
+        unsigned int lda = trans_a == rocblas_operation_none ? m : k;
+        unsigned int ldb = trans_b == rocblas_operation_none ? k : n;
+        size_t stride_a  = size_t(m) * k;
+        size_t stride_b  = size_t(k) * n;
+        size_t stride_c  = size_t(m) * n;
+
+        size_t a_size = sizeof(Ti) * stride_a * batch_count;
+        size_t b_size = sizeof(Ti) * stride_b * batch_count;
+        size_t c_size = sizeof(To) * stride_c * batch_count;
+        if(handle->is_device_memory_size_query())
+            return handle->set_optimal_device_memory_size(a_size, b_size, c_size);
+
+        if(stride_a * batch_count > UINT_MAX || stride_b * batch_count > UINT_MAX ||
+           stride_c * batch_count > UINT_MAX)
+            return rocblas_status_invalid_size;
+
+        auto a = handle->device_malloc(a_size);
+        auto b = handle->device_malloc(b_size);
+        auto c = handle->device_malloc(c_size);
+        if(!a || !b || !c)
+            return rocblas_status_memory_error;
+
+        // zeros time like any other data, without denormals or NaN
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(a.get(), 0, a_size, handle->rocblas_stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(b.get(), 0, b_size, handle->rocblas_stream));
+
+        const Ti* A = static_cast<const Ti*>(a.get());
+        const Ti* B = static_cast<const Ti*>(b.get());
+        To* C       = static_cast<To*>(c.get());
+        Tc alpha    = Tc(1);
+        Tc beta     = Tc(0);
+
+        // the pick without tuning is the one to beat
+        gemm_tune_forget_scope forget(problem_type, handle->device, size);
+
+        float best_ms = 0;
+        RETURN_IF_ROCBLAS_ERROR(gemm_tune_time(handle,
+                                               [&] {
+                                                   return tensile.call(C, A, B, alpha, beta,
+                                                                       m, stride_c,
+                                                                       lda, stride_a,
+                                                                       ldb, stride_b,
+                                                                       m, n, batch_count, k,
+                                                                       handle->device,
+                                                                       handle->rocblas_stream,
+                                                                       nullptr);
+                                               },
+                                               best_ms));
+
+        int best = -1;
+        for(int candidate : candidates)
+        {
+            const tensile_table_solution* solution = nullptr;
+            RETURN_IF_ROCBLAS_ERROR(
+                tensile_solution_at(problem_type, handle->device, candidate, size, solution));
+
+            float ms;
+            rocblas_status status =
+                gemm_tune_time(handle,
+                               [&] {
+                                   return tensile.call(C, A, B, alpha, beta,
+                                                       m, stride_c,
+                                                       lda, stride_a,
+                                                       ldb, stride_b,
+                                                       m, n, batch_count, k,
+                                                       handle->device,
+                                                       handle->rocblas_stream,
+                                                       solution);
+                               },
+                               ms);
+
+            // a solution that does not launch is not a candidate
+            if(status == rocblas_status_internal_error)
+                continue;
+            RETURN_IF_ROCBLAS_ERROR(status);
+
+            if(ms < best_ms)
+            {
+                best_ms = ms;
+                best    = candidate;
+            }
+        }
+
+        if(solution_index)
+            *solution_index = best;
+
+        return forget.record(best);
+    }
+
+    // gemm_ex_dispatch functors of the two routines; Tensile takes k in packs
+    // of 4 for int8, as rocblas_gemm_ex does, and has no bfloat16 solutions
+    struct gemm_ex_tune_functor
+    {
+        rocblas_handle handle;
+        rocblas_operation trans_a;
+        rocblas_operation trans_b;
+        rocblas_int m;
+        rocblas_int n;
+        rocblas_int k;
+        rocblas_int batch_count;
+        rocblas_int* solution_index;
+
+        template <typename Ti, typename To, typename Tc>
+        rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+        {
+            if(!gemm_ex_pack_k<Ti>(k))
+                return rocblas_status_invalid_size;
+            return gemm_ex_tune_template<Ti, To, Tc>(
+                handle, trans_a, trans_b, m, n, k, batch_count, solution_index);
+        }
+
+        template <typename To>
+        rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+        {
+            return rocblas_status_not_implemented;
+        }
+    };
+
+    struct gemm_ex_get_solutions_functor
+    {
+        rocblas_handle handle;
+        rocblas_operation trans_a;
+        rocblas_operation trans_b;
+        rocblas_int m;
+        rocblas_int n;
+        rocblas_int k;
+        rocblas_int batch_count;
+        rocblas_gemm_solution* solutions;
+        size_t* count;
+
+        template <typename Ti, typename To, typename Tc>
+        rocblas_status operator()(gemm_ex_types<Ti, To, Tc>)
+        {
+            if(!gemm_ex_pack_k<Ti>(k))
+                return rocblas_status_invalid_size;
+            return gemm_ex_get_solutions_template<Ti, To, Tc>(
+                handle, trans_a, trans_b, m, n, k, batch_count, solutions, count);
+        }
+
+        template <typename To>
+        rocblas_status operator()(gemm_ex_types<rocblas_bfloat16, To, float>)
+        {
+            return rocblas_status_not_implemented;
+        }
+    };
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    extensions BLAS
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocblas_gemm_ex_tune(rocblas_handle handle,
+                                               rocblas_operation trans_a,
+                                               rocblas_operation trans_b,
+                                               rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int k,
+                                               rocblas_int batch_count,
+                                               rocblas_datatype a_type,
+                                               rocblas_datatype c_type,
+                                               rocblas_datatype compute_type,
+                                               rocblas_int* solution_index)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    if(solution_index)
+        *solution_index = -1;
+
+    // quick return: nothing to tune
+    if(!m || !n || !k || !batch_count)
+        return rocblas_status_success;
+
+    return gemm_ex_dispatch(
+        a_type,
+        a_type,
+        c_type,
+        c_type,
+        compute_type,
+        gemm_ex_tune_functor{handle, trans_a, trans_b, m, n, k, batch_count, solution_index});
+}
+
+extern "C" rocblas_status rocblas_gemm_ex_get_solutions(rocblas_handle handle,
+                                                        rocblas_operation trans_a,
+                                                        rocblas_operation trans_b,
+                                                        rocblas_int m,
+                                                        rocblas_int n,
+                                                        rocblas_int k,
+                                                        rocblas_int batch_count,
+                                                        rocblas_datatype a_type,
+                                                        rocblas_datatype c_type,
+                                                        rocblas_datatype compute_type,
+                                                        rocblas_gemm_solution* solutions,
+                                                        size_t* count)
+{
+    if(nullptr == handle)
+        return rocblas_status_invalid_handle;
+
+    if(nullptr == count)
+        return rocblas_status_invalid_pointer;
+
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // quick return: no Tensile launch, so no solution to pick
+    if(!m || !n || !k || !batch_count)
+    {
+        *count = 0;
+        return rocblas_status_success;
+    }
+
+    return gemm_ex_dispatch(a_type,
+                            a_type,
+                            c_type,
+                            c_type,
+                            compute_type,
+                            gemm_ex_get_solutions_functor{
+                                handle, trans_a, trans_b, m, n, k, batch_count, solutions, count});
+}
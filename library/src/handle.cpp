@@ -7,6 +7,52 @@
 #include <unistd.h>
 #include <sys/param.h>
 #include "logging.h"
+#include <condition_variable>
+#include <map>
+#if BUILD_WITH_TENSILE
+#include "tensile_solution_cache.h"
+#endif
+
+/*******************************************************************************
+ * process-wide registry of device properties and log streams, so that
+ * creating a handle does not query the device or open files again
+ ******************************************************************************/
+static const hipDeviceProp_t* rocblas_device_properties(rocblas_int device)
+{
+    static std::mutex mutex;
+    static std::map<rocblas_int, hipDeviceProp_t> properties;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = properties.find(device);
+    if(it == properties.end())
+    {
+        hipDeviceProp_t prop;
+        THROW_IF_HIP_ERROR(hipGetDeviceProperties(&prop, device));
+        it = properties.emplace(device, prop).first;
+    }
+    return &it->second;
+}
+
+static std::shared_ptr<rocblas_log_stream>
+rocblas_open_log_stream(const char* environment_variable_name)
+{
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<rocblas_log_stream>> streams;
+
+    // streams are keyed by path; an empty path means std::cerr
+    const char* path = getenv(environment_variable_name);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = streams[path ? path : ""];
+    auto stream = entry.lock();
+    if(!stream)
+    {
+        stream = std::make_shared<rocblas_log_stream>();
+        open_log_stream(&stream->os, &stream->ofs, environment_variable_name);
+        entry = stream;
+    }
+    return stream;
+}
 
 /*******************************************************************************
  * constructor
@@ -15,7 +61,7 @@ _rocblas_handle::_rocblas_handle()
 {
     // default device is active device
     THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&device_properties, device));
+    device_properties = rocblas_device_properties(device);
 
     // rocblas by default take the system default stream 0 users cannot create
 
@@ -30,23 +76,78 @@ _rocblas_handle::_rocblas_handle()
         layer_mode = (rocblas_layer_mode)(atoi(str_layer_mode));
     }
 
-    // allocate trsm temp buffers
-    THROW_IF_HIP_ERROR(hipMalloc(&trsm_Y, WORKBUF_TRSM_Y_SZ));
-    THROW_IF_HIP_ERROR(hipMalloc(&trsm_invA, WORKBUF_TRSM_INVA_SZ));
-    THROW_IF_HIP_ERROR(hipMalloc(&trsm_invA_C, WORKBUF_TRSM_INVA_C_SZ));
-
     // open log file
     if(layer_mode & rocblas_layer_mode_log_trace)
     {
-        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCBLAS_LOG_TRACE_PATH");
-
-        *log_trace_os << "rocblas_create_handle\n";
+        log_trace = rocblas_open_log_stream("ROCBLAS_LOG_TRACE_PATH");
     }
 
     // open log_bench file
     if(layer_mode & rocblas_layer_mode_log_bench)
     {
-        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCBLAS_LOG_BENCH_PATH");
+        log_bench = rocblas_open_log_stream("ROCBLAS_LOG_BENCH_PATH");
+    }
+
+    // log records are formatted and written by the log writer thread
+    if(log_trace || log_bench)
+    {
+        log_ring = std::make_shared<rocblas_log_ring>(log_trace.get(), log_bench.get());
+        rocblas_log_sink_add(log_ring);
+    }
+
+    if(log_trace)
+    {
+        log_ring->push(rocblas_log_to_trace, ',', "rocblas_create_handle");
+    }
+
+    // open log_profile file
+    if(layer_mode & rocblas_layer_mode_log_profile)
+    {
+        log_profile   = rocblas_open_log_stream("ROCBLAS_LOG_PROFILE_PATH");
+        log_histogram = std::unique_ptr<rocblas_log_histogram>(new rocblas_log_histogram);
+    }
+
+    if(layer_mode & rocblas_layer_mode_log_timing)
+    {
+        call_timer = std::unique_ptr<rocblas_call_timer>(new rocblas_call_timer);
+    }
+
+    if(layer_mode & rocblas_layer_mode_log_solution)
+    {
+        solution_log = std::unique_ptr<rocblas_solution_log>(new rocblas_solution_log);
+    }
+
+#if BUILD_WITH_TENSILE
+    tensile_load_overrides_from_env(device);
+    tensile_load_tuning_cache(device);
+#endif
+
+    // open log_capture file; binary records are never written to std::cerr,
+    // so capture is off if the file cannot be opened
+    if((layer_mode & rocblas_layer_mode_log_capture) && getenv("ROCBLAS_LOG_CAPTURE_PATH"))
+    {
+        log_capture = rocblas_open_log_stream("ROCBLAS_LOG_CAPTURE_PATH");
+        if(!log_capture->ofs.is_open())
+        {
+            static std::once_flag warned;
+            std::call_once(warned, [] {
+                std::cerr << "rocblas warning: cannot open ROCBLAS_LOG_CAPTURE_PATH "
+                          << getenv("ROCBLAS_LOG_CAPTURE_PATH") << "; calls are not captured"
+                          << std::endl;
+            });
+            log_capture.reset();
+        }
+    }
+
+    if(log_capture)
+    {
+        std::lock_guard<std::mutex> lock(log_capture->mutex);
+        if(log_capture->os->tellp() == 0)
+        {
+            rocblas_capture_header header = {{'r', 'b', 'c', 'a', 'p', 't'},
+                                             sizeof(rocblas_capture_record)};
+            log_capture->os->write(reinterpret_cast<const char*>(&header), sizeof(header));
+        }
     }
 }
 
@@ -57,23 +158,37 @@ _rocblas_handle::~_rocblas_handle()
 {
     // rocblas by default take the system default stream which user cannot destroy
 
-    if(trsm_Y)
-        hipFree(trsm_Y);
-
-    if(trsm_invA)
-        hipFree(trsm_invA);
+    if(device_memory)
+        hipFree(device_memory);
 
-    if(trsm_invA_C)
-        hipFree(trsm_invA_C);
+    for(rocblas_int i = 0; i < side_stream_count; i++)
+        hipStreamDestroy(side_streams[i]);
+    for(hipEvent_t event : side_events)
+        if(event)
+            hipEventDestroy(event);
 
-    // Close log files
-    if(log_trace_ofs.is_open())
+    // write out everything this handle logged before its streams can be closed
+    if(log_ring)
     {
-        log_trace_ofs.close();
+        rocblas_log_sink_remove(log_ring);
+        log_ring->flush();
+        log_ring->close();
     }
-    if(log_bench_ofs.is_open())
+
+    write_log_profile();
+
+    // log files are closed when the last handle using them is destroyed
+}
+
+/*******************************************************************************
+ * write the profile histogram of this handle to ROCBLAS_LOG_PROFILE_PATH
+ ******************************************************************************/
+void _rocblas_handle::write_log_profile()
+{
+    if(log_histogram)
     {
-        log_bench_ofs.close();
+        std::lock_guard<std::mutex> lock(log_profile->mutex);
+        log_histogram->dump(*log_profile->os);
     }
 }
 
@@ -90,6 +205,12 @@ rocblas_status _rocblas_handle::set_stream(hipStream_t user_stream)
 {
 
     // TODO: check the user_stream valid or not
+
+    // work queued on the old stream may still be reading the device memory arena,
+    // which the next call on the new stream is free to overwrite
+    if(device_memory && user_stream != rocblas_stream)
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+
     rocblas_stream = user_stream;
     return rocblas_status_success;
 }
@@ -103,9 +224,324 @@ rocblas_status _rocblas_handle::get_stream(hipStream_t* stream) const
     return rocblas_status_success;
 }
 
-// trsm get pointers
-void* _rocblas_handle::get_trsm_Y() { return trsm_Y; }
+/*******************************************************************************
+ * trsm workspace shared by the handles of a device
+ ******************************************************************************/
+struct rocblas_trsm_workspace
+{
+    void* Y             = nullptr;
+    void* invA          = nullptr;
+    void* invA_C        = nullptr;
+    hipEvent_t last_use = nullptr; // completion of the previous lease's work
+
+    // held only to take or give back the lease, not while it is held
+    std::mutex mutex;
+    std::condition_variable released;
+    bool leased = false;
+
+    // on the current device
+    rocblas_status allocate()
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&Y, WORKBUF_TRSM_Y_SZ));
+        RETURN_IF_HIP_ERROR(hipMalloc(&invA, WORKBUF_TRSM_INVA_SZ));
+        RETURN_IF_HIP_ERROR(hipMalloc(&invA_C, WORKBUF_TRSM_INVA_C_SZ));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&last_use, hipEventDisableTiming));
+        return rocblas_status_success;
+    }
+
+    ~rocblas_trsm_workspace()
+    {
+        if(Y)
+            hipFree(Y);
+
+        if(invA)
+            hipFree(invA);
+
+        if(invA_C)
+            hipFree(invA_C);
+
+        if(last_use)
+            hipEventDestroy(last_use);
+    }
+};
+
+// the workspace of a device lives as long as one of its handles holds it
+static std::mutex trsm_workspaces_mutex;
+static std::map<rocblas_int, std::weak_ptr<rocblas_trsm_workspace>> trsm_workspaces;
+
+_rocblas_handle::trsm_workspace_lease _rocblas_handle::acquire_trsm_workspace()
+{
+    if(!trsm_workspace)
+    {
+        std::lock_guard<std::mutex> lock(trsm_workspaces_mutex);
+        auto workspace = trsm_workspaces[device].lock();
+        if(!workspace)
+        {
+            workspace = std::make_shared<rocblas_trsm_workspace>();
+
+            // the buffers belong to the handle's device, whichever is current
+            int current;
+            rocblas_status status = rocblas_status_memory_error;
+            if(hipGetDevice(&current) == hipSuccess)
+            {
+                if(hipSetDevice(device) == hipSuccess)
+                    status = workspace->allocate();
+                PRINT_IF_HIP_ERROR(hipSetDevice(current));
+            }
+
+            // an empty lease reports the allocation failure to the caller
+            if(status != rocblas_status_success)
+                return trsm_workspace_lease(nullptr, rocblas_stream);
+
+            trsm_workspaces[device] = workspace;
+        }
+        trsm_workspace = workspace;
+    }
+    return trsm_workspace_lease(trsm_workspace, rocblas_stream);
+}
+
+_rocblas_handle::trsm_workspace_lease::trsm_workspace_lease(
+    std::shared_ptr<rocblas_trsm_workspace> workspace, hipStream_t stream)
+    : workspace(std::move(workspace)), stream(stream)
+{
+    if(this->workspace)
+    {
+        std::unique_lock<std::mutex> lock(this->workspace->mutex);
+        this->workspace->released.wait(lock, [this] { return !this->workspace->leased; });
+        this->workspace->leased = true;
+        PRINT_IF_HIP_ERROR(hipStreamWaitEvent(stream, this->workspace->last_use, 0));
+    }
+}
+
+_rocblas_handle::trsm_workspace_lease::~trsm_workspace_lease()
+{
+    if(workspace)
+    {
+        {
+            std::lock_guard<std::mutex> lock(workspace->mutex);
+            PRINT_IF_HIP_ERROR(hipEventRecord(workspace->last_use, stream));
+            workspace->leased = false;
+        }
+        workspace->released.notify_one();
+    }
+}
+
+void* _rocblas_handle::trsm_workspace_lease::get_Y() const { return workspace->Y; }
+
+void* _rocblas_handle::trsm_workspace_lease::get_invA() const { return workspace->invA; }
+
+void* _rocblas_handle::trsm_workspace_lease::get_invA_C() const { return workspace->invA_C; }
+
+/*******************************************************************************
+ * side streams
+ ******************************************************************************/
+_rocblas_handle::stream_fork _rocblas_handle::fork_streams(rocblas_int count)
+{
+    stream_fork fork;
+    fork.handle = this;
+    fork.origin = rocblas_stream;
+    stream_forks++;
+
+    if(count > max_side_streams)
+        count = max_side_streams;
+
+    if(!side_events[max_side_streams] &&
+       hipEventCreateWithFlags(&side_events[max_side_streams], hipEventDisableTiming) != hipSuccess)
+    {
+        side_events[max_side_streams] = nullptr;
+        return fork;
+    }
+
+    // a stream that cannot be created leaves the fork with fewer streams
+    while(side_stream_count < count)
+    {
+        rocblas_int i = side_stream_count;
+        if(hipStreamCreateWithFlags(&side_streams[i], hipStreamNonBlocking) != hipSuccess)
+            break;
+        if(hipEventCreateWithFlags(&side_events[i], hipEventDisableTiming) != hipSuccess)
+        {
+            hipStreamDestroy(side_streams[i]);
+            side_events[i] = nullptr;
+            break;
+        }
+        side_stream_count++;
+    }
+    if(count > side_stream_count)
+        count = side_stream_count;
+
+    if(count && hipEventRecord(side_events[max_side_streams], rocblas_stream) == hipSuccess)
+    {
+        for(rocblas_int i = 0; i < count; i++)
+        {
+            if(hipStreamWaitEvent(side_streams[i], side_events[max_side_streams], 0) != hipSuccess)
+                break;
+            fork.count = i + 1;
+        }
+    }
+    return fork;
+}
+
+_rocblas_handle::stream_fork::stream_fork(stream_fork&& other) noexcept
+    : handle(other.handle), origin(other.origin), count(other.count)
+{
+    other.handle = nullptr;
+    other.count  = 0;
+}
+
+void _rocblas_handle::stream_fork::select(rocblas_int i)
+{
+    handle->rocblas_stream = handle->side_streams[i];
+}
+
+_rocblas_handle::stream_fork::~stream_fork()
+{
+    if(!handle)
+        return;
+
+    handle->stream_forks--;
+    handle->rocblas_stream = origin;
+    for(rocblas_int i = 0; i < count; i++)
+    {
+        PRINT_IF_HIP_ERROR(hipEventRecord(handle->side_events[i], handle->side_streams[i]));
+        PRINT_IF_HIP_ERROR(hipStreamWaitEvent(origin, handle->side_events[i], 0));
+    }
+}
+
+size_t _rocblas_handle::get_device_memory_size() const
+{
+    size_t size = device_memory_size;
+    if(trsm_workspace)
+        size += WORKBUF_TRSM_Y_SZ + WORKBUF_TRSM_INVA_SZ + WORKBUF_TRSM_INVA_C_SZ;
+    return size;
+}
+
+/*******************************************************************************
+ * device memory arena
+ ******************************************************************************/
+rocblas_status _rocblas_handle::device_memory_reserve(size_t size)
+{
+    if(size <= device_memory_size)
+        return rocblas_status_success;
+
+    // the arena can only be replaced while no scratch buffer points into it
+    if(device_memory_in_use)
+        return rocblas_status_internal_error;
+
+    if(device_memory)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(device_memory));
+        device_memory      = nullptr;
+        device_memory_size = 0;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc(&device_memory, size));
+    device_memory_size = size;
+    return rocblas_status_success;
+}
+
+_rocblas_handle::device_scratch _rocblas_handle::device_malloc(size_t size)
+{
+    device_scratch scratch;
+    if(!size)
+        return scratch;
+
+    size = device_memory_aligned_size(size);
+
+    size_t needed = device_memory_in_use + size;
+    if(needed > device_memory_high_water)
+        device_memory_high_water = needed;
+
+    // grow to the high water mark of previous calls while the arena is empty
+    if(!device_memory_in_use && !stream_forks)
+        device_memory_reserve(device_memory_high_water);
+
+    scratch.handle = this;
+    scratch.offset = device_memory_in_use;
+
+    // while streams are forked, space freed on one side stream could be handed to
+    // another before the first is done with it
+    if(needed <= device_memory_size && !stream_forks)
+    {
+        scratch.pointer      = static_cast<char*>(device_memory) + device_memory_in_use;
+        device_memory_in_use = needed;
+    }
+    else
+    {
+        // the arena is busy and too small, or streams are forked; fall back to a
+        // one-off allocation, the recorded high water mark lets the arena grow
+        // before the next call
+        scratch.fallback = true;
+        if(hipMalloc(&scratch.pointer, size) != hipSuccess)
+            scratch.pointer = nullptr;
+    }
+
+    return scratch;
+}
+
+_rocblas_handle::device_scratch::device_scratch(device_scratch&& other) noexcept
+    : handle(other.handle), pointer(other.pointer), offset(other.offset), fallback(other.fallback)
+{
+    other.handle  = nullptr;
+    other.pointer = nullptr;
+}
+
+_rocblas_handle::device_scratch& _rocblas_handle::device_scratch::
+operator=(device_scratch&& other) noexcept
+{
+    if(this != &other)
+    {
+        this->~device_scratch();
+        handle        = other.handle;
+        pointer       = other.pointer;
+        offset        = other.offset;
+        fallback      = other.fallback;
+        other.handle  = nullptr;
+        other.pointer = nullptr;
+    }
+    return *this;
+}
 
-void* _rocblas_handle::get_trsm_invA() { return trsm_invA; }
+_rocblas_handle::device_scratch::~device_scratch()
+{
+    if(!pointer)
+        return;
+
+    if(fallback)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(pointer));
+    }
+    else
+    {
+        handle->device_memory_in_use = offset;
+    }
+
+    pointer = nullptr;
+}
+
+rocblas_status _rocblas_handle::start_device_memory_size_query()
+{
+    if(device_memory_size_query)
+        return rocblas_status_internal_error;
 
-void* _rocblas_handle::get_trsm_invA_C() { return trsm_invA_C; }
+    device_memory_size_query = true;
+    device_memory_query_size = 0;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::stop_device_memory_size_query(size_t* size)
+{
+    if(!device_memory_size_query)
+        return rocblas_status_internal_error;
+
+    *size                    = device_memory_query_size;
+    device_memory_size_query = false;
+    return rocblas_status_success;
+}
+
+rocblas_status _rocblas_handle::set_device_memory_size(size_t size)
+{
+    size = device_memory_aligned_size(size);
+    if(size > device_memory_high_water)
+        device_memory_high_water = size;
+    return device_memory_reserve(size);
+}
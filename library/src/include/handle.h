@@ -6,9 +6,18 @@
 #ifndef HANDLE_H
 #define HANDLE_H
 #include <hip/hip_runtime_api.h>
+#include <cstddef>
 #include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
 
 #include "rocblas.h"
+#include "logging.h"
+#include "timing.h"
+
+// device buffers for trsm, allocated on first use and shared by the handles of a device
+struct rocblas_trsm_workspace;
 
 /*******************************************************************************
  * \brief rocblas_handle is a structure holding the rocblas library context.
@@ -25,12 +34,139 @@ struct _rocblas_handle
     rocblas_status set_stream(hipStream_t stream);
     rocblas_status get_stream(hipStream_t* stream) const;
 
-    void* get_trsm_Y();
-    void* get_trsm_invA();
-    void* get_trsm_invA_C();
+    /***************************************************************************
+     * The trsm work buffers are attached to the handle on first use and shared
+     * with every other handle on the same device. A lease serializes access:
+     * acquiring it waits for the previous lease to be released and makes the
+     * handle's stream wait for that lease's work on the buffers, and releasing
+     * it records this handle's work for the next. The workspace's mutex is
+     * held only while a lease is taken or given back.
+     **************************************************************************/
+    class trsm_workspace_lease
+    {
+        std::shared_ptr<rocblas_trsm_workspace> workspace;
+        hipStream_t stream = 0;
+
+        public:
+        trsm_workspace_lease(std::shared_ptr<rocblas_trsm_workspace> workspace,
+                             hipStream_t stream);
+        ~trsm_workspace_lease();
+
+        trsm_workspace_lease(trsm_workspace_lease&&) = default;
+
+        void* get_Y() const;
+        void* get_invA() const;
+        void* get_invA_C() const;
+        explicit operator bool() const { return workspace != nullptr; }
+    };
+
+    trsm_workspace_lease acquire_trsm_workspace();
+
+    // device memory reserved by the handle, including shared trsm buffers once attached
+    size_t get_device_memory_size() const;
+
+    /***************************************************************************
+     * Device memory arena
+     *
+     * Each handle owns one grow-only block of device memory. API routines draw
+     * their scratch buffers from it with device_malloc(); allocations are
+     * released in LIFO order when the returned objects go out of scope, so
+     * every API call starts and ends with an empty arena. The arena grows to
+     * the high water mark of previous calls only while it is empty, so after
+     * the first few calls (or after rocblas_set_device_memory_size) no
+     * hipMalloc or hipFree happens in the steady state.
+     **************************************************************************/
+    class device_scratch
+    {
+        _rocblas_handle* handle = nullptr;
+        void* pointer           = nullptr;
+        size_t offset           = 0; // arena offset to restore on release
+        bool fallback           = false; // individually hipMalloc'd
+
+        friend struct _rocblas_handle;
+
+        public:
+        device_scratch() = default;
+        device_scratch(device_scratch&& other) noexcept;
+        device_scratch& operator=(device_scratch&& other) noexcept;
+        ~device_scratch();
+
+        device_scratch(const device_scratch&) = delete;
+        device_scratch& operator=(const device_scratch&) = delete;
+
+        void* get() const { return pointer; }
+        explicit operator bool() const { return pointer != nullptr; }
+    };
+
+    // allocate size bytes of scratch memory; a size of 0 yields a null pointer.
+    // While streams are forked the buffer is a one-off allocation instead, as
+    // the arena space it frees could be reused by another side stream
+    device_scratch device_malloc(size_t size);
+
+    // true while the handle is between rocblas_start/stop_device_memory_size_query
+    bool is_device_memory_size_query() const { return device_memory_size_query; }
+
+    // record the scratch sizes a routine would request with device_malloc
+    template <typename... Ss>
+    rocblas_status set_optimal_device_memory_size(Ss... sizes)
+    {
+        size_t total = 0;
+        for(size_t size : {size_t(sizes)...})
+            total += device_memory_aligned_size(size);
+        if(total > device_memory_query_size)
+            device_memory_query_size = total;
+        return rocblas_status_success;
+    }
+
+    /***************************************************************************
+     * Side streams
+     *
+     * A routine whose work splits into independent launches can fork the
+     * handle's stream: fork_streams(count) makes up to count side streams wait
+     * for the work queued so far, and select(i) sends what is queued next on
+     * the handle to side stream i. When the fork goes out of scope the handle's
+     * stream is restored and waits for everything queued on the side streams,
+     * so to the caller the routine still runs in order on its stream. The side
+     * streams and their events are created on first use and kept by the handle.
+     *
+     * select() switches streams without rocblas_set_stream's synchronization:
+     * scratch allocated before the fork is ordered by the fork and the join, and
+     * device_malloc does not hand out arena space while streams are forked.
+     **************************************************************************/
+    class stream_fork
+    {
+        _rocblas_handle* handle = nullptr;
+        hipStream_t origin      = 0;
+        rocblas_int count       = 0;
+
+        friend struct _rocblas_handle;
+
+        public:
+        stream_fork() = default;
+        stream_fork(stream_fork&& other) noexcept;
+        ~stream_fork();
+
+        stream_fork(const stream_fork&) = delete;
+        stream_fork& operator=(const stream_fork&) = delete;
+        stream_fork& operator=(stream_fork&&) = delete;
+
+        // number of side streams; 0 if none could be created
+        rocblas_int size() const { return count; }
+        void select(rocblas_int i);
+    };
+
+    static constexpr rocblas_int max_side_streams = 4;
+
+    stream_fork fork_streams(rocblas_int count);
+
+    rocblas_status start_device_memory_size_query();
+    rocblas_status stop_device_memory_size_query(size_t* size);
+    rocblas_status set_device_memory_size(size_t size);
 
     rocblas_int device;
-    hipDeviceProp_t device_properties;
+
+    // cached once per process for each device
+    const hipDeviceProp_t* device_properties;
 
     // rocblas by default take the system default stream 0 users cannot create
     hipStream_t rocblas_stream = 0;
@@ -38,18 +174,68 @@ struct _rocblas_handle
     // default pointer_mode is on host
     rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
 
+    // default complex gemm uses four real products
+    rocblas_complex_gemm_mode complex_gemm_mode = rocblas_complex_gemm_mode_4m;
+
     // default logging_mode is no logging
     rocblas_layer_mode layer_mode;
 
-    // space allocated for trsm
-    void* trsm_Y      = nullptr;
-    void* trsm_invA   = nullptr;
-    void* trsm_invA_C = nullptr;
+    // trsm work buffers, attached by the first trsm call on this handle
+    std::shared_ptr<rocblas_trsm_workspace> trsm_workspace;
+
+    // opened once per destination and kept open while a handle holds them
+    std::shared_ptr<rocblas_log_stream> log_trace;
+    std::shared_ptr<rocblas_log_stream> log_bench;
+
+    // records queued by log_trace and log_bench for the log writer thread
+    std::shared_ptr<rocblas_log_ring> log_ring;
+
+    // number of log records dropped because the ring was full
+    size_t get_dropped_log_count() const { return log_ring ? log_ring->get_dropped() : 0; }
+
+    // call counts for rocblas_layer_mode_log_profile, written to log_profile
+    std::shared_ptr<rocblas_log_stream> log_profile;
+    std::unique_ptr<rocblas_log_histogram> log_histogram;
+
+    // write the profile accumulated so far and start a new one
+    void write_log_profile();
+
+    // binary call records for rocblas_layer_mode_log_capture
+    std::shared_ptr<rocblas_log_stream> log_capture;
+
+    // GPU time per routine and shape for rocblas_layer_mode_log_timing
+    std::unique_ptr<rocblas_call_timer> call_timer;
+
+    // Tensile solution per gemm problem for rocblas_layer_mode_log_solution
+    std::unique_ptr<rocblas_solution_log> solution_log;
+
+    // solution of the Logic file the Tensile launches of the gemm_ex call in
+    // progress run, set by rocblas_gemm_algo_solution_index; -1 otherwise
+    rocblas_int gemm_solution_index = -1;
+
+    private:
+    static constexpr size_t device_memory_alignment = 256;
+
+    static size_t device_memory_aligned_size(size_t size)
+    {
+        return (size + device_memory_alignment - 1) / device_memory_alignment *
+               device_memory_alignment;
+    }
+
+    rocblas_status device_memory_reserve(size_t size);
+
+    // created by fork_streams on first use; side_events[max_side_streams] is the fork point
+    hipStream_t side_streams[max_side_streams]    = {};
+    hipEvent_t side_events[max_side_streams + 1]  = {};
+    rocblas_int side_stream_count                 = 0;
+    rocblas_int stream_forks                      = 0; // live stream_fork objects
 
-    std::ofstream log_trace_ofs;
-    std::ofstream log_bench_ofs;
-    std::ostream* log_trace_os;
-    std::ostream* log_bench_os;
+    void* device_memory             = nullptr;
+    size_t device_memory_size       = 0;
+    size_t device_memory_in_use     = 0;
+    size_t device_memory_high_water = 0;
+    size_t device_memory_query_size = 0;
+    bool device_memory_size_query   = false;
 };
 
 // work buffer size constants
@@ -5,11 +5,20 @@
 #pragma once
 #ifndef LOGGING_H
 #define LOGGING_H
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include <unistd.h>
 #include <sys/param.h>
+#include "rocblas.h"
 
 /**
  *  @brief Logging function
@@ -106,7 +115,7 @@ void each_args(F)
  */
 struct log_arg
 {
-    log_arg(std::ostream& os, std::string& separator) : os_(os), separator_(separator) {}
+    log_arg(std::ostream& os, const char* separator) : os_(os), separator_(separator) {}
 
     /// Generic overload for () operator.
     template <typename T>
@@ -128,8 +137,8 @@ struct log_arg
     }
 
     private:
-    std::ostream& os_;       ///< Output stream.
-    std::string& separator_; ///< Separator: output preceding argument.
+    std::ostream& os_;      ///< Output stream.
+    const char* separator_; ///< Separator: output preceding argument.
 };
 
 /**
@@ -144,7 +153,7 @@ struct log_arg
  *                 Open output stream file.
  *
  * @param[in]
- * separator       std::string
+ * separator       const char*
  *                 Separator to print between arguments.
  *
  * @param[in]
@@ -158,7 +167,7 @@ struct log_arg
  *                 separator.
  */
 template <typename H, typename... Ts>
-void log_arguments(std::ostream& os, std::string& separator, H head, Ts&... xs)
+void log_arguments(std::ostream& os, const char* separator, H head, Ts&... xs)
 {
     os << head;
     each_args(log_arg{os, separator}, xs...);
@@ -177,7 +186,7 @@ void log_arguments(std::ostream& os, std::string& separator, H head, Ts&... xs)
  *                 open output stream file.
  *
  * @param[in]
- * separator       std::string
+ * separator       const char*
  *                 Not used.
  *
  * @param[in]
@@ -185,7 +194,7 @@ void log_arguments(std::ostream& os, std::string& separator, H head, Ts&... xs)
  *                 Argument to log. It is preceded by newline.
  */
 template <typename H>
-void log_argument(std::ostream& os, std::string& separator, H head)
+void log_argument(std::ostream& os, const char* separator, H head)
 {
     os << head << "\n";
 }
@@ -211,4 +220,343 @@ void log_argument(std::ostream& os, H head)
     os << head << "\n";
 }
 
+// return s, d, c, z or h depending on typename T, X for any other type
+template <typename T>
+constexpr char rocblas_precision_letter()
+{
+    return std::is_same<T, float>::value
+               ? 's'
+               : std::is_same<T, double>::value
+                     ? 'd'
+                     : std::is_same<T, rocblas_float_complex>::value
+                           ? 'c'
+                           : std::is_same<T, rocblas_double_complex>::value
+                                 ? 'z'
+                                 : std::is_same<T, rocblas_half>::value ? 'h' : 'X';
+}
+
+// replaces X in string with s, d, c, z or h depending on typename T
+// the replacement happens while streaming, so no string is built unless logged
+template <typename T>
+struct replaceX
+{
+    const char* input_string;
+
+    replaceX(const char* input_string) : input_string(input_string) {}
+
+    friend std::ostream& operator<<(std::ostream& os, const replaceX& x)
+    {
+        for(const char* c = x.input_string; *c; ++c)
+            os.put(*c == 'X' ? rocblas_precision_letter<T>() : *c);
+        return os;
+    }
+};
+
+/**
+ * @brief Log output shared by all handles that write to the same destination
+ */
+struct rocblas_log_stream
+{
+    std::ofstream ofs;
+    std::ostream* os = &std::cerr;
+    std::mutex mutex; ///< Serializes batches written by different handles.
+};
+
+/**
+ * @brief Destination of a log record
+ */
+enum rocblas_log_destination : uint8_t
+{
+    rocblas_log_to_trace,
+    rocblas_log_to_bench
+};
+
+/**
+ * @brief One 16 byte slot of a log record
+ *
+ * @details
+ * A record is a header slot followed by one slot per logged value. Values are
+ * stored in binary and only formatted by the log writer thread. Strings are
+ * stored by pointer, so they must be literals or otherwise outlive the handle.
+ */
+struct rocblas_log_slot
+{
+    enum type_t : uint8_t
+    {
+        header,
+        i64,
+        u64,
+        f64,
+        ptr,
+        chr,
+        str,
+        str_x ///< String with X replaced by the precision letter in c.
+    };
+
+    union
+    {
+        int64_t i;
+        uint64_t u;
+        double f;
+        const void* p;
+        const char* s;
+        uint32_t count; ///< header: number of value slots that follow
+    };
+    type_t type;
+    char c;       ///< header: separator; chr: the value; str_x: precision letter
+    uint8_t dest; ///< header: rocblas_log_destination
+};
+
+/**
+ * @brief Wake the log writer thread before its next periodic flush
+ */
+void rocblas_log_sink_notify();
+
+/**
+ * @brief Per-handle ring buffer of log records
+ *
+ * @details
+ * The thread calling rocblas routines with a handle is the single producer
+ * and the log writer thread is the single consumer, so pushing a record is a
+ * few stores and one release store of the head index. A record that does not
+ * fit is dropped and counted instead of blocking the caller.
+ */
+class rocblas_log_ring
+{
+    public:
+    rocblas_log_ring(rocblas_log_stream* trace, rocblas_log_stream* bench)
+        : trace_(trace), bench_(bench)
+    {
+    }
+
+    template <typename H, typename... Ts>
+    void push(rocblas_log_destination dest, char separator, H& head, Ts&... xs)
+    {
+        size_t count = 1 + slot_count(xs...);
+        size_t head_ = this->head.load(std::memory_order_relaxed);
+        size_t used  = head_ - tail.load(std::memory_order_acquire);
+        if(count + 1 > capacity - used)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        rocblas_log_slot& h = slot(head_);
+        h.type              = rocblas_log_slot::header;
+        h.count             = uint32_t(count);
+        h.c                 = separator;
+        h.dest              = dest;
+
+        size_t pos = head_ + 1;
+        put(pos, head);
+        each_args(slot_writer{*this, pos}, xs...);
+        this->head.store(pos, std::memory_order_release);
+
+        // wake the writer early when a burst fills half of the ring
+        if(used < capacity / 2 && used + count + 1 >= capacity / 2)
+            rocblas_log_sink_notify();
+    }
+
+    /// Format and write all queued records. Called by the writer thread, and by
+    /// the owning handle to drain the ring before it is destroyed.
+    void flush();
+
+    /// Stop writing; later flushes only discard records.
+    void close();
+
+    size_t get_dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+    private:
+    static constexpr size_t capacity = 1 << 14; // slots, a power of 2
+
+    rocblas_log_slot slots[capacity];
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    std::atomic<size_t> dropped{0};
+
+    std::mutex consumer_mutex;
+    rocblas_log_stream* trace_;
+    rocblas_log_stream* bench_;
+
+    rocblas_log_slot& slot(size_t pos) { return slots[pos & (capacity - 1)]; }
+
+    // functor passed to each_args to store every value after the head
+    struct slot_writer
+    {
+        rocblas_log_ring& ring;
+        size_t& pos;
+
+        template <typename T>
+        void operator()(const T& x) const
+        {
+            ring.put(pos, x);
+        }
+    };
+
+    // number of slots needed by the values; complex numbers take two
+    static constexpr size_t slot_count() { return 0; }
+
+    template <typename T, typename... Ts>
+    static constexpr size_t slot_count(const T&, const Ts&... xs)
+    {
+        return (std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{}
+                    ? 2
+                    : 1) +
+               slot_count(xs...);
+    }
+
+    rocblas_log_slot& put(size_t& pos, rocblas_log_slot::type_t type)
+    {
+        rocblas_log_slot& s = slot(pos++);
+        s.type              = type;
+        return s;
+    }
+
+    void put(size_t& pos, char x) { put(pos, rocblas_log_slot::chr).c = x; }
+    void put(size_t& pos, float x) { put(pos, rocblas_log_slot::f64).f = x; }
+    void put(size_t& pos, double x) { put(pos, rocblas_log_slot::f64).f = x; }
+    void put(size_t& pos, const char* x) { put(pos, rocblas_log_slot::str).s = x; }
+    void put(size_t& pos, char* x) { put(pos, rocblas_log_slot::str).s = x; }
+
+    template <typename T,
+              typename std::enable_if<(std::is_integral<T>{} && std::is_signed<T>{})
+                                          || std::is_enum<T>{},
+                                      int>::type = 0>
+    void put(size_t& pos, T x)
+    {
+        put(pos, rocblas_log_slot::i64).i = x;
+    }
+
+    template <typename T,
+              typename std::enable_if<std::is_integral<T>{} && std::is_unsigned<T>{}, int>::type
+              = 0>
+    void put(size_t& pos, T x)
+    {
+        put(pos, rocblas_log_slot::u64).u = x;
+    }
+
+    template <typename T>
+    void put(size_t& pos, T* x)
+    {
+        put(pos, rocblas_log_slot::ptr).p = x;
+    }
+
+    void put(size_t& pos, const rocblas_float_complex& x)
+    {
+        put(pos, x.x);
+        put(pos, x.y);
+    }
+
+    void put(size_t& pos, const rocblas_double_complex& x)
+    {
+        put(pos, x.x);
+        put(pos, x.y);
+    }
+
+    template <typename T>
+    void put(size_t& pos, const replaceX<T>& x)
+    {
+        rocblas_log_slot& s = put(pos, rocblas_log_slot::str_x);
+        s.s                 = x.input_string;
+        s.c                 = rocblas_precision_letter<T>();
+    }
+};
+
+/**
+ * @brief Write argument name, value pairs as YAML flow mapping entries, each
+ *        preceded by ", ". Strings are quoted so that letters such as N and Y
+ *        are not read as booleans.
+ */
+inline void log_yaml_value(std::ostream& os, const char* x) { os << '"' << x << '"'; }
+
+template <typename T>
+void log_yaml_value(std::ostream& os, const replaceX<T>& x)
+{
+    os << '"' << x << '"';
+}
+
+template <typename T, typename std::enable_if<std::is_arithmetic<T>{}, int>::type = 0>
+void log_yaml_value(std::ostream& os, T x)
+{
+    os << x;
+}
+
+inline void log_yaml_pairs(std::ostream&) {}
+
+template <typename V, typename... Ts>
+void log_yaml_pairs(std::ostream& os, const char* name, const V& value, const Ts&... xs)
+{
+    os << ", " << name << ": ";
+    log_yaml_value(os, value);
+    log_yaml_pairs(os, xs...);
+}
+
+/**
+ * @brief Call counts per distinct set of profiled arguments, accumulated for
+ *        rocblas_layer_mode_log_profile and written as YAML.
+ */
+class rocblas_log_histogram
+{
+    public:
+    /// Count one call of the routine head; xs alternate between the names and
+    /// the values of the arguments that tell calls apart.
+    template <typename H, typename... Ts>
+    void record(const H& head, const Ts&... xs)
+    {
+        std::ostringstream key;
+        key << "rocblas_function: ";
+        log_yaml_value(key, head);
+        log_yaml_pairs(key, xs...);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        ++counts[key.str()];
+    }
+
+    /// Write one YAML line per distinct call, most frequent first, then reset
+    /// the counts.
+    void dump(std::ostream& os);
+
+    private:
+    std::mutex mutex;
+    std::map<std::string, size_t> counts;
+};
+
+/**
+ * @brief Tensile solution picked per gemm problem and its hit count,
+ *        accumulated for rocblas_layer_mode_log_solution.
+ */
+class rocblas_solution_log
+{
+    public:
+    /// Count one call of the Tensile problem type (e.g. Cijk_Ailk_Bljk) and
+    /// precision (e.g. SB) with the given sizes I, J, K, L and strides C1, C2,
+    /// A1, A2, B1, B2, which was served by the named solution.
+    void record(const char* problem_type,
+                const char* precision,
+                const unsigned int (&sizes)[4],
+                const unsigned int (&strides)[6],
+                const char* solution);
+
+    /// On entry *count is the capacity of selections, on exit the number of
+    /// problems seen; with selections == nullptr only the number is returned.
+    void get_selections(rocblas_solution_selection* selections, size_t* count);
+
+    /// Tensile names a solution after its parameters, and the Logic files
+    /// fall back to HIP source kernels (KernelLanguage Source, "_KLS" in the
+    /// name) for problems the tuned assembly kernels do not cover.
+    static bool is_fallback(const char* solution);
+
+    private:
+    std::mutex mutex;
+    std::map<std::string, size_t> index;
+    std::vector<rocblas_solution_selection> selections;
+};
+
+/**
+ * @brief Register a ring with the process-wide log writer thread, which
+ *        flushes it in the background until it is unregistered.
+ */
+void rocblas_log_sink_add(const std::shared_ptr<rocblas_log_ring>& ring);
+void rocblas_log_sink_remove(const std::shared_ptr<rocblas_log_ring>& ring);
+
 #endif
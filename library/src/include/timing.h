@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <hip/hip_runtime_api.h>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "rocblas.h"
+
+/*******************************************************************************
+ * Floating point operation counts of the timed routines, the same as the
+ * client's flops.h, which has no count for nrm2 and asum; complex routines do
+ * four times the real work
+ ******************************************************************************/
+template <typename T>
+constexpr double rocblas_flop_factor()
+{
+    return std::is_same<T, rocblas_float_complex>{} || std::is_same<T, rocblas_double_complex>{}
+               ? 4.0
+               : 1.0;
+}
+
+template <typename T>
+constexpr double rocblas_scal_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * n;
+}
+
+template <typename T>
+constexpr double rocblas_axpy_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 2.0 * n;
+}
+
+template <typename T>
+constexpr double rocblas_dot_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 2.0 * n;
+}
+
+template <typename T>
+constexpr double rocblas_nrm2_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 2.0 * n;
+}
+
+template <typename T>
+constexpr double rocblas_asum_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * n;
+}
+
+template <typename T>
+constexpr double rocblas_ger_flop_count(rocblas_int m, rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 2.0 * m * n;
+}
+
+template <typename T>
+constexpr double rocblas_syr_flop_count(rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * n * (n + 1.0);
+}
+
+template <typename T>
+constexpr double rocblas_geam_flop_count(rocblas_int m, rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 3.0 * m * n;
+}
+
+template <typename T>
+constexpr double rocblas_gemv_flop_count(rocblas_int m, rocblas_int n)
+{
+    return rocblas_flop_factor<T>() * 2.0 * m * n;
+}
+
+template <typename T>
+constexpr double rocblas_gemm_flop_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return rocblas_flop_factor<T>() * 2.0 * m * n * k;
+}
+
+template <typename T>
+constexpr double rocblas_trsm_flop_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return rocblas_flop_factor<T>() * m * n * (k + 1.0);
+}
+
+/*******************************************************************************
+ * GPU time of the calls made on a handle, for rocblas_layer_mode_log_timing.
+ * Each call records a pair of events around its work on the handle's stream;
+ * the elapsed times are collected later, from events that have completed by
+ * the time of the next call or of a query, so calls never wait for the GPU.
+ ******************************************************************************/
+class rocblas_call_timer
+{
+    public:
+    rocblas_call_timer() = default;
+    ~rocblas_call_timer();
+
+    rocblas_call_timer(const rocblas_call_timer&) = delete;
+    rocblas_call_timer& operator=(const rocblas_call_timer&) = delete;
+
+    // times one call from construction to destruction; calls made by the
+    // timed routine itself are part of its time and are not timed separately
+    class scope
+    {
+        rocblas_call_timer* timer;
+        hipStream_t stream;
+
+        public:
+        scope() : timer(nullptr), stream(0) {}
+        scope(rocblas_call_timer* timer,
+              hipStream_t stream,
+              std::string function,
+              std::string shape,
+              double flops);
+        ~scope();
+
+        scope(scope&& other) : timer(other.timer), stream(other.stream)
+        {
+            other.timer = nullptr;
+        }
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+    };
+
+    // copy up to *count aggregated timings to timings and set *count to the
+    // number of entries; with timings == nullptr only *count is set
+    void get_timings(rocblas_call_timing* timings, size_t* count);
+
+    private:
+    struct entry
+    {
+        std::string function;
+        std::string shape;
+        uint64_t calls      = 0;
+        double milliseconds = 0;
+        double flops        = 0;
+    };
+
+    struct pending_call
+    {
+        size_t entry;
+        double flops;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    std::mutex mutex;
+    int depth = 0;
+    pending_call current;
+    std::deque<pending_call> pending;
+    std::vector<hipEvent_t> free_events;
+    std::vector<entry> entries;
+    std::map<std::pair<std::string, std::string>, size_t> entry_index;
+
+    hipEvent_t get_event();
+    void collect(bool wait);
+    void start(hipStream_t stream, std::string function, std::string shape, double flops);
+    void stop(hipStream_t stream);
+};
+
+#endif
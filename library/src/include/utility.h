@@ -5,14 +5,22 @@
 #pragma once
 #ifndef UTILITY_H
 #define UTILITY_H
+#include <algorithm>
 #include <fstream>
-#include <string>
+#include <type_traits>
+#include "handle.h"
+#include "logging.h"
+
+// Logging is designed to cost nothing but a branch on handle->layer_mode when
+// the layer is off: routine names, precision and enum letters are passed as
+// string literals or trivially copyable wrappers, and are only formatted once
+// the layer bit is known to be set.
 
 // if trace logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_trace) == true
 // then
-// log_function will call log_arguments to log function
-// arguments with a comma separator
+// log_function will queue the function arguments for the log writer,
+// which logs them with a comma separator
 template <typename H, typename... Ts>
 // void log_function(rocblas_handle handle, H head, Ts&... xs)
 void log_trace(rocblas_handle handle, H head, Ts&... xs)
@@ -21,10 +29,7 @@ void log_trace(rocblas_handle handle, H head, Ts&... xs)
     {
         if(handle->layer_mode & rocblas_layer_mode_log_trace)
         {
-            std::string comma_separator = ",";
-
-            std::ostream* os = handle->log_trace_os;
-            log_arguments(*os, comma_separator, head, xs...);
+            handle->log_ring->push(rocblas_log_to_trace, ',', head, xs...);
         }
     }
 }
@@ -32,57 +37,145 @@ void log_trace(rocblas_handle handle, H head, Ts&... xs)
 // if bench logging is turned on with
 // (handle->layer_mode & rocblas_layer_mode_log_bench) == true
 // then
-// log_bench will call log_arguments to log a string that
-// can be input to the executable rocblas-bench.
-template <typename H, typename... Ts>
-void log_bench(rocblas_handle handle, H head, std::string precision, Ts&... xs)
+// log_bench will queue a string that can be input to the
+// executable rocblas-bench, with a space separator
+template <typename H, typename P, typename... Ts>
+void log_bench(rocblas_handle handle, H head, P precision, Ts&... xs)
 {
     if(nullptr != handle)
     {
         if(handle->layer_mode & rocblas_layer_mode_log_bench)
         {
-            std::string space_separator = " ";
+            handle->log_ring->push(rocblas_log_to_bench, ' ', head, precision, xs...);
+        }
+    }
+}
 
-            std::ostream* os = handle->log_bench_os;
-            log_arguments(*os, space_separator, head, precision, xs...);
+// if profile logging is turned on with
+// (handle->layer_mode & rocblas_layer_mode_log_profile) == true
+// then
+// log_profile will count the call under the routine name head and the
+// argument name, value pairs xs, to be written as YAML with the call counts
+template <typename H, typename... Ts>
+void log_profile(rocblas_handle handle, const H& head, const Ts&... xs)
+{
+    if(nullptr != handle)
+    {
+        if(handle->layer_mode & rocblas_layer_mode_log_profile)
+        {
+            handle->log_histogram->record(head, xs...);
         }
     }
 }
 
-// return letters in place of rocblas enums
-std::string rocblas_transpose_letter(rocblas_operation trans);
-std::string rocblas_side_letter(rocblas_side side);
-std::string rocblas_fill_letter(rocblas_fill fill);
-std::string rocblas_diag_letter(rocblas_diagonal diag);
-std::string rocblas_datatype_letter(rocblas_datatype type);
+// if capture logging is turned on with
+// (handle->layer_mode & rocblas_layer_mode_log_capture) == true
+// and ROCBLAS_LOG_CAPTURE_PATH is set, then routines fill a binary record of
+// each call, started by rocblas_capture_start, and write it with log_capture
+inline bool rocblas_capture_enabled(rocblas_handle handle)
+{
+    return nullptr != handle && handle->log_capture;
+}
+
+// record function, precision, handle, stream, pointer mode and the scalars of
+// scalar_size bytes, reading device scalars in the order of the handle's stream
+rocblas_capture_record rocblas_capture_start(rocblas_handle handle,
+                                             const char* function,
+                                             char precision,
+                                             const void* alpha,
+                                             const void* beta,
+                                             size_t scalar_size);
 
-// replaces X in string with s, d, c, z or h depending on typename T
 template <typename T>
-std::string replaceX(std::string input_string)
+rocblas_capture_record rocblas_capture_start(rocblas_handle handle,
+                                             const char* function,
+                                             const T* alpha = nullptr,
+                                             const T* beta  = nullptr)
 {
-    if(std::is_same<T, float>::value)
-    {
-        std::replace(input_string.begin(), input_string.end(), 'X', 's');
-    }
-    else if(std::is_same<T, double>::value)
-    {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'd');
-    }
-    else if(std::is_same<T, rocblas_float_complex>::value)
-    {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'c');
-    }
-    else if(std::is_same<T, rocblas_double_complex>::value)
-    {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'z');
-    }
-    else if(std::is_same<T, rocblas_half>::value)
-    {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
-    }
-    return input_string;
+    return rocblas_capture_start(
+        handle, function, rocblas_precision_letter<T>(), alpha, beta, sizeof(T));
+}
+
+void log_capture(rocblas_handle handle, const rocblas_capture_record& record);
+
+// if timing is turned on with
+// (handle->layer_mode & rocblas_layer_mode_log_timing) == true
+// then log_timing returns a scope that times the work queued on the handle's
+// stream until it goes out of scope, under the routine name head and the
+// argument name, value pairs xs; flops is the work done by the call. Callers
+// start it after argument checks and quick returns, and a device memory size
+// query is never timed
+template <typename H, typename... Ts>
+rocblas_call_timer::scope
+    log_timing(rocblas_handle handle, double flops, const H& head, const Ts&... xs)
+{
+    if(nullptr == handle || !handle->call_timer || handle->is_device_memory_size_query())
+        return rocblas_call_timer::scope();
+
+    std::ostringstream function, shape;
+    function << head;
+    log_yaml_pairs(shape, xs...);
+
+    // drop the separator before the first pair
+    std::string pairs = shape.str();
+    pairs.erase(0, std::min<size_t>(2, pairs.size()));
+
+    return rocblas_call_timer::scope(
+        handle->call_timer.get(), handle->rocblas_stream, function.str(), pairs, flops);
 }
 
+// if solution logging is turned on with
+// (handle->layer_mode & rocblas_layer_mode_log_solution) == true
+// then log_solution counts the call of the Tensile problem with sizes I, J, K, L
+// and strides C1, C2, A1, A2, B1, B2 under the solution that served it; callers
+// check rocblas_solution_log_enabled first so the name is only looked up then
+inline bool rocblas_solution_log_enabled(rocblas_handle handle)
+{
+    return nullptr != handle && handle->solution_log;
+}
+
+const char* rocblas_tensile_problem_type(rocblas_operation trans_a, rocblas_operation trans_b);
+
+inline void log_solution(rocblas_handle handle,
+                         rocblas_operation trans_a,
+                         rocblas_operation trans_b,
+                         const char* precision,
+                         unsigned int sizeI,
+                         unsigned int sizeJ,
+                         unsigned int sizeK,
+                         unsigned int sizeL,
+                         unsigned int strideC1,
+                         unsigned int strideC2,
+                         unsigned int strideA1,
+                         unsigned int strideA2,
+                         unsigned int strideB1,
+                         unsigned int strideB2,
+                         const char* solution)
+{
+    const unsigned int sizes[]   = {sizeI, sizeJ, sizeK, sizeL};
+    const unsigned int strides[] = {strideC1, strideC2, strideA1, strideA2, strideB1, strideB2};
+    handle->solution_log->record(
+        rocblas_tensile_problem_type(trans_a, trans_b), precision, sizes, strides, solution);
+}
+
+// true if any logging layer is on; lets callers skip preparing log arguments
+inline bool rocblas_logging_enabled(rocblas_handle handle)
+{
+    return nullptr != handle &&
+           (handle->layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench |
+                                  rocblas_layer_mode_log_profile));
+}
+
+// return letters in place of rocblas enums
+const char* rocblas_transpose_letter(rocblas_operation trans);
+const char* rocblas_side_letter(rocblas_side side);
+const char* rocblas_fill_letter(rocblas_fill fill);
+const char* rocblas_diag_letter(rocblas_diagonal diag);
+const char* rocblas_datatype_letter(rocblas_datatype type);
+
+// return the size in bytes of one element of a rocblas datatype
+size_t rocblas_datatype_size(rocblas_datatype type);
+
 static inline bool isAligned(const void* pointer, size_t byte_count)
 {
     return (uintptr_t)pointer % byte_count == 0;
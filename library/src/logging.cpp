@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "logging.h"
+
+/*******************************************************************************
+ * format one logged value exactly as streaming the original argument would
+ ******************************************************************************/
+static void format_slot(std::ostream& os, const rocblas_log_slot& s)
+{
+    switch(s.type)
+    {
+    case rocblas_log_slot::i64: os << s.i; break;
+    case rocblas_log_slot::u64: os << s.u; break;
+    case rocblas_log_slot::f64: os << s.f; break;
+    case rocblas_log_slot::ptr: os << s.p; break;
+    case rocblas_log_slot::chr: os << s.c; break;
+    case rocblas_log_slot::str: os << s.s; break;
+    case rocblas_log_slot::str_x:
+        for(const char* c = s.s; *c; ++c)
+            os.put(*c == 'X' ? s.c : *c);
+        break;
+    case rocblas_log_slot::header: break;
+    }
+}
+
+/*******************************************************************************
+ * format all queued records of a ring, then write them with one call per stream
+ ******************************************************************************/
+void rocblas_log_ring::flush()
+{
+    std::lock_guard<std::mutex> lock(consumer_mutex);
+
+    size_t tail_ = tail.load(std::memory_order_relaxed);
+    size_t head_ = head.load(std::memory_order_acquire);
+    if(tail_ == head_)
+        return;
+
+    std::ostringstream text[2];
+    while(tail_ != head_)
+    {
+        const rocblas_log_slot& h = slot(tail_);
+        std::ostream& os          = text[h.dest];
+        for(uint32_t i = 0; i < h.count; i++)
+        {
+            if(i)
+                os << h.c;
+            format_slot(os, slot(tail_ + 1 + i));
+        }
+        os << "\n";
+        tail_ += 1 + h.count;
+    }
+    tail.store(tail_, std::memory_order_release);
+
+    rocblas_log_stream* streams[2] = {trace_, bench_};
+    for(int dest = 0; dest < 2; dest++)
+    {
+        std::string batch = text[dest].str();
+        if(streams[dest] && !batch.empty())
+        {
+            std::lock_guard<std::mutex> stream_lock(streams[dest]->mutex);
+            streams[dest]->os->write(batch.data(), batch.size());
+            streams[dest]->os->flush();
+        }
+    }
+}
+
+void rocblas_log_ring::close()
+{
+    std::lock_guard<std::mutex> lock(consumer_mutex);
+    trace_ = nullptr;
+    bench_ = nullptr;
+}
+
+/*******************************************************************************
+ * write the profile histogram, most frequent calls first
+ ******************************************************************************/
+void rocblas_log_histogram::dump(std::ostream& os)
+{
+    typedef std::pair<std::string, size_t> entry_t;
+    std::vector<entry_t> sorted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sorted.assign(counts.begin(), counts.end());
+        counts.clear();
+    }
+
+    std::stable_sort(sorted.begin(), sorted.end(), [](const entry_t& a, const entry_t& b) {
+        return a.second > b.second;
+    });
+
+    for(const auto& entry : sorted)
+        os << "- { " << entry.first << ", call_count: " << entry.second << " }\n";
+    os.flush();
+}
+
+/*******************************************************************************
+ * Tensile solution picked per problem
+ ******************************************************************************/
+bool rocblas_solution_log::is_fallback(const char* solution)
+{
+    return solution == nullptr || *solution == '\0' || strstr(solution, "_KLS") != nullptr;
+}
+
+void rocblas_solution_log::record(const char* problem_type,
+                                  const char* precision,
+                                  const unsigned int (&sizes)[4],
+                                  const unsigned int (&strides)[6],
+                                  const char* solution)
+{
+    std::ostringstream key;
+    key << problem_type << '_' << precision;
+    std::string type = key.str();
+    for(unsigned int size : sizes)
+        key << ',' << size;
+    for(unsigned int stride : strides)
+        key << ',' << stride;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key.str());
+    if(it != index.end())
+    {
+        selections[it->second].calls++;
+        return;
+    }
+
+    rocblas_solution_selection s = {};
+    strncpy(s.problem_type, type.c_str(), sizeof(s.problem_type) - 1);
+    s.size_i    = sizes[0];
+    s.size_j    = sizes[1];
+    s.size_k    = sizes[2];
+    s.size_l    = sizes[3];
+    s.stride_c1 = strides[0];
+    s.stride_c2 = strides[1];
+    s.stride_a1 = strides[2];
+    s.stride_a2 = strides[3];
+    s.stride_b1 = strides[4];
+    s.stride_b2 = strides[5];
+    if(solution)
+        strncpy(s.solution, solution, sizeof(s.solution) - 1);
+    s.calls    = 1;
+    s.fallback = is_fallback(solution) ? 1 : 0;
+
+    index[key.str()] = selections.size();
+    selections.push_back(s);
+}
+
+void rocblas_solution_log::get_selections(rocblas_solution_selection* out, size_t* count)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(out)
+        std::copy_n(selections.begin(), std::min(*count, selections.size()), out);
+    *count = selections.size();
+}
+
+/*******************************************************************************
+ * process-wide log writer thread; it flushes every registered ring
+ * periodically, or earlier when a ring is filling up
+ ******************************************************************************/
+namespace {
+class rocblas_log_sink
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::shared_ptr<rocblas_log_ring>> rings;
+    std::thread writer;
+    bool stop = false;
+
+    // set by producers without the mutex; a wake-up that lands between the
+    // writer's check and its wait is only late by one period
+    std::atomic<bool> wake{false};
+
+    void run()
+    {
+        std::vector<std::shared_ptr<rocblas_log_ring>> batch;
+        std::unique_lock<std::mutex> lock(mutex);
+        while(!stop)
+        {
+            cv.wait_for(lock, std::chrono::milliseconds(10), [this] {
+                return stop || wake.load(std::memory_order_acquire);
+            });
+            wake.store(false, std::memory_order_relaxed);
+            batch = rings;
+            lock.unlock();
+
+            for(auto& ring : batch)
+                ring->flush();
+            batch.clear();
+
+            lock.lock();
+        }
+    }
+
+    public:
+    void add(const std::shared_ptr<rocblas_log_ring>& ring)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rings.push_back(ring);
+        if(!writer.joinable())
+            writer = std::thread(&rocblas_log_sink::run, this);
+    }
+
+    void remove(const std::shared_ptr<rocblas_log_ring>& ring)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+    }
+
+    // called from the producer path of the rings, so it takes no lock
+    void notify()
+    {
+        wake.store(true, std::memory_order_release);
+        cv.notify_one();
+    }
+
+    ~rocblas_log_sink()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_one();
+        if(writer.joinable())
+            writer.join();
+
+        // handles that were never destroyed still get their records written
+        for(auto& ring : rings)
+            ring->flush();
+    }
+};
+
+rocblas_log_sink& log_sink()
+{
+    static rocblas_log_sink sink;
+    return sink;
+}
+} // namespace
+
+void rocblas_log_sink_add(const std::shared_ptr<rocblas_log_ring>& ring) { log_sink().add(ring); }
+
+void rocblas_log_sink_remove(const std::shared_ptr<rocblas_log_ring>& ring)
+{
+    log_sink().remove(ring);
+}
+
+void rocblas_log_sink_notify() { log_sink().notify(); }
@@ -68,6 +68,44 @@ extern "C" rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocbla
     }
 }
 
+/*******************************************************************************
+ * ! \brief get the number of real products complex gemm uses, 4M or 3M
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_complex_gemm_mode(rocblas_handle handle,
+                                                        rocblas_complex_gemm_mode* mode)
+{
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    if(mode == nullptr)
+    {
+        return rocblas_status_invalid_pointer;
+    }
+    *mode = handle->complex_gemm_mode;
+    log_trace(handle, "rocblas_get_complex_gemm_mode", *mode);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ * ! \brief set the number of real products complex gemm uses, 4M or 3M
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_complex_gemm_mode(rocblas_handle handle,
+                                                        rocblas_complex_gemm_mode mode)
+{
+    if(handle == nullptr)
+    {
+        return rocblas_status_invalid_handle;
+    }
+    if(mode != rocblas_complex_gemm_mode_4m && mode != rocblas_complex_gemm_mode_3m)
+    {
+        return rocblas_status_not_implemented;
+    }
+    log_trace(handle, "rocblas_set_complex_gemm_mode", mode);
+    handle->complex_gemm_mode = mode;
+    return rocblas_status_success;
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -846,3 +884,116 @@ extern "C" rocblas_status rocblas_get_matrix(rocblas_int rows,
         return rocblas_status_internal_error;
     }
 }
+
+/*******************************************************************************
+ *! \brief  start recording the device memory needed by subsequent calls
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_start_device_memory_size_query(rocblas_handle handle)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    log_trace(handle, "rocblas_start_device_memory_size_query");
+    return handle->start_device_memory_size_query();
+}
+
+/*******************************************************************************
+ *! \brief  stop recording and return the device memory needed in bytes
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_stop_device_memory_size_query(rocblas_handle handle,
+                                                                size_t* size)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    if(size == nullptr)
+        return rocblas_status_invalid_pointer;
+    log_trace(handle, "rocblas_stop_device_memory_size_query");
+    return handle->stop_device_memory_size_query(size);
+}
+
+/*******************************************************************************
+ *! \brief  reserve device memory so that later calls do not allocate
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_device_memory_size(rocblas_handle handle, size_t size)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    log_trace(handle, "rocblas_set_device_memory_size", size);
+    return handle->set_device_memory_size(size);
+}
+
+/*******************************************************************************
+ *! \brief  get the device memory currently reserved by the handle in bytes
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    if(size == nullptr)
+        return rocblas_status_invalid_pointer;
+    *size = handle->get_device_memory_size();
+    log_trace(handle, "rocblas_get_device_memory_size", *size);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ *! \brief   get the number of log records dropped by the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_log_dropped_count(rocblas_handle handle, size_t* count)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    if(count == nullptr)
+        return rocblas_status_invalid_pointer;
+    *count = handle->get_dropped_log_count();
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ *! \brief   write the profile log accumulated by the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_write_log_profile(rocblas_handle handle)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    handle->write_log_profile();
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ *! \brief   get the GPU time per routine and shape of the calls on the handle
+ ******************************************************************************/
+extern "C" rocblas_status
+    rocblas_get_call_timings(rocblas_handle handle, rocblas_call_timing* timings, size_t* count)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    if(count == nullptr)
+        return rocblas_status_invalid_pointer;
+    if(!handle->call_timer)
+    {
+        *count = 0;
+        return rocblas_status_success;
+    }
+    handle->call_timer->get_timings(timings, count);
+    return rocblas_status_success;
+}
+
+/*******************************************************************************
+ *! \brief   get the Tensile solution picked per gemm problem on the handle
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_solution_selections(rocblas_handle handle,
+                                                          rocblas_solution_selection* selections,
+                                                          size_t* count)
+{
+    if(handle == nullptr)
+        return rocblas_status_invalid_handle;
+    if(count == nullptr)
+        return rocblas_status_invalid_pointer;
+    if(!handle->solution_log)
+    {
+        *count = 0;
+        return rocblas_status_success;
+    }
+    handle->solution_log->get_selections(selections, count);
+    return rocblas_status_success;
+}
@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2018 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include <algorithm>
+#include <cstring>
+#include "definitions.h"
+#include "timing.h"
+
+rocblas_call_timer::~rocblas_call_timer()
+{
+    for(auto& call : pending)
+    {
+        hipEventDestroy(call.start);
+        hipEventDestroy(call.stop);
+    }
+    for(auto event : free_events)
+        hipEventDestroy(event);
+}
+
+/*******************************************************************************
+ * events are reused once their elapsed time has been collected
+ ******************************************************************************/
+hipEvent_t rocblas_call_timer::get_event()
+{
+    hipEvent_t event = nullptr;
+    if(free_events.empty())
+    {
+        PRINT_IF_HIP_ERROR(hipEventCreate(&event));
+    }
+    else
+    {
+        event = free_events.back();
+        free_events.pop_back();
+    }
+    return event;
+}
+
+/*******************************************************************************
+ * add the elapsed times of completed calls to their entries, oldest first;
+ * calls on one stream complete in order, so the first incomplete call ends the
+ * scan unless wait is set
+ ******************************************************************************/
+void rocblas_call_timer::collect(bool wait)
+{
+    while(!pending.empty())
+    {
+        pending_call& call = pending.front();
+        if(wait)
+        {
+            PRINT_IF_HIP_ERROR(hipEventSynchronize(call.stop));
+        }
+        else if(hipEventQuery(call.stop) != hipSuccess)
+        {
+            break;
+        }
+
+        float milliseconds = 0;
+        if(hipEventElapsedTime(&milliseconds, call.start, call.stop) == hipSuccess)
+        {
+            entry& e = entries[call.entry];
+            e.calls++;
+            e.milliseconds += milliseconds;
+            e.flops += call.flops;
+        }
+
+        free_events.push_back(call.start);
+        free_events.push_back(call.stop);
+        pending.pop_front();
+    }
+}
+
+void rocblas_call_timer::start(hipStream_t stream,
+                               std::string function,
+                               std::string shape,
+                               double flops)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(depth++)
+        return;
+
+    collect(false);
+
+    auto key = std::make_pair(std::move(function), std::move(shape));
+    auto it  = entry_index.find(key);
+    if(it == entry_index.end())
+    {
+        entries.emplace_back();
+        entries.back().function = key.first;
+        entries.back().shape    = key.second;
+        it                      = entry_index.emplace(std::move(key), entries.size() - 1).first;
+    }
+
+    current.entry = it->second;
+    current.flops = flops;
+    current.start = get_event();
+    current.stop  = get_event();
+    PRINT_IF_HIP_ERROR(hipEventRecord(current.start, stream));
+}
+
+void rocblas_call_timer::stop(hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(--depth)
+        return;
+
+    PRINT_IF_HIP_ERROR(hipEventRecord(current.stop, stream));
+    pending.push_back(current);
+}
+
+rocblas_call_timer::scope::scope(rocblas_call_timer* timer,
+                                 hipStream_t stream,
+                                 std::string function,
+                                 std::string shape,
+                                 double flops)
+    : timer(timer), stream(stream)
+{
+    timer->start(stream, std::move(function), std::move(shape), flops);
+}
+
+rocblas_call_timer::scope::~scope()
+{
+    if(timer)
+        timer->stop(stream);
+}
+
+/*******************************************************************************
+ * report the aggregated timings; waits for calls still running on the GPU
+ ******************************************************************************/
+void rocblas_call_timer::get_timings(rocblas_call_timing* timings, size_t* count)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    collect(true);
+
+    if(timings)
+    {
+        size_t n = std::min(*count, entries.size());
+        for(size_t i = 0; i < n; i++)
+        {
+            const entry& e        = entries[i];
+            rocblas_call_timing t = {};
+            strncpy(t.function, e.function.c_str(), sizeof(t.function) - 1);
+            strncpy(t.shape, e.shape.c_str(), sizeof(t.shape) - 1);
+            t.calls        = e.calls;
+            t.milliseconds = e.milliseconds;
+            t.gflops       = e.milliseconds > 0 ? e.flops / (e.milliseconds * 1e6) : 0;
+            timings[i]     = t;
+        }
+    }
+    *count = entries.size();
+}
@@ -2,12 +2,16 @@
  * Copyright 2016 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#include <string>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include "rocblas.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
 
 // return letter N,T,C in place of rocblas_operation enum
-std::string rocblas_transpose_letter(rocblas_operation trans)
+const char* rocblas_transpose_letter(rocblas_operation trans)
 {
     if(trans == rocblas_operation_none)
     {
@@ -28,7 +32,7 @@ std::string rocblas_transpose_letter(rocblas_operation trans)
     }
 }
 // return letter in place of rocblas_side enum
-std::string rocblas_side_letter(rocblas_side side)
+const char* rocblas_side_letter(rocblas_side side)
 {
     if(side == rocblas_side_left)
     {
@@ -49,7 +53,7 @@ std::string rocblas_side_letter(rocblas_side side)
     }
 }
 // return letter U, L, B in place of rocblas_fill enum
-std::string rocblas_fill_letter(rocblas_fill fill)
+const char* rocblas_fill_letter(rocblas_fill fill)
 {
     if(fill == rocblas_fill_upper)
     {
@@ -70,7 +74,7 @@ std::string rocblas_fill_letter(rocblas_fill fill)
     }
 }
 // return letter N,T,C in place of rocblas_operation enum
-std::string rocblas_diag_letter(rocblas_diagonal diag)
+const char* rocblas_diag_letter(rocblas_diagonal diag)
 {
     if(diag == rocblas_diagonal_non_unit)
     {
@@ -87,7 +91,7 @@ std::string rocblas_diag_letter(rocblas_diagonal diag)
     }
 }
 // return letter h, s, d, k, c, z in place of rocblas_datatype
-std::string rocblas_datatype_letter(rocblas_datatype type)
+const char* rocblas_datatype_letter(rocblas_datatype type)
 {
     switch(type)
     {
@@ -105,8 +109,99 @@ std::string rocblas_datatype_letter(rocblas_datatype type)
     case rocblas_datatype_u8_c: return "u8c";
     case rocblas_datatype_i32_c: return "i32c";
     case rocblas_datatype_u32_c: return "u32c";
+    case rocblas_datatype_bf16_r: return "bf16r";
+    case rocblas_datatype_bf16_c: return "bf16c";
     default:
         std::cerr << "rocblas ERROR: unsupported datatype (" << type << ")" << std::endl;
         return " ";
     }
 }
+
+// return the size in bytes of one element of a rocblas datatype
+size_t rocblas_datatype_size(rocblas_datatype type)
+{
+    switch(type)
+    {
+    case rocblas_datatype_f16_r: return 2;
+    case rocblas_datatype_f32_r: return 4;
+    case rocblas_datatype_f64_r: return 8;
+    case rocblas_datatype_f16_c: return 4;
+    case rocblas_datatype_f32_c: return 8;
+    case rocblas_datatype_f64_c: return 16;
+    case rocblas_datatype_i8_r: return 1;
+    case rocblas_datatype_u8_r: return 1;
+    case rocblas_datatype_i32_r: return 4;
+    case rocblas_datatype_u32_r: return 4;
+    case rocblas_datatype_i8_c: return 2;
+    case rocblas_datatype_u8_c: return 2;
+    case rocblas_datatype_i32_c: return 8;
+    case rocblas_datatype_u32_c: return 8;
+    case rocblas_datatype_bf16_r: return 2;
+    case rocblas_datatype_bf16_c: return 4;
+    default: return 0;
+    }
+}
+
+// return the index names Tensile gives the gemm problem with transposes
+// trans_a and trans_b, without the precision suffix
+const char* rocblas_tensile_problem_type(rocblas_operation trans_a, rocblas_operation trans_b)
+{
+    if(trans_a == rocblas_operation_none)
+        return trans_b == rocblas_operation_none ? "Cijk_Ailk_Bljk" : "Cijk_Ailk_Bjlk";
+    else
+        return trans_b == rocblas_operation_none ? "Cijk_Alik_Bljk" : "Cijk_Alik_Bjlk";
+}
+
+/*******************************************************************************
+ * capture logging
+ ******************************************************************************/
+rocblas_capture_record rocblas_capture_start(rocblas_handle handle,
+                                             const char* function,
+                                             char precision,
+                                             const void* alpha,
+                                             const void* beta,
+                                             size_t scalar_size)
+{
+    rocblas_capture_record record = {};
+    strncpy(record.function, function, sizeof(record.function) - 1);
+    record.precision    = precision;
+    record.pointer_mode = handle->pointer_mode;
+    record.handle       = reinterpret_cast<uintptr_t>(handle);
+    record.stream       = reinterpret_cast<uintptr_t>(handle->rocblas_stream);
+    record.batch_count  = 1;
+
+    scalar_size = std::min(scalar_size, sizeof(record.alpha));
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        if(alpha)
+            memcpy(record.alpha, alpha, scalar_size);
+        if(beta)
+            memcpy(record.beta, beta, scalar_size);
+    }
+    else if(alpha || beta)
+    {
+        // device scalars may be written by earlier work on the stream, so the
+        // capture waits for it; this serializes calls in device pointer mode
+        if(alpha)
+        {
+            PRINT_IF_HIP_ERROR(hipMemcpyAsync(record.alpha,
+                                              alpha,
+                                              scalar_size,
+                                              hipMemcpyDeviceToHost,
+                                              handle->rocblas_stream));
+        }
+        if(beta)
+        {
+            PRINT_IF_HIP_ERROR(hipMemcpyAsync(
+                record.beta, beta, scalar_size, hipMemcpyDeviceToHost, handle->rocblas_stream));
+        }
+        PRINT_IF_HIP_ERROR(hipStreamSynchronize(handle->rocblas_stream));
+    }
+    return record;
+}
+
+void log_capture(rocblas_handle handle, const rocblas_capture_record& record)
+{
+    std::lock_guard<std::mutex> lock(handle->log_capture->mutex);
+    handle->log_capture->os->write(reinterpret_cast<const char*>(&record), sizeof(record));
+}